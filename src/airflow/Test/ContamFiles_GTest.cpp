@@ -0,0 +1,182 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/PrjReader.hpp"
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <chrono>
+#include <iostream>
+
+static void writeFile(const openstudio::path& p, const std::string& contents)
+{
+  openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+  file << contents;
+}
+
+// Write simread style link and node results for the specified number of paths, nodes and hourly time steps
+static void writeSimResults(const openstudio::path& base, int npaths, int nnodes, int nhours)
+{
+  std::string lfr("day\ttime\tP#\tdP\tF0\tF1\n");
+  std::string nfr("day\ttime\tZ#\tT\tP\tD\n");
+  static const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  char line[128];
+  for(int h = 0; h <= nhours; ++h) {
+    int month = 0;
+    int day = (h / 24) % 365;
+    while(day >= daysInMonth[month]) {
+      day -= daysInMonth[month++];
+    }
+    snprintf(line, sizeof(line), "%d/%d\t%02d:00:00", month + 1, day + 1, h % 24);
+    std::string stamp(line);
+    for(int p = 1; p <= npaths; ++p) {
+      snprintf(line, sizeof(line), "\t%d\t%.4f\t%.6e\t%.6e\n", p, 0.01 * p + h, 1.0e-3 * p, -1.0e-4 * h);
+      lfr += stamp + line;
+    }
+    for(int n = 0; n <= nnodes; ++n) {
+      snprintf(line, sizeof(line), "\t%d\t%.2f\t%.3f\t%.4f\n", n, 293.15 + n, 101325.0 + h, n == 0 ? 0.0 : 1.2);
+      nfr += stamp + line;
+    }
+  }
+  openstudio::path p(base);
+  writeFile(p.replace_extension(openstudio::toPath("lfr").string()), lfr);
+  writeFile(p.replace_extension(openstudio::toPath("nfr").string()), nfr);
+}
+
+TEST_F(AirflowFixture, ContamFiles_Reader)
+{
+  std::string input("! comment line\n"
+                    "3 1.5e-3\t-2 ! trailing comment\r\n"
+                    "\n"
+                    "  name   4000000000\n"
+                    "rest of line\n"
+                    "!\n"
+                    "-999\n"
+                    "abc\n");
+  openstudio::contam::Reader reader(input);
+  EXPECT_EQ(3, reader.readInt());
+  EXPECT_DOUBLE_EQ(1.5e-3, reader.readDouble());
+  EXPECT_EQ(-2, reader.readInt());
+  EXPECT_EQ(2, reader.lineNumber());
+  EXPECT_EQ("name", reader.readString());
+  EXPECT_EQ(4000000000u, reader.readUInt());
+  EXPECT_EQ(4, reader.lineNumber());
+  EXPECT_EQ("rest of line", reader.readLine());
+  EXPECT_NO_THROW(reader.read999());
+  EXPECT_EQ(7, reader.lineNumber());
+  EXPECT_THROW(reader.readDouble(), std::exception);
+  EXPECT_THROW(reader.readString(), std::exception);
+
+  openstudio::contam::Reader sections("1 2\n3\n-999\n4\n");
+  EXPECT_EQ(std::vector<int>({2}), sections.readIntVector());
+  EXPECT_EQ("3\n-999\n", sections.readSection());
+  EXPECT_EQ(4, sections.readInt());
+}
+
+TEST_F(AirflowFixture, ContamFiles_SimFile)
+{
+  openstudio::path base = openstudio::toPath("ContamFiles_SimFile.sim");
+  writeSimResults(base, 3, 2, 2);
+
+  openstudio::contam::SimFile sim(base);
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  EXPECT_EQ(2u, sim.dateTimes().size());
+
+  std::vector<std::vector<double> > dP = sim.dP();
+  ASSERT_EQ(3u, dP.size());
+  ASSERT_EQ(3u, dP[1].size());
+  EXPECT_DOUBLE_EQ(2.02, dP[1][2]);
+
+  boost::optional<openstudio::TimeSeries> series = sim.pathDeltaP(3);
+  ASSERT_TRUE(series);
+  ASSERT_EQ(2u, series->values().size());
+  EXPECT_DOUBLE_EQ(0.5 * (0.03 + 1.03), series->values()[0]);
+  EXPECT_FALSE(sim.pathDeltaP(4));
+
+  series = sim.pathFlow(2);
+  ASSERT_TRUE(series);
+  EXPECT_DOUBLE_EQ(2.0e-3 - 0.5e-4, series->values()[0]);
+
+  ASSERT_EQ(3u, sim.T().size());
+  series = sim.nodeTemperature(2);
+  ASSERT_TRUE(series);
+  EXPECT_DOUBLE_EQ(295.15, series->values()[1]);
+  series = sim.nodeDensity(0);
+  ASSERT_TRUE(series);
+  EXPECT_DOUBLE_EQ(0.0, series->values()[0]);
+}
+
+TEST_F(AirflowFixture, DISABLED_ContamFiles_Benchmark)
+{
+  // A year of hourly results for a large building
+  openstudio::path base = openstudio::toPath("ContamFiles_Benchmark.sim");
+  writeSimResults(base, 500, 100, 8760);
+  openstudio::path lfr(base);
+  lfr.replace_extension(openstudio::toPath("lfr").string());
+  double megabytes = openstudio::filesystem::file_size(lfr) / 1048576.0;
+  openstudio::path nfr(base);
+  nfr.replace_extension(openstudio::toPath("nfr").string());
+  megabytes += openstudio::filesystem::file_size(nfr) / 1048576.0;
+
+  auto start = std::chrono::steady_clock::now();
+  openstudio::contam::SimFile sim(base);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(8761u, sim.fileDateTimes().size());
+  std::cout << "SIM results: " << megabytes << " MB in " << elapsed.count() << " s, "
+            << megabytes / elapsed.count() << " MB/s" << std::endl;
+
+  // PRJ style input, mostly numbers with some names and comments
+  std::string input;
+  char line[128];
+  int nlines = 1000000;
+  for(int i = 0; i < nlines; ++i) {
+    if(i % 100 == 0) {
+      input += "! number name value\n";
+    }
+    snprintf(line, sizeof(line), "%d element_%d %.6e %d\n", i, i, 1.0e-3 * i, i % 7);
+    input += line;
+  }
+  start = std::chrono::steady_clock::now();
+  openstudio::contam::Reader reader(input);
+  double sum = 0;
+  for(int i = 0; i < nlines; ++i) {
+    sum += reader.readInt();
+    reader.readString();
+    sum += reader.readDouble();
+    sum += reader.readUInt();
+  }
+  elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_LT(0.0, sum);
+  megabytes = input.size() / 1048576.0;
+  std::cout << "PRJ tokens: " << megabytes << " MB in " << elapsed.count() << " s, "
+            << megabytes / elapsed.count() << " MB/s" << std::endl;
+}
@@ -30,6 +30,10 @@
 #include "PrjReader.hpp"
 #include <iostream>
 #include <stdlib.h>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
 
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/FilesystemHelpers.hpp"
@@ -39,163 +43,157 @@ namespace openstudio {
 namespace contam {
 
 Reader::Reader( openstudio::filesystem::ifstream &file )
-  : m_stream(openstudio::filesystem::read_as_string(file)), m_lineNumber(0)
+  : m_buffer(openstudio::filesystem::read_as_string(file)), m_position(0), m_lineNumber(0)
 {
 }
 
-Reader::Reader(const std::string& string, int starting) : m_lineNumber(starting)
+Reader::Reader(const std::string& string, int starting) : m_buffer(string), m_position(0), m_lineNumber(starting)
 {
-  m_stream.str(string);
 }
 
 Reader::~Reader()
 {
 }
 
-double Reader::readDouble()
+std::string_view Reader::nextLine()
 {
-  const auto string = readString();
-  try {
-    return openstudio::string_conversions::to<double>(string);
-  } catch (const std::bad_cast &) {
-    LOG_AND_THROW("Floating point (double) conversion error at line " << m_lineNumber << " for \"" << string << "\"");
+  if(m_position >= m_buffer.size()) {
+    LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
   }
+  std::string::size_type end = m_buffer.find('\n', m_position);
+  if(end == std::string::npos) {
+    end = m_buffer.size();
+  }
+  std::string_view line(m_buffer.data() + m_position, end - m_position);
+  m_position = end + 1;
+  m_lineNumber++;
+  return line;
 }
 
-std::string Reader::readString()
+std::string_view Reader::nextDataLine()
+{
+  std::string_view line = nextLine();
+  while(!line.empty() && line[0] == '!') {
+    line = nextLine();
+  }
+  return line;
+}
+
+std::string_view Reader::nextToken()
 {
+  static const char* whitespace = " \t\r\n";
   while(1) {
-    while(m_entries.size() == 0) {
-      std::string input;
-      std::getline(m_stream, input);
-      LOG(Debug, "Line read: " << input);
-      if(!m_stream) {
-        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-      }
-      m_lineNumber++;
-      while(input[0]=='!') {
-        std::getline(m_stream, input);
-        LOG(Debug, "Line read: " << input);
-        if(!m_stream) {
-          LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-        }
-        m_lineNumber++;
-      }
-
-      std::vector<std::string> strs;
-      boost::split(strs,input,boost::is_any_of(" "));
-
-      m_entries.clear();
-      for (const auto &s : strs) {
-        std::string s2 = boost::replace_all_copy(s, " ", "");
-        boost::replace_all(s2, "\r", "");
-        boost::replace_all(s2, "\n", "");
-        boost::replace_all(s2, "\t", "");
-        if (!s2.empty()) {
-          m_entries.push_back(s2);
-        }
-      }
+    std::string_view::size_type begin = m_entries.find_first_not_of(whitespace);
+    while(begin == std::string_view::npos) {
+      m_entries = nextDataLine();
+      begin = m_entries.find_first_not_of(whitespace);
+    }
+    std::string_view::size_type end = m_entries.find_first_of(whitespace, begin);
+    if(end == std::string_view::npos) {
+      end = m_entries.size();
     }
-    std::string out = m_entries.front();
-    m_entries.pop_front();
+    std::string_view out = m_entries.substr(begin, end - begin);
+    m_entries.remove_prefix(end);
     if(out[0] == '!') {
-      m_entries.clear();
+      // The rest of the line is a comment
+      m_entries = std::string_view();
     } else {
-      LOG(Debug, "String return: " << out);
       return out;
     }
   }
 }
 
+// Tokens are views into a buffer that is null terminated and in which every token is followed by
+// whitespace or the terminator, so the strto* functions cannot run past the end of a token.
+
+double Reader::readDouble()
+{
+  const std::string_view string = nextToken();
+  char* end = nullptr;
+  errno = 0;
+  double value = std::strtod(string.data(), &end);
+  if((end != string.data() + string.size()) || (errno == ERANGE && std::abs(value) > 1.0)) {
+    LOG_AND_THROW("Floating point (double) conversion error at line " << m_lineNumber << " for \"" << string << "\"");
+  }
+  return value;
+}
+
+std::string Reader::readString()
+{
+  return std::string(nextToken());
+}
+
 int Reader::readInt()
 {
-  std::string string = readString();
-  int value = 0;
-  try {
-    value = std::stoi(string);
-  }catch(const std::exception&){
+  const std::string_view string = nextToken();
+  char* end = nullptr;
+  errno = 0;
+  long value = std::strtol(string.data(), &end, 10);
+  if((end == string.data()) || (errno == ERANGE)
+    || (value < std::numeric_limits<int>::min()) || (value > std::numeric_limits<int>::max())) {
     LOG_AND_THROW("Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
   }
-  return value;
+  return static_cast<int>(value);
 }
 
 unsigned int Reader::readUInt()
 {
-  std::string string = readString();
-  int value = 0;
-  try {
-    value = std::stoul(string);
-  } catch (const std::exception&) {
+  const std::string_view string = nextToken();
+  char* end = nullptr;
+  errno = 0;
+  unsigned long value = std::strtoul(string.data(), &end, 10);
+  if((end == string.data()) || (errno == ERANGE)) {
     LOG_AND_THROW("Unsigned Integer conversion error at line " << m_lineNumber << " for \"" << string << "\"");
   }
-  return value;
+  return static_cast<unsigned int>(value);
 }
 
 std::string Reader::readLine()
 {
   /* Dump any other input */
-  if(m_entries.size()) {
-    m_entries.clear();
-  }
-  std::string input;
-  std::getline(m_stream, input);
-  LOG(Debug, "Line read: " << input);
-  if(!m_stream) {
-    LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-  }
-  m_lineNumber++;
-  while(input[0]=='!') {
-    std::getline(m_stream, input);
-    LOG(Debug, "Line read: " << input);
-    if(!m_stream) {
-      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-    }
-    m_lineNumber++;
-  }
-  return input;
+  m_entries = std::string_view();
+  return std::string(nextDataLine());
 }
 
 void Reader::read999()
 {
-  std::string input = readLine();
-  if(!boost::starts_with(input, "-999")) {
+  m_entries = std::string_view();
+  if(nextDataLine().substr(0, 4) != "-999") {
     LOG_AND_THROW("Failed to read -999 at line " << m_lineNumber);
   }
 }
 
 void Reader::read999(std::string mesg)
 {
-  std::string input = readLine();
-  if (!boost::starts_with(input, "-999")) {
+  m_entries = std::string_view();
+  if(nextDataLine().substr(0, 4) != "-999") {
     LOG_AND_THROW(mesg << " at line " << m_lineNumber);
   }
 }
 
 void Reader::readEnd()
 {
-  std::string input = readLine();
-  if (!boost::starts_with(input, "* end project file.")) {
+  static const std::string_view end("* end project file.");
+  m_entries = std::string_view();
+  if(nextDataLine().substr(0, end.size()) != end) {
     LOG_AND_THROW("Failed to read file end at line " << m_lineNumber);
   }
 }
 
 void Reader::skipSection()
 {
-  readSection();
+  while(nextLine().substr(0, 4) != "-999") {
+  }
 }
 
 std::string Reader::readSection()
 {
   std::string section;
   while(1) {
-    std::string input;
-    std::getline(m_stream, input);
-    if(!m_stream) {
-      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-    }
-    m_lineNumber++;
-    section += std::string(input + '\n');
-    if(input.find("-999") == 0) {
+    std::string_view input = nextLine();
+    section.append(input.data(), input.size());
+    section += '\n';
+    if(input.substr(0, 4) == "-999") {
       break;
     }
   }
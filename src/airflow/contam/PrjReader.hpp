@@ -31,6 +31,7 @@
 #define AIRFLOW_CONTAM_PRJREADER_HPP
 
 #include <sstream>
+#include <string_view>
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/Filesystem.hpp"
 
@@ -39,6 +40,8 @@
 namespace openstudio {
 namespace contam {
 
+/** Reader tokenizes CONTAM PRJ input. The whole input is held in a single buffer and tokens are
+ *  located in place, so numbers are converted without building an intermediate string. */
 class Reader
 {
 public:
@@ -46,6 +49,9 @@ public:
   explicit Reader(const std::string& string, int starting=0);
   ~Reader();
 
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
   double readDouble();
   std::string readString();
   int readInt();
@@ -77,9 +83,15 @@ private:
   std::string readStdString();
   std::string readLineString();
 
-  std::stringstream m_stream;
+  std::string_view nextLine();
+  std::string_view nextDataLine();
+  std::string_view nextToken();
+
+  std::string m_buffer;
+  std::string::size_type m_position;
   int m_lineNumber;
-  std::list<std::string> m_entries;
+  // The unread remainder of the current line
+  std::string_view m_entries;
 
   REGISTER_LOGGER("openstudio.contam.Reader");
 };
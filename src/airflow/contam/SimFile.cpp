@@ -29,8 +29,13 @@
 
 #include "SimFile.hpp"
 
-#include <boost/algorithm/string.hpp>
-#include <boost/algorithm/string/classification.hpp>
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
 
 namespace openstudio {
 namespace contam {
@@ -44,6 +49,169 @@ int indexOf(const std::vector<int>& list, int target) {
   return -1;
 }
 
+namespace {
+
+  // Reads a whole file into memory, returning false if it cannot be opened
+  bool readFile(const std::string& fileName, std::string& buffer)
+  {
+    openstudio::filesystem::ifstream file(openstudio::toPath(fileName), std::ios_base::binary);
+    if(!file.is_open()) {
+      return false;
+    }
+    file.seekg(0, std::ios_base::end);
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios_base::beg);
+    buffer.resize(size > 0 ? static_cast<std::size_t>(size) : 0);
+    if(!buffer.empty()) {
+      file.read(&buffer[0], buffer.size());
+      buffer.resize(static_cast<std::size_t>(file.gcount()));
+    }
+    return true;
+  }
+
+  // Returns the next line of the buffer without its line ending, or false at the end of the buffer
+  bool nextLine(const std::string& buffer, std::string::size_type& position, std::string_view& line)
+  {
+    if(position >= buffer.size()) {
+      return false;
+    }
+    std::string::size_type end = buffer.find('\n', position);
+    if(end == std::string::npos) {
+      end = buffer.size();
+    }
+    line = std::string_view(buffer.data() + position, end - position);
+    if(!line.empty() && line.back() == '\r') {
+      line.remove_suffix(1);
+    }
+    position = end + 1;
+    return true;
+  }
+
+  // Splits a line on tabs into at most maxFields views, returning the total number of fields
+  unsigned splitTabs(std::string_view line, std::string_view* fields, unsigned maxFields)
+  {
+    unsigned n = 0;
+    while(true) {
+      std::string_view::size_type tab = line.find('\t');
+      if(n < maxFields) {
+        fields[n] = line.substr(0, tab);
+      }
+      ++n;
+      if(tab == std::string_view::npos) {
+        return n;
+      }
+      line.remove_prefix(tab + 1);
+    }
+  }
+
+  const char* terminatedField(std::string_view field, char (&buffer)[64], std::string& longField)
+  {
+    if (field.size() < sizeof(buffer)) {
+      std::memcpy(buffer, field.data(), field.size());
+      buffer[field.size()] = '\0';
+      return buffer;
+    }
+    longField.assign(field.data(), field.size());
+    return longField.c_str();
+  }
+
+  bool fieldToInt(std::string_view field, int& value)
+  {
+    char buffer[64];
+    std::string longField;
+    const char* str = terminatedField(field, buffer, longField);
+    char* end = nullptr;
+    errno = 0;
+    long result = std::strtol(str, &end, 10);
+    if((end == str) || (errno == ERANGE)
+      || (result < std::numeric_limits<int>::min()) || (result > std::numeric_limits<int>::max())) {
+      return false;
+    }
+    value = static_cast<int>(result);
+    return true;
+  }
+
+  bool fieldToDouble(std::string_view field, double& value)
+  {
+    char buffer[64];
+    std::string longField;
+    const char* str = terminatedField(field, buffer, longField);
+    char* end = nullptr;
+    value = std::strtod(str, &end);
+    return end != str;
+  }
+
+  // Collects the results of a simread output file in file order, which is one row per path (or node)
+  // per time, and then gathers them so that all of the values for each path (or node) are contiguous.
+  class ResultColumns
+  {
+  public:
+    // Returns the index of a path (or node) number, in order of first appearance
+    int index(int nr)
+    {
+      // The numbers repeat in the same order every time step, so check the next expected one first
+      if(m_next < m_numbers.size() && m_numbers[m_next] == nr) {
+        return m_next++;
+      }
+      auto inserted = m_indices.insert(std::make_pair(nr, static_cast<int>(m_numbers.size())));
+      if(inserted.second) {
+        m_numbers.push_back(nr);
+      }
+      m_next = inserted.first->second + 1;
+      return inserted.first->second;
+    }
+
+    void push_back(int index, double v0, double v1, double v2)
+    {
+      m_rows.push_back(index);
+      m_values[0].push_back(v0);
+      m_values[1].push_back(v1);
+      m_values[2].push_back(v2);
+    }
+
+    void finish(std::vector<int>& numbers, std::vector<std::size_t>& offsets,
+      std::vector<double>& out0, std::vector<double>& out1, std::vector<double>& out2)
+    {
+      offsets.assign(m_numbers.size() + 1, 0);
+      for(int row : m_rows) {
+        ++offsets[row + 1];
+      }
+      for(std::size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i] += offsets[i - 1];
+      }
+      std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+      std::vector<double>* out[3] = {&out0, &out1, &out2};
+      for(int j = 0; j < 3; ++j) {
+        out[j]->resize(m_rows.size());
+      }
+      for(std::size_t i = 0; i < m_rows.size(); ++i) {
+        std::size_t k = next[m_rows[i]]++;
+        out0[k] = m_values[0][i];
+        out1[k] = m_values[1][i];
+        out2[k] = m_values[2][i];
+      }
+      numbers = m_numbers;
+    }
+
+  private:
+    std::vector<int> m_numbers;
+    std::unordered_map<int, int> m_indices;
+    std::size_t m_next = 0;
+    std::vector<int> m_rows;
+    std::vector<double> m_values[3];
+  };
+
+  std::vector<std::vector<double> > splitColumns(const std::vector<double>& values, const std::vector<std::size_t>& offsets)
+  {
+    std::vector<std::vector<double> > result;
+    for(std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+      result.emplace_back(values.begin() + offsets[i], values.begin() + offsets[i + 1]);
+    }
+    return result;
+  }
+
+} // namespace
+
 SimFile::SimFile(openstudio::path path)
 {
   m_hasLfr = false;
@@ -57,30 +225,60 @@ SimFile::SimFile(openstudio::path path)
   m_hasNfr = readNfr(openstudio::toString(nfrPath));
 }
 
-bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time)
+std::vector<std::vector<double> > SimFile::dP() const
+{
+  return splitColumns(m_dP, m_pathOffsets);
+}
+
+std::vector<std::vector<double> > SimFile::F0() const
+{
+  return splitColumns(m_F0, m_pathOffsets);
+}
+
+std::vector<std::vector<double> > SimFile::F1() const
+{
+  return splitColumns(m_F1, m_pathOffsets);
+}
+
+std::vector<std::vector<double> > SimFile::T() const
+{
+  return splitColumns(m_T, m_nodeOffsets);
+}
+
+std::vector<std::vector<double> > SimFile::P() const
+{
+  return splitColumns(m_P, m_nodeOffsets);
+}
+
+std::vector<std::vector<double> > SimFile::D() const
+{
+  return splitColumns(m_D, m_nodeOffsets);
+}
+
+bool SimFile::computeDateTimes(const std::vector<std::string_view>& day, const std::vector<std::string_view>& time)
 {
   int n = std::min((int)day.size(),(int)time.size());
   for(int i=0;i<n;i++)
   {
-    std::vector<std::string> split;
-    boost::split(split, day[i], boost::is_any_of("/"));
-    if(split.size() != 2)
+    std::string_view::size_type slash = day[i].find('/');
+    if(slash == std::string_view::npos || day[i].find('/', slash + 1) != std::string_view::npos)
     {
       return false;
     }
 
-    unsigned month;
-    unsigned dayOfMonth;
+    int month;
+    int dayOfMonth;
+    if(!fieldToInt(day[i].substr(0, slash), month) || !fieldToInt(day[i].substr(slash + 1), dayOfMonth))
+    {
+      return false;
+    }
+    // DLM: what about month == 0?
+    if (month < 0 || month > 12 || dayOfMonth < 0)
+    {
+      return false;
+    }
     try {
-      month = std::stoul(split[0]);
-      dayOfMonth = std::stoul(split[1]);
-      // DLM: what about month == 0?
-      if (month > 12)
-      {
-        return false;
-      }
-
-      m_dateTimes.push_back(DateTime(Date(monthOfYear(month), dayOfMonth), Time(time[i])));
+      m_dateTimes.push_back(DateTime(Date(monthOfYear(month), dayOfMonth), Time(std::string(time[i]))));
     }catch (const std::exception&){
       return false;
     }
@@ -90,6 +288,8 @@ bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::v
 
 void SimFile::clearLfr()
 {
+  m_pathNr.clear();
+  m_pathOffsets.clear();
   m_dP.clear();
   m_F0.clear();
   m_F1.clear();
@@ -98,119 +298,78 @@ void SimFile::clearLfr()
 bool SimFile::readLfr(const std::string& fileName)
 {
   clearLfr();
-  std::vector<std::string> day;
-  std::vector<std::string> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(!file.is_open())
+  std::string buffer;
+  if(!readFile(fileName, buffer))
   {
     LOG(Error,"Failed to open LFR file '" << fileName << "'");
     return false;
   }
-  std::map<int,int> nrMap;
+  std::string::size_type position = 0;
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  std::string header = headerstr;
-  if(header.empty())
+  std::string_view header;
+  if(!nextLine(buffer, position, header) || header.empty())
   {
     LOG(Error,"No data in LFR file '" << fileName << "'");
     return false;
   }
-  std::vector<std::string> row;
-  boost::split(row, header, boost::is_any_of("\t"));
-  unsigned ncols = 6;
-  if(row.size() != ncols)
+  const unsigned ncols = 6;
+  std::string_view row[ncols];
+  unsigned n = splitTabs(header, row, ncols);
+  if(n != ncols)
   {
-    LOG(Error,"LFR file has " << row.size() << " columns, not the expected " << ncols);
+    LOG(Error,"LFR file has " << n << " columns, not the expected " << ncols);
     return false;
   }
   // Read the data
-  while(file.good())
+  std::vector<std::string_view> day;
+  std::vector<std::string_view> time;
+  ResultColumns columns;
+  std::string_view line;
+  while(nextLine(buffer, position, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    std::string line = linestr;
-    std::vector<std::string> row;
-    boost::split(row, line, boost::is_any_of("\t"));
-    if(row.size() != ncols)
+    if(line.empty())
     {
-      clearLfr();
-      LOG(Error,"LFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
+      continue;
     }
-    if(time.size())
+    n = splitTabs(line, row, ncols);
+    if(n != ncols)
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
+      LOG(Error,"LFR data line has " << n << " columns, not the expected " << ncols);
+      return false;
     }
-    else
+    if(time.empty() || time.back() != row[1])
     {
       day.push_back(row[0]);
       time.push_back(row[1]);
     }
 
     int nr = 0;
-    try {
-      nr = std::stoi(row[2]);
-    }catch(const std::exception&){
-      clearLfr();
+    if(!fieldToInt(row[2], nr))
+    {
       LOG(Error,"Invalid link number '" << row[2] << "'");
       return false;
     }
-    if(nrMap.find(nr) == nrMap.end())
-    {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_dP.resize(sz+1);
-      m_F0.resize(sz+1);
-      m_F1.resize(sz+1);
-    }
     double dP = 0;
-    try {
-      dP = std::stod(row[3]);
-    }catch(const std::exception&){
-      clearLfr();
+    if(!fieldToDouble(row[3], dP))
+    {
       LOG(Error,"Invalid pressure difference '" << row[3] << "'");
       return false;
     }
-
     double F0 = 0;
-    try {
-      F0 = std::stod(row[4]);
-    } catch (const std::exception&) {
-      clearLfr();
+    if(!fieldToDouble(row[4], F0))
+    {
       LOG(Error,"Invalid flow 0 '" << row[4] << "'");
       return false;
     }
-
     double F1 = 0;
-    try {
-      F1 = std::stod(row[5]);
-    } catch (const std::exception&) {
-      clearLfr();
+    if(!fieldToDouble(row[5], F1))
+    {
       LOG(Error,"Invalid flow 1 '" << row[5] << "'");
       return false;
     }
-
-    m_dP[nrMap[nr]].push_back(dP);
-    m_F0[nrMap[nr]].push_back(F0);
-    m_F1[nrMap[nr]].push_back(F1);
-
-  }
-  // Unwind the zone number map;
-  std::vector<int> keys;
-  for (const auto& pair : nrMap) {
-    keys.push_back(pair.first);
+    columns.push_back(columns.index(nr), dP, F0, F1);
   }
-  m_pathNr.resize(keys.size());
-  for(std::vector<int>::size_type i=0; i < keys.size(); ++i)
-  {
-    m_pathNr[nrMap[keys[i]]] = keys[i];
-  }
-  file.close();
+  columns.finish(m_pathNr, m_pathOffsets, m_dP, m_F0, m_F1);
   // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
   if(!computeDateTimes(day,time))
   {
@@ -224,6 +383,8 @@ bool SimFile::readLfr(const std::string& fileName)
 
 void SimFile::clearNfr()
 {
+  m_nodeNr.clear();
+  m_nodeOffsets.clear();
   m_T.clear();
   m_P.clear();
   m_D.clear();
@@ -232,134 +393,92 @@ void SimFile::clearNfr()
 bool SimFile::readNfr(const std::string& fileName)
 {
   clearNfr();
-  std::vector<std::string> day;
-  std::vector<std::string> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
+  std::string buffer;
+  if(!readFile(fileName, buffer))
   {
     LOG(Error,"Failed to open NFR file '" << fileName << "'");
     return false;
   }
-
-  std::map<int,int> nrMap;
+  std::string::size_type position = 0;
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  std::string header = headerstr;
-  if(header.empty())
+  std::string_view header;
+  if(!nextLine(buffer, position, header) || header.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName << "'");
+    LOG(Error,"No data in NFR file '" << fileName << "'");
     return false;
   }
-  std::vector<std::string> row;
-  boost::split(row, header, boost::is_any_of("\t"));
-  unsigned ncols = 6;
-  if(row.size() != ncols && row.size() != ncols+2)
+  const unsigned ncols = 6;
+  std::string_view row[ncols + 2];
+  unsigned n = splitTabs(header, row, ncols + 2);
+  if(n != ncols && n != ncols+2)
   {
-    LOG(Error,"NFR file has " << row.size() << " columns, not the expected " << ncols);
+    LOG(Error,"NFR file has " << n << " columns, not the expected " << ncols);
     return false;
   }
   // Read the data
-  while(file.good())
+  std::vector<std::string_view> day;
+  std::vector<std::string_view> time;
+  ResultColumns columns;
+  std::string_view line;
+  while(nextLine(buffer, position, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    std::string line = linestr;
-
-    std::vector<std::string> row;
-    boost::split(row, line, boost::is_any_of("\t"));
-    if(row.size() != ncols && row.size() != ncols+2)
+    if(line.empty())
     {
-      clearNfr();
-      LOG(Error,"NFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
+      continue;
     }
-    if(time.size())
+    n = splitTabs(line, row, ncols + 2);
+    if(n != ncols && n != ncols+2)
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
+      LOG(Error,"NFR data line has " << n << " columns, not the expected " << ncols);
+      return false;
     }
-    else
+    if(time.empty() || time.back() != row[1])
     {
       day.push_back(row[0]);
       time.push_back(row[1]);
     }
 
     int nr = 0;
-    try {
-      nr = std::stoi(row[2]);
-    } catch(const std::exception&){
-      clearNfr();
+    if(!fieldToInt(row[2], nr))
+    {
       LOG(Error,"Invalid node number '" << row[2] << "'");
       return false;
     }
-    if(nrMap.find(nr) == nrMap.end())
-    {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_T.resize(sz+1);
-      m_P.resize(sz+1);
-      m_D.resize(sz+1);
-    }
     double T = 0;
-    try {
-      T = std::stod(row[3]);
-    }catch(const std::exception&){
-      clearNfr();
+    if(!fieldToDouble(row[3], T))
+    {
       LOG(Error,"Invalid temperature '" << row[3] << "'");
       return false;
     }
-
     double P = 0;
-    try {
-      P = std::stod(row[4]);
-    } catch (const std::exception&) {
-      clearNfr();
+    if(!fieldToDouble(row[4], P))
+    {
       LOG(Error,"Invalid pressure '" << row[4] << "'");
       return false;
     }
-
     double D = 0;
-    try {
-      D = std::stod(row[5]);
-    } catch (const std::exception&) {
+    if(!fieldToDouble(row[5], D))
+    {
       if(nr==0)
       {
         D=0.0;
       }
       else
       {
-        clearNfr();
         LOG(Error,"Invalid density '" << row[5] << "'");
         return false;
       }
     }
-    m_T[nrMap[nr]].push_back(T);
-    m_P[nrMap[nr]].push_back(P);
-    m_D[nrMap[nr]].push_back(D);
-
-  }
-  // Unwind the zone number map;
-  std::vector<int> keys;
-  for (const auto& pair : nrMap) {
-    keys.push_back(pair.first);
+    columns.push_back(columns.index(nr), T, P, D);
   }
-  m_nodeNr.resize(keys.size());
-  for(std::vector<int>::size_type i=0; i < keys.size(); ++i)
-  {
-    m_nodeNr[nrMap[keys[i]]] = keys[i];
-  }
-  file.close();
+  columns.finish(m_nodeNr, m_nodeOffsets, m_T, m_P, m_D);
   // Something should probably be done here to make sure that the times here match up with what we
   // already have. For now, if nothing is known about the dates, then try to compute it
   if(m_dateTimes.size() == 0)
   {
     if(!computeDateTimes(day,time))
     {
-      clearLfr();
+      clearNfr();
       m_dateTimes.clear();
       LOG(Error,"Failed to compute date and time objects from NFR input");
       return false;
@@ -368,17 +487,23 @@ bool SimFile::readNfr(const std::string& fileName)
   return true;
 }
 
-static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes,
-                                          std::vector<double> inputValues, std::string units)
+static openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& inputDateTimes,
+                                          const double* inputValues, std::size_t n, std::string units)
 {
   // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
+  n = std::min(n, inputDateTimes.size());
+  if(n==1) // Account for steady simulation results
+  {
+    return openstudio::TimeSeries(inputDateTimes,createVector(std::vector<double>(inputValues, inputValues + 1)),units);
+  }
   std::vector<openstudio::DateTime> dateTimes;
   std::vector<double> values;
-  if(inputDateTimes.size()==1) // Account for steady simulation results
+  if(n > 1)
   {
-    return openstudio::TimeSeries(inputDateTimes,createVector(inputValues),units);
+    dateTimes.reserve(n-1);
+    values.reserve(n-1);
   }
-  for(unsigned i=1;i<inputDateTimes.size();i++)
+  for(std::size_t i=1;i<n;i++)
   {
     dateTimes.push_back(inputDateTimes[i]);
     values.push_back(0.5*(inputValues[i-1]+inputValues[i]));
@@ -386,38 +511,41 @@ static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inpu
   return openstudio::TimeSeries(dateTimes,createVector(values),units);
 }
 
-
-boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
+boost::optional<openstudio::TimeSeries> SimFile::pathSeries(int nr, const std::vector<double>& values, const std::string& units) const
 {
   int index = indexOf(m_pathNr, nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_dP[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  std::size_t offset = m_pathOffsets[index];
+  return convertData(m_dateTimes, values.data() + offset, m_pathOffsets[index + 1] - offset, units);
 }
 
-boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
+boost::optional<openstudio::TimeSeries> SimFile::nodeSeries(int nr, const std::vector<double>& values, const std::string& units) const
 {
-  int index = indexOf(m_pathNr, nr);
+  int index = indexOf(m_nodeNr, nr);
   if(index == -1)
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F0[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  std::size_t offset = m_nodeOffsets[index];
+  return convertData(m_dateTimes, values.data() + offset, m_nodeOffsets[index + 1] - offset, units);
+}
+
+boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
+{
+  return pathSeries(nr, m_dP, "Pa");
+}
+
+boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
+{
+  return pathSeries(nr, m_F0, "kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const
 {
-  int index = indexOf(m_pathNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F1[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return pathSeries(nr, m_F1, "kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
@@ -427,47 +555,29 @@ boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  std::vector<double> flow(m_dateTimes.size());
-  for(unsigned i=0;i<m_dateTimes.size();i++)
+  std::size_t offset = m_pathOffsets[index];
+  std::vector<double> flow(m_pathOffsets[index + 1] - offset);
+  for(std::size_t i=0;i<flow.size();i++)
   {
-    flow[i] = m_F0[index][i] + m_F1[index][i];
+    flow[i] = m_F0[offset + i] + m_F1[offset + i];
   }
   // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-  openstudio::TimeSeries series = convertData(m_dateTimes,flow,"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return convertData(m_dateTimes, flow.data(), flow.size(), "kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_T[index],"K");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, m_T, "K");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_P[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, m_P, "Pa");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_D[index],"kg/m^3");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, m_D, "kg/m^3");
 }
 
 std::vector<openstudio::DateTime> SimFile::dateTimes() const
@@ -37,6 +37,8 @@
 
 #include "../AirflowAPI.hpp"
 
+#include <string_view>
+
 namespace openstudio {
 namespace contam {
 
@@ -45,31 +47,12 @@ public:
   explicit SimFile(openstudio::path path);
 
   // These are provided for advanced use
-  std::vector<std::vector<double> > dP() const
-  {
-    return m_dP;
-  }
-  std::vector<std::vector<double> > F0() const
-  {
-    return m_F0;
-  }
-  std::vector<std::vector<double> > F1() const
-  {
-    return m_F1;
-  }
-  std::vector<std::vector<double> > T() const
-  {
-    return m_T;
-  }
-  std::vector<std::vector<double> > P() const
-  {
-    return m_P;
-  }
-  std::vector<std::vector<double> > D() const
-  {
-    return m_D;
-  }
-
+  std::vector<std::vector<double> > dP() const;
+  std::vector<std::vector<double> > F0() const;
+  std::vector<std::vector<double> > F1() const;
+  std::vector<std::vector<double> > T() const;
+  std::vector<std::vector<double> > P() const;
+  std::vector<std::vector<double> > D() const;
 
   // Most use should be confined to these
   boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
@@ -96,16 +79,22 @@ private:
   bool readLfr(const std::string& fileName);
   void clearNfr();
   bool readNfr(const std::string& fileName);
-  bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
+  bool computeDateTimes(const std::vector<std::string_view>& day, const std::vector<std::string_view>& time);
+  boost::optional<openstudio::TimeSeries> pathSeries(int nr, const std::vector<double>& values, const std::string& units) const;
+  boost::optional<openstudio::TimeSeries> nodeSeries(int nr, const std::vector<double>& values, const std::string& units) const;
 
+  // Each result is stored in a single array in which the values for a path (or node) are contiguous,
+  // the values for path index i are in [m_pathOffsets[i], m_pathOffsets[i+1])
   std::vector<int> m_pathNr;  // the CONTAM path index
-  std::vector<std::vector<double> > m_dP;
-  std::vector<std::vector<double> > m_F0;
-  std::vector<std::vector<double> > m_F1;
+  std::vector<std::size_t> m_pathOffsets;
+  std::vector<double> m_dP;
+  std::vector<double> m_F0;
+  std::vector<double> m_F1;
   std::vector<int> m_nodeNr;  // the CONTAM node index
-  std::vector<std::vector<double> > m_T;
-  std::vector<std::vector<double> > m_P;
-  std::vector<std::vector<double> > m_D;
+  std::vector<std::size_t> m_nodeOffsets;
+  std::vector<double> m_T;
+  std::vector<double> m_P;
+  std::vector<double> m_D;
   std::vector<openstudio::DateTime> m_dateTimes;
 
   bool m_hasLfr;
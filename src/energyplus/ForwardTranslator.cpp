@@ -632,7 +632,7 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   workspace.removeObject(vo->handle());
 
   workspace.setFastNaming(true);
-  workspace.addObjects(m_idfObjects);
+  workspace.addObjectsBulk(m_idfObjects);
   workspace.setFastNaming(false);
   OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
 
@@ -88,6 +88,7 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <chrono>
 #include <future>
 
 #include <resources.hxx>
@@ -96,6 +97,10 @@
 
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
 using namespace openstudio;
@@ -761,3 +766,54 @@ TEST_F(EnergyPlusFixture, BadVariableName)
     EXPECT_TRUE(s == "Good Name" || s == "Bad, !Name") << s;
   }
 }
+
+// peak resident set size of this process in MB, 0 if unknown
+static double peakMemoryMB() {
+#ifndef _WIN32
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+  }
+#endif
+  return 0.0;
+}
+
+// Benchmark of the model clone and translation of a large model, run with
+// --gtest_also_run_disabled_tests --gtest_filter=EnergyPlusFixture.DISABLED_ForwardTranslator_LargeModel_Benchmark
+TEST_F(EnergyPlusFixture, DISABLED_ForwardTranslator_LargeModel_Benchmark) {
+  // copies of each space in the example model, side by side along the x axis
+  Model model = exampleModel();
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  for (unsigned i = 1; i <= 200; ++i) {
+    for (const Space& space : spaces) {
+      Space copy = space.clone(model).cast<Space>();
+      copy.setXOrigin(space.xOrigin() + 100.0*i);
+      if (boost::optional<ThermalZone> thermalZone = space.thermalZone()) {
+        copy.setThermalZone(*thermalZone);
+      }
+    }
+  }
+  double modelMB = peakMemoryMB();
+
+  // the copy translateModel makes
+  auto start = std::chrono::steady_clock::now();
+  Model modelCopy = model.clone(true).cast<Model>();
+  std::chrono::duration<double> cloneTime = std::chrono::steady_clock::now() - start;
+  double cloneMB = peakMemoryMB();
+  EXPECT_EQ(model.numObjects(), modelCopy.numObjects());
+
+  ForwardTranslator ft;
+  start = std::chrono::steady_clock::now();
+  Workspace workspace = ft.translateModel(model);
+  std::chrono::duration<double> translateTime = std::chrono::steady_clock::now() - start;
+  double translateMB = peakMemoryMB();
+  EXPECT_FALSE(workspace.objects().empty());
+
+  std::cout << model.numObjects() << " objects, peak RSS " << modelMB << " MB" << std::endl
+            << "clone " << cloneTime.count() << " s, peak RSS " << cloneMB << " MB" << std::endl
+            << "translateModel " << translateTime.count() << " s, peak RSS " << translateMB << " MB" << std::endl;
+}
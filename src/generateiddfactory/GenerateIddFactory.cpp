@@ -100,8 +100,11 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "#include <utilities/core/Singleton.hpp>" << std::endl
     << "#include <utilities/core/Compare.hpp>" << std::endl
     << "#include <utilities/core/Logger.hpp>" << std::endl
+    << "#include <utilities/core/Path.hpp>" << std::endl
     << std::endl
+    << "#include <future>" << std::endl
     << "#include <map>" << std::endl
+    << "#include <mutex>" << std::endl
     << std::endl
     << "namespace openstudio{" << std::endl
     << std::endl
@@ -192,6 +195,20 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "   *  in all other cases. */" << std::endl
     << "  boost::optional<IddFile> getIddFile(IddFileType fileType, const VersionString& version) const;" << std::endl
     << std::endl
+    << "  /** Loads all of the previous version IddFiles that getIddFile(fileType,version) can return, " << std::endl
+    << "   *  using up to numThreads threads (one per processor if numThreads == 0), so that later calls " << std::endl
+    << "   *  do not have to wait on parsing. getIddFile may be called from any thread; each IddFile is " << std::endl
+    << "   *  only loaded once. */" << std::endl
+    << "  void preloadIddFiles(IddFileType fileType, unsigned numThreads = 0) const;" << std::endl
+    << std::endl
+    << "  /** Returns the folder in which previous version IddFiles are cached, if any. */" << std::endl
+    << "  openstudio::path iddCacheDirectory() const;" << std::endl
+    << std::endl
+    << "  /** Sets a folder in which previous version IddFiles are cached on disk (see " << std::endl
+    << "   *  IddFile::loadCached), so that other processes need not parse them again. The default, an " << std::endl
+    << "   *  empty path, turns the cache off. Only affects IddFiles that have not been loaded yet. */" << std::endl
+    << "  void setIddCacheDirectory(const openstudio::path& cacheDirectory);" << std::endl
+    << std::endl
     << "  //@}" << std::endl
     << "  /** @name Queries */" << std::endl
     << "  //@{" << std::endl
@@ -220,7 +237,13 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "  typedef std::multimap<IddObjectType,IddFileType> IddObjectSourceFileMap;" << std::endl
     << "  IddObjectSourceFileMap m_sourceFileMap;" << std::endl
     << std::endl
-    << "  mutable std::map<VersionString,IddFile> m_osIddFiles;" << std::endl
+    << "  static boost::optional<IddFile> loadPreviousIddFile(const VersionString& version," << std::endl
+    << "                                                      const openstudio::path& cacheDirectory);" << std::endl
+    << std::endl
+    << "  // previous version files, loaded by the first thread to ask for them" << std::endl
+    << "  mutable std::mutex m_osIddFilesMutex;" << std::endl
+    << "  mutable std::map<VersionString,std::shared_future<boost::optional<IddFile> > > m_osIddFiles;" << std::endl
+    << "  openstudio::path m_iddCacheDirectory;" << std::endl
     << "};" << std::endl
     << std::endl
     << "#if _WIN32 || _MSC_VER" << std::endl
@@ -250,8 +273,12 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "#include <utilities/core/Assert.hpp>" << std::endl
     << "#include <utilities/core/Compare.hpp>" << std::endl
     << "#include <utilities/core/Containers.hpp>" << std::endl
+    << "#include <utilities/core/System.hpp>" << std::endl
     << "#include <utilities/embedded_files.hxx>" << std::endl
     << std::endl
+    << "#include <atomic>" << std::endl
+    << "#include <thread>" << std::endl
+    << std::endl
     << "#include <OpenStudio.hxx>" << std::endl
     << std::endl
     << "namespace openstudio {" << std::endl
@@ -772,22 +799,121 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "  if (version == currentVersion) {" << std::endl
     << "    return getIddFile(fileType);" << std::endl
     << "  }" << std::endl
-    << "  else {" << std::endl
-    << "    std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << std::endl
+    << std::endl
+    << "  std::promise<OptionalIddFile> promise;" << std::endl
+    << "  std::shared_future<OptionalIddFile> future;" << std::endl
+    << "  openstudio::path cacheDirectory;" << std::endl
+    << "  bool load = false;" << std::endl
+    << "  {" << std::endl
+    << "    std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
+    << "    auto it = m_osIddFiles.find(version);" << std::endl
     << "    if (it != m_osIddFiles.end()) {" << std::endl
-    << "      return it->second;" << std::endl
+    << "      future = it->second;" << std::endl
+    << "    }" << std::endl
+    << "    else {" << std::endl
+    << "      future = promise.get_future().share();" << std::endl
+    << "      m_osIddFiles[version] = future;" << std::endl
+    << "      cacheDirectory = m_iddCacheDirectory;" << std::endl
+    << "      load = true;" << std::endl
+    << "    }" << std::endl
+    << "  }" << std::endl
+    << std::endl
+    << "  // parse outside of the lock, other threads asking for this version wait on the future" << std::endl
+    << "  if (load) {" << std::endl
+    << "    OptionalIddFile loaded;" << std::endl
+    << "    try {" << std::endl
+    << "      loaded = loadPreviousIddFile(version,cacheDirectory);" << std::endl
+    << "      promise.set_value(loaded);" << std::endl
     << "    }" << std::endl
-    << "    std::string iddPath = \":/idd/versions\";" << std::endl
-    << "    std::stringstream folderString;" << std::endl
-    << "    folderString << version.major() << \"_\" << version.minor() << \"_\" << version.patch().get();" << std::endl
-    << "    iddPath += \"/\" + folderString.str() + \"/OpenStudio.idd\";" << std::endl
-    << "    if (::openstudio::embedded_files::hasFile(iddPath) && (version < currentVersion)) {" << std::endl
-    << "      std::stringstream ss;" << std::endl
-    << "      ss << ::openstudio::embedded_files::getFileAsString(iddPath);" << std::endl
+    << "    catch (...) {" << std::endl
+    << "      promise.set_exception(std::current_exception());" << std::endl
+    << "    }" << std::endl
+    << "    // do not keep a failed load, so that the next call tries again" << std::endl
+    << "    if (!loaded) {" << std::endl
+    << "      std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
+    << "      m_osIddFiles.erase(version);" << std::endl
+    << "    }" << std::endl
+    << "  }" << std::endl
+    << "  return future.get();" << std::endl
+    << "}" << std::endl
+    << std::endl
+    << "void IddFactorySingleton::preloadIddFiles(IddFileType fileType, unsigned numThreads) const {" << std::endl
+    << "  if (fileType != IddFileType::OpenStudio) {" << std::endl
+    << "    LOG(Warn,\"At this time, OpenStudio can only preload OpenStudio IDD files.\");" << std::endl
+    << "    return;" << std::endl
+    << "  }" << std::endl
+    << std::endl
+    << "  VersionString currentVersion(openStudioVersion());" << std::endl
+    << "  std::vector<VersionString> versions;" << std::endl
+    << "  boost::regex versionPath(\":/idd/versions/(\\\\d+)_(\\\\d+)_(\\\\d+)/OpenStudio.idd\");" << std::endl
+    << "  for (const std::string& fileName : ::openstudio::embedded_files::fileNames()) {" << std::endl
+    << "    boost::smatch matches;" << std::endl
+    << "    if (boost::regex_match(fileName,matches,versionPath)) {" << std::endl
+    << "      VersionString version(std::string(matches[1]) + \".\" + std::string(matches[2]) + \".\" + std::string(matches[3]));" << std::endl
+    << "      if (version < currentVersion) {" << std::endl
+    << "        versions.push_back(version);" << std::endl
+    << "      }" << std::endl
+    << "    }" << std::endl
+    << "  }" << std::endl
+    << std::endl
+    << "  if (numThreads == 0) {" << std::endl
+    << "    numThreads = System::numberOfProcessors();" << std::endl
+    << "  }" << std::endl
+    << "  std::atomic<std::size_t> next(0);" << std::endl
+    << "  auto work = [&]() {" << std::endl
+    << "    std::size_t i;" << std::endl
+    << "    while ((i = next++) < versions.size()) {" << std::endl
+    << "      try {" << std::endl
+    << "        getIddFile(fileType,versions[i]);" << std::endl
+    << "      }" << std::endl
+    << "      catch (const std::exception& e) {" << std::endl
+    << "        LOG(Error,\"Unable to load the IddFile for version \" << versions[i].str() << \": \" << e.what());" << std::endl
+    << "      }" << std::endl
+    << "    }" << std::endl
+    << "  };" << std::endl
+    << "  std::vector<std::thread> workers;" << std::endl
+    << "  for (unsigned i = 1; (i < numThreads) && (i < versions.size()); ++i) {" << std::endl
+    << "    workers.emplace_back(work);" << std::endl
+    << "  }" << std::endl
+    << "  work();" << std::endl
+    << "  for (std::thread& worker : workers) {" << std::endl
+    << "    worker.join();" << std::endl
+    << "  }" << std::endl
+    << "}" << std::endl
+    << std::endl
+    << "openstudio::path IddFactorySingleton::iddCacheDirectory() const {" << std::endl
+    << "  std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
+    << "  return m_iddCacheDirectory;" << std::endl
+    << "}" << std::endl
+    << std::endl
+    << "void IddFactorySingleton::setIddCacheDirectory(const openstudio::path& cacheDirectory) {" << std::endl
+    << "  std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
+    << "  m_iddCacheDirectory = cacheDirectory;" << std::endl
+    << "}" << std::endl
+    << std::endl
+    << "boost::optional<IddFile> IddFactorySingleton::loadPreviousIddFile(const VersionString& version," << std::endl
+    << "                                                                 const openstudio::path& cacheDirectory)" << std::endl
+    << "{" << std::endl
+    << "  OptionalIddFile result;" << std::endl
+    << "  std::string iddPath = \":/idd/versions\";" << std::endl
+    << "  std::stringstream folderString;" << std::endl
+    << "  folderString << version.major() << \"_\" << version.minor() << \"_\" << version.patch().get();" << std::endl
+    << "  iddPath += \"/\" + folderString.str() + \"/OpenStudio.idd\";" << std::endl
+    << "  if (::openstudio::embedded_files::hasFile(iddPath) && (version < VersionString(openStudioVersion()))) {" << std::endl
+    << "    std::string text = ::openstudio::embedded_files::getFileAsString(iddPath);" << std::endl
+    << "    if (cacheDirectory.empty()) {" << std::endl
+    << "      std::stringstream ss(text);" << std::endl
     << "      result = IddFile::load(ss);" << std::endl
     << "    }" << std::endl
-    << "    if (result) {" << std::endl
-    << "      m_osIddFiles[version] = *result;" << std::endl
+    << "    else {" << std::endl
+    << "      result = IddFile::loadCached(text,cacheDirectory);" << std::endl
+    << "    }" << std::endl
+    << "  }" << std::endl
+    << "  if (result) {" << std::endl
+    << "    // fill in the lazily computed members before the file is shared between threads" << std::endl
+    << "    result->versionObject();" << std::endl
+    << "    for (const IddObject& object : result->objects()) {" << std::endl
+    << "      object.hasNameField();" << std::endl
     << "    }" << std::endl
     << "  }" << std::endl
     << "  return result;" << std::endl
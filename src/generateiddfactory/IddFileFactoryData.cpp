@@ -31,6 +31,7 @@
 #include "WriteEnums.hpp"
 
 #include "../utilities/idd/IddRegex.hpp"
+#include "../utilities/idd/CompiledIddObject.hpp"
 
 #include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
@@ -191,17 +192,8 @@ void IddFileFactoryData::parseFile(const path& outPath,
     objectName.first = m_convertName(objectName.second);
     m_objectNames.push_back(objectName);
 
-    // start writing create function
-    cxxFile->tempFile
-      << std::endl
-      << "IddObject create" << objectName.first << "IddObject() {" << std::endl
-      << std::endl
-      << "  static const IddObject object = []{" << std::endl
-      << std::endl
-      << "    // Rely on C++11 static initialization and Initialize on First Use Idiom" << std::endl
-      << "    // to make sure all statics are initialized properly, thread safely" << std::endl
-      << "    std::stringstream ss;" << std::endl
-      << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+    // start collecting the object text, which is compiled into tables once the object is complete
+    std::string objectText = trimLine + "\n";
 
     // start collecting field names
     // (requires \field tag, which is expected to occur one per line)
@@ -212,22 +204,8 @@ void IddFileFactoryData::parseFile(const path& outPath,
     while (std::getline(iddFile,line)) {
       ++lineNum; trimLine = line; boost::trim(trimLine);
       if (trimLine.empty()) {
-        // finish writing create function
-        cxxFile->tempFile
-          << std::endl
-          << std::endl
-          << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << std::endl
-          << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << std::endl
-          << "                                             \"" << group << "\"," << std::endl
-          << "                                             ss.str()," << std::endl
-          << "                                             objType);" << std::endl
-          << "    OS_ASSERT(oObj);" << std::endl
-          << "    return *oObj;" << std::endl
-          << "  }(); // immediately invoked lambda" << std::endl
-          << std::endl
-          << "  OS_ASSERT(object.type() == IddObjectType::" << objectName.first << ");" << std::endl
-          << "  return object;" << std::endl
-          << "}" << std::endl;
+        // write create function
+        m_writeCreateFunction(cxxFile->tempFile,objectName,group,objectText);
 
         // write field enums
         if (!fieldNames.empty() || !extensibleFieldNames.empty()) {
@@ -318,10 +296,8 @@ void IddFileFactoryData::parseFile(const path& outPath,
         break;
       }
 
-      // continue writing create function
-      cxxFile->tempFile
-        << std::endl
-        << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+      // continue collecting the object text
+      objectText += trimLine + "\n";
 
       // look for field name
       std::string fieldName;
@@ -421,6 +397,85 @@ std::string IddFileFactoryData::m_convertName(const std::string& originalName) c
   return result;
 }
 
+void IddFileFactoryData::m_writeCreateFunction(std::ostream& os,
+                                               const StringPair& objectName,
+                                               const std::string& group,
+                                               const std::string& objectText) const
+{
+  detail::CompiledIddObject compiled = detail::CompiledIddObject::compile(objectName.second,group,objectText);
+  const std::vector<detail::CompiledIddField>& fields = compiled.fields;
+
+  // all properties go in one table, the object's first and then each field's in turn
+  std::vector<std::string> properties(compiled.properties);
+  std::vector<unsigned> fieldPropertiesBegin;
+  for (const detail::CompiledIddField& field : fields) {
+    fieldPropertiesBegin.push_back(properties.size());
+    properties.insert(properties.end(),field.properties.begin(),field.properties.end());
+  }
+
+  os << std::endl
+     << "IddObject create" << objectName.first << "IddObject() {" << std::endl
+     << std::endl
+     << "  static const IddObject object = []{" << std::endl
+     << std::endl
+     << "    // Rely on C++11 static initialization and Initialize on First Use Idiom" << std::endl
+     << "    // to make sure all statics are initialized properly, thread safely" << std::endl;
+
+  if (!properties.empty()) {
+    os << "    static constexpr const char* properties[] = {" << std::endl;
+    for (const std::string& property : properties) {
+      os << "      \"" << m_escapeForOutput(property) << "\"," << std::endl;
+    }
+    os << "    };" << std::endl;
+  }
+
+  if (!fields.empty()) {
+    os << "    static constexpr IddFieldTable fields[] = {" << std::endl;
+    for (unsigned i = 0, n = fields.size(); i < n; ++i) {
+      os << "      {\"" << m_escapeForOutput(fields[i].name) << "\", \"" << fields[i].fieldId << "\", ";
+      if (properties.empty()) {
+        os << "nullptr";
+      }
+      else {
+        os << "properties + " << fieldPropertiesBegin[i];
+      }
+      os << ", " << fields[i].properties.size() << "}," << std::endl;
+    }
+    os << "    };" << std::endl;
+  }
+
+  os << std::endl
+     << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << std::endl
+     << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << std::endl
+     << "                                             \"" << group << "\"," << std::endl
+     << "                                             IddObjectTable{"
+     << (properties.empty() ? "nullptr" : "properties") << ", " << compiled.properties.size() << ", "
+     << (fields.empty() ? "nullptr" : "fields") << ", " << fields.size() << "}," << std::endl
+     << "                                             objType);" << std::endl
+     << "    OS_ASSERT(oObj);" << std::endl
+     << "    return *oObj;" << std::endl
+     << "  }(); // immediately invoked lambda" << std::endl
+     << std::endl
+     << "  OS_ASSERT(object.type() == IddObjectType::" << objectName.first << ");" << std::endl
+     << "  return object;" << std::endl
+     << "}" << std::endl;
+}
+
+std::string IddFileFactoryData::m_escapeForOutput(const std::string& text) const {
+  std::string result;
+  for (char c : text) {
+    switch (c) {
+      case '\\' : result += "\\\\"; break;
+      case '"' : result += "\\\""; break;
+      case '\n' : result += "\\n"; break;
+      case '\r' : result += "\\r"; break;
+      case '\t' : result += "\\t"; break;
+      default : result += c;
+    }
+  }
+  return result;
+}
+
 std::string IddFileFactoryData::m_readyLineForOutput(const std::string& line) const {
   std::string result(line);
   result = boost::regex_replace(result,boost::regex("\\\\"),"\\\\\\\\");
@@ -34,6 +34,8 @@
 #include "GenerateIddFactoryOutFiles.hpp"
 
 
+#include <ostream>
+#include <string>
 #include <vector>
 
 namespace openstudio {
@@ -78,6 +80,13 @@ class IddFileFactoryData {
 
   std::string m_convertName(const std::string& originalName) const;
   std::string m_readyLineForOutput(const std::string& line) const;
+  std::string m_escapeForOutput(const std::string& text) const;
+
+  // writes the create function for an object, with its text compiled into an IddObjectTable
+  void m_writeCreateFunction(std::ostream& os,
+                             const StringPair& objectName,
+                             const std::string& group,
+                             const std::string& objectText) const;
 };
 
 typedef std::vector<IddFileFactoryData> IddFileFactoryDataVector;
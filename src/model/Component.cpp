@@ -182,9 +182,9 @@ namespace detail {
       << "valid.)");
   }
 
-  bool Component_Impl::save(const openstudio::path& p, bool overwrite) {
+  bool Component_Impl::save(const openstudio::path& p, bool overwrite, bool atomic) {
     return openstudio::detail::Workspace_Impl::save(
-        setFileExtension(p,componentFileExtension(),true,true),overwrite);
+        setFileExtension(p,componentFileExtension(),true,true),overwrite,atomic);
   }
 
 } // detail
@@ -265,8 +265,8 @@ ModelObject Component::primaryObject() const {
   return getImpl<detail::Component_Impl>()->primaryObject();
 }
 
-bool Component::save(const openstudio::path& p, bool overwrite) {
-  return getImpl<detail::Component_Impl>()->save(p,overwrite);
+bool Component::save(const openstudio::path& p, bool overwrite, bool atomic) {
+  return getImpl<detail::Component_Impl>()->save(p,overwrite,atomic);
 }
 
 /// @cond
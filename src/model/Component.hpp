@@ -86,8 +86,9 @@ class MODEL_API Component : public Model {
 
   /** Save Component to path p. Will construct the parent folder if its parent folder exists.
    *  An existing file will only be overwritten if if overwrite==true. If no extension is provided,
-   *  componentFileExtension() will be used. */
-  virtual bool save(const openstudio::path& p, bool overwrite=false);
+   *  componentFileExtension() will be used. If atomic==true, writes to a temporary file that
+   *  then replaces the file at p. */
+  virtual bool save(const openstudio::path& p, bool overwrite=false, bool atomic=false);
 
   //@}
  protected:
@@ -141,7 +141,7 @@ namespace detail {
     /** Save Component to path. Will construct parent folder, but no further up the chain. Will
      *  only overwrite an existing file if overwrite==true. Will set extension to
      *  componentFileExtension(). */
-    virtual bool save(const openstudio::path& p, bool overwrite=false) override;
+    virtual bool save(const openstudio::path& p, bool overwrite=false, bool atomic=false) override;
 
     //@}
 
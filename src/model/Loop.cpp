@@ -50,11 +50,18 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace openstudio {
 
 namespace model {
@@ -224,90 +231,241 @@ namespace detail {
     return result;
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
+  // Adjacency list of the components of a loop. HVACComponent_Impl::edges depends on the component
+  // visited before, so the successors of a component are kept for each previous component. Edges
+  // are only asked of the workspace the first time they are needed.
+  struct LoopTopology
   {
-    boost::optional<HVACComponent> prev;
-    if( visited.size() >= 2u ) prev = visited.rbegin()[1];
+    unsigned long long revision = 0;
+    std::vector<HVACComponent> components;
+    std::vector<IddObjectType> types;
+    std::unordered_map<Handle, unsigned, boost::hash<boost::uuids::uuid> > indices;
+    std::unordered_map<std::uint64_t, std::vector<unsigned> > edges;
+    // components between a source and a sink, keyed like edges
+    std::unordered_map<std::uint64_t, std::vector<unsigned> > paths;
+
+    static std::uint64_t key(unsigned index, unsigned prev) {
+      return (static_cast<std::uint64_t>(index) << 32) | prev;
+    }
+
+    unsigned index(const HVACComponent& component) {
+      auto inserted = indices.emplace(component.handle(), static_cast<unsigned>(components.size()));
+      if( inserted.second ) {
+        components.push_back(component);
+        types.push_back(component.iddObjectType());
+      }
+      return inserted.first->second;
+    }
+
+    // prev is one plus the index of the previous component, or zero if there is none
+    const std::vector<unsigned>& successors(unsigned index, unsigned prev) {
+      auto it = edges.find(key(index,prev));
+      if( it == edges.end() ) {
+        boost::optional<HVACComponent> prevComp;
+        if( prev ) { prevComp = components[prev - 1]; }
+        std::vector<HVACComponent> comps = components[index].getImpl<HVACComponent_Impl>()->edges(prevComp);
+        std::vector<unsigned> next;
+        next.reserve(comps.size());
+        for( const auto & comp : comps ) {
+          next.push_back(this->index(comp));
+        }
+        it = edges.emplace(key(index,prev), std::move(next)).first;
+      }
+      return it->second;
+    }
+  };
 
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
+  // Depth first search for the components on any path between source and sink, in the order the
+  // paths are found. A path never visits a component twice, and the sink is never passed through.
+  // When no component can be reached twice from the source, the components on the paths from a
+  // component only depend on how it was entered, so each (component, previous component) state is
+  // explored once and the search is linear in the number of edges. Otherwise all paths are walked.
+  class LoopPathSearch
+  {
+   public:
 
-    for(const auto & node : nodes)
+    LoopPathSearch(LoopTopology& topology, unsigned source, unsigned sink)
+      : m_topology(topology),
+        m_sink(sink),
+        m_memoize(isAcyclic(source))
     {
-      // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
-      {
-        continue;
+      m_onPath.assign(m_topology.components.size(), false);
+      m_found.assign(m_topology.components.size(), false);
+      push(source);
+      visit(source, 0);
+    }
+
+    const std::vector<unsigned>& result() const {
+      return m_result;
+    }
+
+   private:
+
+    // Walks every state reachable from source, caching its edges, and checks that the components
+    // reached form no cycle.
+    bool isAcyclic(unsigned source) {
+      std::vector<std::vector<unsigned> > adjacent;
+      std::unordered_set<std::uint64_t> seen;
+      std::vector<std::pair<unsigned, unsigned> > stack{{source, 0u}};
+      seen.insert(LoopTopology::key(source, 0u));
+      while( !stack.empty() ) {
+        auto state = stack.back();
+        stack.pop_back();
+        const std::vector<unsigned>& next = m_topology.successors(state.first, state.second);
+        if( adjacent.size() < m_topology.components.size() ) {
+          adjacent.resize(m_topology.components.size());
+        }
+        for( unsigned n : next ) {
+          adjacent[state.first].push_back(n);
+          if( (n != m_sink) && seen.insert(LoopTopology::key(n, state.first + 1)).second ) {
+            stack.emplace_back(n, state.first + 1);
+          }
+        }
       }
-      if( node == sink )
-      {
-        visited.push_back(node);
-        // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
+      adjacent.resize(m_topology.components.size());
+
+      // 0 unvisited, 1 on the current path, 2 done
+      std::vector<char> color(adjacent.size(), 0);
+      std::vector<std::pair<unsigned, std::size_t> > path{{source, 0u}};
+      color[source] = 1;
+      while( !path.empty() ) {
+        auto & top = path.back();
+        if( top.second < adjacent[top.first].size() ) {
+          unsigned n = adjacent[top.first][top.second++];
+          if( color[n] == 1 ) {
+            return false;
+          }
+          if( (color[n] == 0) && (n != m_sink) ) {
+            color[n] = 1;
+            path.emplace_back(n, 0u);
+          }
+        } else {
+          color[top.first] = 2;
+          path.pop_back();
+        }
+      }
+      return true;
+    }
+
+    void push(unsigned index) {
+      m_path.push_back(index);
+      m_onPath[index] = true;
+    }
+
+    void pop() {
+      m_onPath[m_path.back()] = false;
+      m_path.pop_back();
+    }
+
+    // Adds the components of the current path that were not on a previous path
+    void foundPath() {
+      for( unsigned index : m_path ) {
+        if( !m_found[index] ) {
+          m_found[index] = true;
+          m_result.push_back(index);
+        }
+      }
+    }
+
+    // Returns true if the sink can be reached from the last component of the path
+    bool visit(unsigned index, unsigned prev) {
+      bool result = false;
+      const std::vector<unsigned>& next = m_topology.successors(index, prev);
+
+      for( unsigned n : next ) {
+        if( (n == m_sink) && !m_onPath[n] ) {
+          push(n);
+          foundPath();
+          pop();
+          result = true;
+        }
+      }
+
+      for( unsigned n : next ) {
+        if( m_onPath[n] || (n == m_sink) ) {
+          continue;
         }
-        else
-        {
-          for( const auto & visitedit : visited )
-          {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
+        std::uint64_t state = LoopTopology::key(n, index + 1);
+        if( m_memoize ) {
+          auto it = m_reachesSink.find(state);
+          if( it != m_reachesSink.end() ) {
+            // everything past n is already in the result
+            if( it->second ) {
+              foundPath();
+              result = true;
             }
+            continue;
           }
         }
-        visited.pop_back();
+        push(n);
+        bool reachesSink = visit(n, index + 1);
+        pop();
+        if( m_memoize ) {
+          m_reachesSink[state] = reachesSink;
+        }
+        result = result || reachesSink;
       }
+
+      return result;
     }
 
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
-      {
-        continue;
-      }
-      visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
-      visited.pop_back();
+    LoopTopology& m_topology;
+    unsigned m_sink;
+    bool m_memoize;
+    std::vector<unsigned> m_path;
+    std::vector<bool> m_onPath;
+    std::vector<bool> m_found;
+    std::vector<unsigned> m_result;
+    std::unordered_map<std::uint64_t, bool> m_reachesSink;
+  };
+
+  std::shared_ptr<LoopTopology> Loop_Impl::topology() const
+  {
+    unsigned long long revision = model().getImpl<Model_Impl>()->relationshipRevision();
+    if( !m_topology || (m_topology->revision != revision) ) {
+      m_topology = std::make_shared<LoopTopology>();
+      m_topology->revision = revision;
     }
+    return m_topology;
   }
 
-  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
-                                                        HVACComponent outletComp,
-                                                        openstudio::IddObjectType type ) const
+  std::vector<ModelObject> Loop_Impl::componentsBetween(const HVACComponent& inletComp,
+                                                        const HVACComponent& outletComp,
+                                                        openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
+    std::vector<ModelObject> result;
 
     if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
+      if( (type == IddObjectType::Catchall) || (type == inletComp.iddObjectType()) ) {
+        result.push_back(inletComp);
+      }
+      return result;
     }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _demandComponents;
+    // hold on to the topology in case a call to edges changes the model
+    std::shared_ptr<LoopTopology> t_topology = topology();
+    unsigned source = t_topology->index(inletComp);
+    unsigned sink = t_topology->index(outletComp);
+    auto it = t_topology->paths.find(LoopTopology::key(source, sink));
+    if( it == t_topology->paths.end() ) {
+      LoopPathSearch search(*t_topology, source, sink);
+      it = t_topology->paths.emplace(LoopTopology::key(source, sink), search.result()).first;
     }
-    std::vector<ModelObject> reducedModelObjects;
 
-    for(const auto & demandComponent : _demandComponents)
-    {
-      if( type == demandComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(demandComponent);
+    for( unsigned index : it->second ) {
+      if( (type == IddObjectType::Catchall) || (type == t_topology->types[index]) ) {
+        result.push_back(t_topology->components[index]);
       }
     }
 
-    return reducedModelObjects;
+    return result;
+  }
+
+  std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
+                                                        HVACComponent outletComp,
+                                                        openstudio::IddObjectType type ) const
+  {
+    return componentsBetween(inletComp, outletComp, type);
   }
 
   template <typename T>
@@ -383,33 +541,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _supplyComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-
-    for(const auto & supplyComponent : _supplyComponents)
-    {
-      if( type == supplyComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(supplyComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    return componentsBetween(inletComp, outletComp, type);
   }
 
   std::vector<ModelObject> Loop_Impl::components(HVACComponent inletComp,
@@ -45,6 +45,7 @@ class AvailabilityManagerAssignmentList;
 namespace detail {
 
   class Model_Impl;
+  struct LoopTopology;
 
   class MODEL_API Loop_Impl : public ParentObject_Impl {
 
@@ -141,6 +142,17 @@ namespace detail {
     boost::optional<ModelObject> demandInletNodeAsModelObject();
     boost::optional<ModelObject> demandOutletNodeAsModelObject();
 
+    // Returns the components on any path from inletComp to outletComp, in the order the paths
+    // are found by a depth first search, using the cached topology.
+    std::vector<ModelObject> componentsBetween(const HVACComponent& inletComp,
+                                               const HVACComponent& outletComp,
+                                               openstudio::IddObjectType type) const;
+
+    // Returns the adjacency list of the components reached by componentsBetween so far. It is
+    // discarded whenever a pointer in the model changes, see Workspace_Impl::relationshipRevision.
+    std::shared_ptr<LoopTopology> topology() const;
+
+    mutable std::shared_ptr<LoopTopology> m_topology;
   };
 
 } // detail
@@ -1032,6 +1032,31 @@ namespace detail {
     m_cachedPerformancePrecisionTradeoffs.reset();
   }
 
+  std::vector<WorkspaceObject> Model_Impl::getObjectsByImplType(const std::type_info& implType,
+                                                                bool (*isImplType)(const WorkspaceObject&)) const
+  {
+    std::map<IddObjectType, bool>& index = m_implTypeIndex[std::type_index(implType)];
+
+    std::vector<WorkspaceObject> result;
+    for (const IddObjectType& type : iddObjectTypes()) {
+      if (type == IddObjectType::OS_Version) {
+        continue;
+      }
+      auto it = index.find(type);
+      if (it != index.end() && !it->second) {
+        continue;
+      }
+      std::vector<WorkspaceObject> objects = getObjectsByType(type);
+      if (it == index.end()) {
+        it = index.insert(std::make_pair(type, isImplType(objects.front()))).first;
+      }
+      if (it->second) {
+        result.insert(result.end(), objects.begin(), objects.end());
+      }
+    }
+    return result;
+  }
+
   void Model_Impl::autosize() {
     for (auto optModelObj : objects()) {
       if (auto modelObj = optModelObj.optionalCast<HVACComponent>()) { // HVACComponent
@@ -1417,6 +1442,12 @@ detail::Model_Impl* Model::rawImpl() const
   return getImpl<detail::Model_Impl>().get();
 }
 
+std::vector<WorkspaceObject> Model::getObjectsByImplType(const std::type_info& implType,
+                                                         bool (*isImplType)(const WorkspaceObject&)) const
+{
+  return getImpl<detail::Model_Impl>()->getObjectsByImplType(implType, isImplType);
+}
+
 bool compareInputAndOutput(const ModelObject& object,
                            const std::string& attributeName,
                            double inputResult,
@@ -37,6 +37,7 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <typeinfo>
 #include <vector>
 
 namespace openstudio {
@@ -278,12 +279,22 @@ class MODEL_API Model : public openstudio::Workspace {
    *  \todo Use of this template method requires knowledge of the size of the implementation object.
    *  Therefore, to use model.getModelObjects<Zone>(), the user must include both Zone.hpp and
    *  Zone_Impl.hpp.  It may be better to instantiate each version of this template method to avoid
-   *  exposing the implementation objects, this is an open question. */
+   *  exposing the implementation objects, this is an open question.
+   *
+   *  Unless sorted is true, only objects of the IddObjectTypes known to derive from T are visited. */
   template <typename T>
   std::vector<T> getModelObjects(bool sorted=false) const
   {
     std::vector<T> result;
-    std::vector<WorkspaceObject> objects = this->objects(sorted);
+    std::vector<WorkspaceObject> objects;
+    if (sorted) {
+      objects = this->objects(true);
+    }
+    else {
+      objects = getObjectsByImplType(typeid(typename T::ImplType), [](const WorkspaceObject& object) {
+        return static_cast<bool>(object.getImpl<typename T::ImplType>());
+      });
+    }
     result.reserve(objects.size());
     for(std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it)
     {
@@ -488,6 +499,10 @@ class MODEL_API Model : public openstudio::Workspace {
 
   /// @endcond
  private:
+  /** Used by getModelObjects<T>, see detail::Model_Impl::getObjectsByImplType. */
+  std::vector<WorkspaceObject> getObjectsByImplType(const std::type_info& implType,
+                                                    bool (*isImplType)(const WorkspaceObject&)) const;
+
   REGISTER_LOGGER("openstudio.model.Model");
 };
 
@@ -124,6 +124,9 @@
 // Ignore rawImpl, should that even be in the public interface?
 %ignore openstudio::model::Model::rawImpl;
 
+// vector of vectors of doubles is not wrapped, use ScheduleBase::annualValues
+%ignore openstudio::model::annualScheduleValues;
+
 namespace openstudio {
 namespace model {
 
@@ -49,6 +49,8 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <typeindex>
 #include <vector>
 
 namespace openstudio {
@@ -104,7 +106,9 @@ namespace detail {
                StrictnessLevel level = StrictnessLevel::Draft);
 
     /** Implementation of openstudio::detail::Workspace_Impl::clone for Model_Impl. The returned
-     *  value may be cast to type Model. */
+     *  value may be cast to type Model. As for Workspace::clone, the cloned objects share their
+     *  field text with the originals until modified, and the clone may be modified on a different
+     *  thread than this model. */
     virtual Workspace clone(bool keepHandles=false) const override;
 
     /** Implementation of openstudio::detail::Workspace_Impl::cloneSubset for Model_Impl. The
@@ -185,6 +189,13 @@ namespace detail {
      *  object which can be significantly faster than calling getOptionalUniqueModelObject<WeatherFile>(). */
     boost::optional<WeatherFile> weatherFile() const;
 
+    /** Returns the objects whose implementation is (or derives from) implType, according to
+     *  isImplType. All objects of an IddObjectType share one implementation class, so isImplType is
+     *  only called for the first object of each IddObjectType, and the answer is kept for later
+     *  calls. Does not include the version object. Used by Model::getModelObjects<T>. */
+    std::vector<WorkspaceObject> getObjectsByImplType(const std::type_info& implType,
+                                                      bool (*isImplType)(const WorkspaceObject&)) const;
+
     Schedule alwaysOnDiscreteSchedule() const;
 
     std::string alwaysOnDiscreteScheduleName() const;
@@ -309,6 +320,10 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    // for each implType passed to getObjectsByImplType, whether each IddObjectType seen so far
+    // derives from it
+    mutable std::map<std::type_index, std::map<IddObjectType, bool> > m_implTypeIndex;
+
   // private slots:
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
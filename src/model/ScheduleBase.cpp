@@ -32,6 +32,12 @@
 
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
+#include "YearDescription.hpp"
+#include "YearDescription_Impl.hpp"
+#include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/idf/ValidityReport.hpp"
 
@@ -89,6 +95,78 @@ namespace detail {
     return true;
   }
 
+  std::vector<double> ScheduleBase_Impl::annualValues(const openstudio::Time& timestep) const {
+    unsigned n = timestepsPerDay(timestep);
+    if (n == 0) {
+      LOG(Error, "Cannot evaluate " << briefDescription() << " at a timestep of " << timestep
+          << ", which does not evenly divide a day.");
+      return std::vector<double>();
+    }
+    unsigned long long revision = model().getImpl<Model_Impl>()->changeRevision();
+    if ((m_annualValuesRevision == revision) && (m_annualValuesTimestepsPerDay == n)) {
+      return m_annualValues;
+    }
+    return annualValues(annualDates(model()), n);
+  }
+
+  std::vector<double> ScheduleBase_Impl::annualValues(const std::vector<openstudio::Date>& dates,
+                                                      unsigned timestepsPerDay) const
+  {
+    unsigned long long revision = model().getImpl<Model_Impl>()->changeRevision();
+    if ((m_annualValuesRevision != revision) || (m_annualValuesTimestepsPerDay != timestepsPerDay)) {
+      m_annualValues = computeAnnualValues(dates, timestepsPerDay);
+      m_annualValuesRevision = revision;
+      m_annualValuesTimestepsPerDay = timestepsPerDay;
+    }
+    return m_annualValues;
+  }
+
+  std::vector<double> ScheduleBase_Impl::computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                             unsigned timestepsPerDay) const
+  {
+    LOG(Warn, "Annual values are not available for " << briefDescription() << ".");
+    return std::vector<double>();
+  }
+
+  unsigned ScheduleBase_Impl::timestepsPerDay(const openstudio::Time& timestep) {
+    int seconds = timestep.totalSeconds();
+    int secondsPerDay = 24 * 60 * 60;
+    if ((seconds <= 0) || (secondsPerDay % seconds != 0)) {
+      return 0;
+    }
+    return secondsPerDay / seconds;
+  }
+
+  std::vector<openstudio::Date> ScheduleBase_Impl::annualDates(const Model& model) {
+    int year = openstudio::Date(MonthOfYear::Jan, 1).assumedBaseYear();
+    if (boost::optional<YearDescription> yearDescription = model.yearDescription()) {
+      year = yearDescription->assumedYear();
+    }
+    std::vector<openstudio::Date> result;
+    openstudio::Date endDate(MonthOfYear::Dec, 31, year);
+    for (openstudio::Date date(MonthOfYear::Jan, 1, year); date <= endDate; date += openstudio::Time(1)) {
+      result.push_back(date);
+    }
+    return result;
+  }
+
+  std::vector<double> ScheduleBase_Impl::concatenateDays(const std::vector<boost::optional<ScheduleDay> >& daySchedules,
+                                                         unsigned timestepsPerDay)
+  {
+    std::vector<double> result;
+    result.reserve(daySchedules.size() * timestepsPerDay);
+    for (const boost::optional<ScheduleDay>& daySchedule : daySchedules) {
+      if (daySchedule) {
+        const std::vector<double>& values = daySchedule->getImpl<ScheduleDay_Impl>()->timestepValues(timestepsPerDay);
+        result.insert(result.end(), values.begin(), values.end());
+      }
+      else {
+        result.insert(result.end(), timestepsPerDay, 0.0);
+      }
+    }
+    return result;
+  }
+
   boost::optional<ModelObject> ScheduleBase_Impl::scheduleTypeLimitsAsModelObject() const {
     OptionalModelObject result;
     OptionalScheduleTypeLimits intermediate = scheduleTypeLimits();
@@ -133,6 +211,10 @@ void ScheduleBase::ensureNoLeapDays()
   getImpl<detail::ScheduleBase_Impl>()->ensureNoLeapDays();
 }
 
+std::vector<double> ScheduleBase::annualValues(const openstudio::Time& timestep) const {
+  return getImpl<detail::ScheduleBase_Impl>()->annualValues(timestep);
+}
+
 /// @cond
 ScheduleBase::ScheduleBase(std::shared_ptr<detail::ScheduleBase_Impl> impl)
   : ResourceObject(std::move(impl))
@@ -143,6 +225,34 @@ ScheduleBase::ScheduleBase(IddObjectType type, const Model &model)
 {}
 /// @endcond
 
+std::vector<std::vector<double> > annualScheduleValues(const std::vector<ScheduleBase>& schedules,
+                                                       const openstudio::Time& timestep)
+{
+  std::vector<std::vector<double> > result;
+  result.reserve(schedules.size());
+
+  unsigned n = detail::ScheduleBase_Impl::timestepsPerDay(timestep);
+  if (n == 0) {
+    LOG_FREE(Error, "openstudio.model.ScheduleBase", "Cannot evaluate schedules at a timestep of "
+             << timestep << ", which does not evenly divide a day.");
+    result.resize(schedules.size());
+    return result;
+  }
+
+  // the calendar is shared by all the schedules of a model, and the timestep values of a
+  // ScheduleDay by all the schedules that use it
+  boost::optional<Model> model;
+  std::vector<openstudio::Date> dates;
+  for (const ScheduleBase& schedule : schedules) {
+    if (!model || (schedule.model() != *model)) {
+      model = schedule.model();
+      dates = detail::ScheduleBase_Impl::annualDates(*model);
+    }
+    result.push_back(schedule.getImpl<detail::ScheduleBase_Impl>()->annualValues(dates, n));
+  }
+  return result;
+}
+
 } // model
 } // openstudio
 
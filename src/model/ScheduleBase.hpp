@@ -34,6 +34,9 @@
 #include "ResourceObject.hpp"
 
 namespace openstudio {
+
+class Time;
+
 namespace model {
 
 class ScheduleTypeLimits;
@@ -64,6 +67,14 @@ class MODEL_API ScheduleBase : public ResourceObject {
   /** Returns the ScheduleTypeLimits of this object, if set. */
   boost::optional<ScheduleTypeLimits> scheduleTypeLimits() const;
 
+  /** Returns the value of this schedule at the end of each timestep through the year, day by day
+   *  from January 1 to December 31 of the assumed year of the model's YearDescription. timestep
+   *  must evenly divide a day. Holidays, design days and custom days are not applied. The values
+   *  are kept until anything in the model changes, so repeated calls are cheap. Returns an empty
+   *  vector if timestep is invalid or this type of schedule cannot be evaluated this way; ScheduleDay,
+   *  ScheduleRuleset, ScheduleYear and ScheduleConstant can be. */
+  std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
   //@}
   /** @name Setters */
   //@{
@@ -109,6 +120,12 @@ typedef boost::optional<ScheduleBase> OptionalScheduleBase;
 /** \relates ScheduleBase*/
 typedef std::vector<ScheduleBase> ScheduleBaseVector;
 
+/** Returns the annualValues of each of schedules at timestep. Schedules of the same model share
+ *  one calendar, and the values of the \link ScheduleDay ScheduleDays\endlink they have in common
+ *  are computed once. \relates ScheduleBase */
+MODEL_API std::vector<std::vector<double> > annualScheduleValues(const std::vector<ScheduleBase>& schedules,
+                                                                 const openstudio::Time& timestep);
+
 } // model
 } // openstudio
 
@@ -33,11 +33,15 @@
 #include "ModelAPI.hpp"
 #include "ResourceObject_Impl.hpp"
 
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
+
 namespace openstudio {
 
 
 namespace model {
 
+class ScheduleDay;
 class ScheduleTypeLimits;
 
 namespace detail {
@@ -72,6 +76,13 @@ namespace detail {
 
     virtual std::vector<double> values() const = 0;
 
+    /** Returns the value at the end of each timestep through the year, see
+     *  ScheduleBase::annualValues. */
+    std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
+    /** As annualValues(timestep), with dates equal to annualDates(model()) and timestepsPerDay
+     *  equal to timestepsPerDay(timestep) already worked out. */
+    std::vector<double> annualValues(const std::vector<openstudio::Date>& dates, unsigned timestepsPerDay) const;
 
     //@}
     /** @name Setters */
@@ -92,12 +103,40 @@ namespace detail {
 
     bool valuesAreWithinBounds() const;
 
+    /** Computes annualValues. Returns an empty vector, which is the default, for schedules that
+     *  cannot be evaluated this way. */
+    virtual std::vector<double> computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                    unsigned timestepsPerDay) const;
+
+   public:
+    /** @name Annual Values Helpers */
+    //@{
+
+    /** Returns the number of timesteps in a day, or 0 if timestep does not evenly divide a day. */
+    static unsigned timestepsPerDay(const openstudio::Time& timestep);
+
+    /** Returns the dates schedules of model are evaluated over by annualValues, January 1 to
+     *  December 31 of the assumed year of model's YearDescription. */
+    static std::vector<openstudio::Date> annualDates(const Model& model);
+
+    /** Returns the ScheduleDay::timestepValues of each of daySchedules in turn, with zeros for
+     *  days without a schedule. */
+    static std::vector<double> concatenateDays(const std::vector<boost::optional<ScheduleDay> >& daySchedules,
+                                               unsigned timestepsPerDay);
+
+    //@}
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleBase");
 
     boost::optional<ModelObject> scheduleTypeLimitsAsModelObject() const;
 
     bool setScheduleTypeLimitsAsModelObject(const boost::optional<ModelObject>& modelObject);
+
+    // annualValues, kept until anything in the model changes, see Workspace_Impl::changeRevision
+    mutable unsigned long long m_annualValuesRevision = 0;
+    mutable unsigned m_annualValuesTimestepsPerDay = 0;
+    mutable std::vector<double> m_annualValues;
   };
 
 } // detail
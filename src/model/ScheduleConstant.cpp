@@ -117,6 +117,12 @@ namespace detail {
     return *result;
   }
 
+  std::vector<double> ScheduleConstant_Impl::computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                                 unsigned timestepsPerDay) const
+  {
+    return DoubleVector(dates.size() * timestepsPerDay, value());
+  }
+
   bool ScheduleConstant_Impl::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
     if (scheduleTypeLimits.model() != model()) {
       return false;
@@ -102,6 +102,11 @@ namespace detail {
     virtual void ensureNoLeapDays() override;
 
     //@}
+   protected:
+
+    virtual std::vector<double> computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                    unsigned timestepsPerDay) const override;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleConstant");
   };
@@ -49,7 +49,8 @@
 #include "../utilities/core/Assert.hpp"
 
 #include "../utilities/time/Time.hpp"
-#include "../utilities/data/Vector.hpp"
+
+#include <algorithm>
 
 namespace openstudio {
 namespace model {
@@ -212,40 +213,113 @@ namespace detail {
       return 0.0;
     }
 
-    std::vector<double> values = this->values(); // these are already sorted
-    std::vector<openstudio::Time> times = this->times(); // these are already sorted
-
-    unsigned N = times.size();
-    OS_ASSERT(values.size() == N);
-
-    if (N == 0){
+    const Knots& knots = this->knots();
+    if (knots.days.empty()){
       return 0.0;
     }
 
-    openstudio::Vector x(N + 2);
-    openstudio::Vector y(N + 2);
+    return interpolate(knots, time.totalDays());
+  }
 
-    x[0] = -0.000001;
-    y[0] = 0.0;
+  std::vector<double> ScheduleDay_Impl::timestepValues(const openstudio::Time& timestep) const
+  {
+    unsigned n = timestepsPerDay(timestep);
+    if (n == 0){
+      LOG(Error, "Cannot evaluate " << briefDescription() << " at a timestep of " << timestep
+          << ", which does not evenly divide a day.");
+      return std::vector<double>();
+    }
+    return timestepValues(n);
+  }
 
-    for (unsigned i = 0; i < N; ++i){
-      x[i + 1] = times[i].totalDays();
-      y[i + 1] = values[i];
+  const std::vector<double>& ScheduleDay_Impl::timestepValues(unsigned timestepsPerDay) const
+  {
+    if (m_cachedTimestepsPerDay != timestepsPerDay){
+      const Knots& knots = this->knots();
+      int secondsPerTimestep = (24 * 60 * 60) / timestepsPerDay;
+      m_cachedTimestepValues.assign(timestepsPerDay, 0.0);
+      if (!knots.days.empty()){
+        for (unsigned i = 0; i < timestepsPerDay; ++i){
+          // same day fraction as getValue(Time) at the end of the timestep
+          double day = openstudio::Time(0, 0, 0, (i + 1) * secondsPerTimestep).totalDays();
+          m_cachedTimestepValues[i] = interpolate(knots, day);
+        }
+      }
+      m_cachedTimestepsPerDay = timestepsPerDay;
+    }
+    return m_cachedTimestepValues;
+  }
+
+  std::vector<double> ScheduleDay_Impl::computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                            unsigned timestepsPerDay) const
+  {
+    const std::vector<double>& dayValues = timestepValues(timestepsPerDay);
+    std::vector<double> result;
+    result.reserve(dates.size() * timestepsPerDay);
+    for (unsigned i = 0, n = dates.size(); i < n; ++i){
+      result.insert(result.end(), dayValues.begin(), dayValues.end());
     }
+    return result;
+  }
+
+  const ScheduleDay_Impl::Knots& ScheduleDay_Impl::knots() const
+  {
+    if (!m_cachedKnots){
+      std::vector<double> values = this->values(); // these are already sorted
+      std::vector<openstudio::Time> times = this->times(); // these are already sorted
+
+      unsigned N = times.size();
+      OS_ASSERT(values.size() == N);
+
+      Knots result;
+      result.linear = this->interpolatetoTimestep();
+      if (N > 0){
+        result.days.reserve(N + 2);
+        result.values.reserve(N + 2);
 
-    x[N + 1] = 1.000001;
-    y[N + 1] = 0.0;
+        result.days.push_back(-0.000001);
+        result.values.push_back(0.0);
+
+        for (unsigned i = 0; i < N; ++i){
+          result.days.push_back(times[i].totalDays());
+          result.values.push_back(values[i]);
+        }
 
-    InterpMethod interpMethod;
-    if (this->interpolatetoTimestep()){
-      interpMethod = LinearInterp;
-    }else{
-      interpMethod = HoldNextInterp;
+        result.days.push_back(1.000001);
+        result.values.push_back(0.0);
+      }
+
+      m_cachedKnots = std::move(result);
     }
 
-    double result = interp(x, y, time.totalDays(), interpMethod, NoneExtrap);
+    return m_cachedKnots.get();
+  }
 
-    return result;
+  double ScheduleDay_Impl::interpolate(const Knots& knots, double day)
+  {
+    // same as interp with LinearInterp or HoldNextInterp and NoneExtrap, without building Vectors
+    const std::vector<double>& x = knots.days;
+    const std::vector<double>& y = knots.values;
+    std::size_t N = x.size();
+
+    if (x[0] == day){
+      return y[0];
+    }else if (day < x[0]){
+      return 0.0;
+    }else if (x[N-1] == day){
+      return y[N-1];
+    }else if (day > x[N-1]){
+      return 0.0;
+    }
+
+    std::size_t ib = std::lower_bound(x.begin(), x.end(), day) - x.begin();
+    std::size_t ia = ib - 1;
+    if (!knots.linear){
+      return y[ib];
+    }
+    double wa = (x[ib] - day) / (x[ib] - x[ia]);
+    double wb = (day - x[ia]) / (x[ib] - x[ia]);
+    return wa*y[ia] + wb*y[ib];
   }
 
   bool ScheduleDay_Impl::setScheduleTypeLimits(const ScheduleTypeLimits& scheduleTypeLimits) {
@@ -412,6 +486,9 @@ namespace detail {
   {
     m_cachedTimes.reset();
     m_cachedValues.reset();
+    m_cachedKnots.reset();
+    m_cachedTimestepsPerDay = 0;
+    m_cachedTimestepValues.clear();
   }
 
 } // detail
@@ -461,6 +538,10 @@ double ScheduleDay::getValue(const openstudio::Time& time) const {
   return getImpl<detail::ScheduleDay_Impl>()->getValue(time);
 }
 
+std::vector<double> ScheduleDay::timestepValues(const openstudio::Time& timestep) const {
+  return getImpl<detail::ScheduleDay_Impl>()->timestepValues(timestep);
+}
+
 bool ScheduleDay::setInterpolatetoTimestep(bool interpolatetoTimestep) {
   return getImpl<detail::ScheduleDay_Impl>()->setInterpolatetoTimestep(interpolatetoTimestep);
 }
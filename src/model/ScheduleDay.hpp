@@ -87,6 +87,10 @@ class MODEL_API ScheduleDay : public ScheduleBase {
   /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
   double getValue(const openstudio::Time& time) const;
 
+  /// Returns getValue at the end of each timestep of the day, which timestep must evenly divide.
+  /// The values are kept until this schedule changes. Returns an empty vector for an invalid timestep.
+  std::vector<double> timestepValues(const openstudio::Time& timestep) const;
+
   //@}
   /** @name Setters */
   //@{
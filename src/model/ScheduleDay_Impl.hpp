@@ -101,6 +101,13 @@ namespace detail {
     /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
     double getValue(const openstudio::Time& time) const;
 
+    /// Returns getValue at the end of each timestep of the day, see ScheduleDay::timestepValues.
+    std::vector<double> timestepValues(const openstudio::Time& timestep) const;
+
+    /// Returns getValue at the end of each of timestepsPerDay timesteps of the day. Kept until
+    /// this schedule changes.
+    const std::vector<double>& timestepValues(unsigned timestepsPerDay) const;
+
 
     //@}
     /** @name Setters */
@@ -134,6 +141,9 @@ namespace detail {
 
     virtual bool okToResetScheduleTypeLimits() const override;
 
+    virtual std::vector<double> computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                    unsigned timestepsPerDay) const override;
+
    //private slots:
    private:
 
@@ -142,8 +152,23 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleDay");
 
+    // The points getValue interpolates between, times in days and values with a zero at either
+    // end of the day, and whether to interpolate linearly between them or hold the next value.
+    struct Knots {
+      std::vector<double> days;
+      std::vector<double> values;
+      bool linear;
+    };
+
+    const Knots& knots() const;
+
+    static double interpolate(const Knots& knots, double day);
+
     mutable boost::optional<std::vector<openstudio::Time> > m_cachedTimes;
     mutable boost::optional<std::vector<double> > m_cachedValues;
+    mutable boost::optional<Knots> m_cachedKnots;
+    mutable unsigned m_cachedTimestepsPerDay = 0;
+    mutable std::vector<double> m_cachedTimestepValues;
   };
 
 } // detail
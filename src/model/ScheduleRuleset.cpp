@@ -488,6 +488,30 @@ namespace detail {
     }
   }
 
+  std::vector<double> ScheduleRuleset_Impl::computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                                unsigned timestepsPerDay) const
+  {
+    // same choice of day schedule as getDaySchedules, rules in priority order then the default
+    std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
+    std::vector<std::vector<bool> > test;
+    for (ScheduleRule& scheduleRule : scheduleRules){
+      test.push_back(scheduleRule.containsDates(dates));
+    }
+
+    boost::optional<ScheduleDay> defaultDaySchedule = this->optionalDefaultDaySchedule();
+    std::vector<boost::optional<ScheduleDay> > daySchedules(dates.size(), defaultDaySchedule);
+    for (unsigned j = 0, numDates = dates.size(); j < numDates; ++j){
+      for (unsigned i = 0, numRules = scheduleRules.size(); i < numRules; ++i){
+        if (test[i][j]){
+          daySchedules[j] = scheduleRules[i].daySchedule();
+          break;
+        }
+      }
+    }
+
+    return concatenateDays(daySchedules, timestepsPerDay);
+  }
+
   boost::optional<ScheduleDay> ScheduleRuleset_Impl::optionalDefaultDaySchedule() const {
     return getObject<ScheduleRuleset>().getModelObjectTarget<ScheduleDay>(OS_Schedule_RulesetFields::DefaultDayScheduleName);
   }
@@ -31,8 +31,12 @@
 #include "ScheduleWeek_Impl.hpp"
 #include "ScheduleDay.hpp"
 #include "ScheduleDay_Impl.hpp"
+#include "ScheduleBase_Impl.hpp"
 #include "Model.hpp"
 
+#include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
+
 #include <utilities/idd/OS_Schedule_Week_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
 
@@ -296,6 +300,31 @@ namespace detail {
     return result;
   }
 
+  std::vector<boost::optional<ScheduleDay> > ScheduleWeek_Impl::daySchedules(const std::vector<openstudio::Date>& dates) const
+  {
+    // indexed by DayOfWeek, Sunday is 0
+    std::vector<boost::optional<ScheduleDay> > week{sundaySchedule(), mondaySchedule(), tuesdaySchedule(),
+      wednesdaySchedule(), thursdaySchedule(), fridaySchedule(), saturdaySchedule()};
+
+    std::vector<boost::optional<ScheduleDay> > result;
+    result.reserve(dates.size());
+    for (const openstudio::Date& date : dates){
+      result.push_back(week[date.dayOfWeek().value()]);
+    }
+    return result;
+  }
+
+  std::vector<double> ScheduleWeek_Impl::annualValues(const openstudio::Time& timestep) const
+  {
+    unsigned n = ScheduleBase_Impl::timestepsPerDay(timestep);
+    if (n == 0){
+      LOG(Error, "Cannot evaluate " << briefDescription() << " at a timestep of " << timestep
+          << ", which does not evenly divide a day.");
+      return std::vector<double>();
+    }
+    return ScheduleBase_Impl::concatenateDays(daySchedules(ScheduleBase_Impl::annualDates(model())), n);
+  }
+
 } // detail
 
 ScheduleWeek::ScheduleWeek(const Model& model)
@@ -375,6 +404,11 @@ boost::optional<ScheduleDay> ScheduleWeek::customDay2Schedule() const
   return getImpl<detail::ScheduleWeek_Impl>()->customDay2Schedule();
 }
 
+std::vector<double> ScheduleWeek::annualValues(const openstudio::Time& timestep) const
+{
+  return getImpl<detail::ScheduleWeek_Impl>()->annualValues(timestep);
+}
+
 bool ScheduleWeek::setSundaySchedule(const ScheduleDay& schedule)
 {
   return getImpl<detail::ScheduleWeek_Impl>()->setSundaySchedule(schedule);
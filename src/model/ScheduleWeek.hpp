@@ -34,6 +34,9 @@
 #include "ResourceObject.hpp"
 
 namespace openstudio {
+
+class Time;
+
 namespace model {
 
 class ScheduleDay;
@@ -127,6 +130,11 @@ class MODEL_API ScheduleWeek : public ResourceObject {
   /// Set schedules for all weekends.
   bool setWeekendSchedule(const ScheduleDay& schedule);
 
+  /// Returns the value at the end of each timestep through the year, repeating this week from
+  /// January 1 as in ScheduleBase::annualValues. Holiday, design day and custom day schedules are
+  /// not applied. Returns an empty vector if timestep does not evenly divide a day.
+  std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
   //@}
  protected:
   /// @cond
@@ -34,6 +34,10 @@
 #include "ResourceObject_Impl.hpp"
 
 namespace openstudio {
+
+class Date;
+class Time;
+
 namespace model {
 
 class ScheduleDay;
@@ -131,6 +135,12 @@ namespace detail {
     /// Set schedules for all weekends.
     bool setWeekendSchedule(const ScheduleDay& schedule);
 
+    /// Returns the day schedule used on each of dates, by day of the week.
+    std::vector<boost::optional<ScheduleDay> > daySchedules(const std::vector<openstudio::Date>& dates) const;
+
+    /// Returns the value at the end of each timestep through the year, see ScheduleWeek::annualValues.
+    std::vector<double> annualValues(const openstudio::Time& timestep) const;
+
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleWeek");
@@ -31,6 +31,8 @@
 #include "ScheduleYear_Impl.hpp"
 #include "ScheduleWeek.hpp"
 #include "ScheduleWeek_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
 #include "ScheduleTypeLimits.hpp"
 #include "ScheduleTypeLimits_Impl.hpp"
 #include "YearDescription.hpp"
@@ -180,6 +182,35 @@ namespace detail {
     return result;
   }
 
+  std::vector<double> ScheduleYear_Impl::computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                             unsigned timestepsPerDay) const
+  {
+    std::vector<ScheduleWeek> scheduleWeeks = this->scheduleWeeks(); // these are already sorted
+    std::vector<openstudio::Date> untilDates = this->dates(); // these are already sorted
+
+    unsigned N = untilDates.size();
+    OS_ASSERT(scheduleWeeks.size() == N);
+
+    // same choice of week as getScheduleWeek, the first until date on or after each date, with
+    // each week asked for the day schedules of all the dates it covers at once
+    std::vector<boost::optional<ScheduleDay> > daySchedules;
+    daySchedules.reserve(dates.size());
+    std::vector<openstudio::Date>::const_iterator begin = dates.begin();
+    for (unsigned i = 0; (i < N) && (begin != dates.end()); ++i){
+      std::vector<openstudio::Date>::const_iterator end = begin;
+      while ((end != dates.end()) && (*end <= untilDates[i])){
+        ++end;
+      }
+      std::vector<boost::optional<ScheduleDay> > weekDaySchedules =
+          scheduleWeeks[i].getImpl<ScheduleWeek_Impl>()->daySchedules(std::vector<openstudio::Date>(begin, end));
+      daySchedules.insert(daySchedules.end(), weekDaySchedules.begin(), weekDaySchedules.end());
+      begin = end;
+    }
+    daySchedules.resize(dates.size());
+
+    return concatenateDays(daySchedules, timestepsPerDay);
+  }
+
   bool ScheduleYear_Impl::addScheduleWeek(const openstudio::Date& untilDate, const ScheduleWeek& scheduleWeek)
   {
     YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
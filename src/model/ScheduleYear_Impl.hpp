@@ -121,6 +121,10 @@ namespace detail {
 
     //@}
    protected:
+
+    virtual std::vector<double> computeAnnualValues(const std::vector<openstudio::Date>& dates,
+                                                    unsigned timestepsPerDay) const override;
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleYear");
   };
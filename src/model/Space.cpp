@@ -127,6 +127,9 @@
 #include "../utilities/geometry/BoundingBox.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/System.hpp"
+
+#include <boost/lexical_cast.hpp>
 
 #undef BOOST_UBLAS_TYPE_CHECK
 #if defined(_MSC_VER)
@@ -144,10 +147,222 @@
 #endif
 
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace openstudio {
 namespace model {
 
+namespace {
+
+  // vertices as read back from the model after setVertices, values are stored as strings so
+  // they are rounded. returns none if setVertices would fail.
+  boost::optional<std::vector<Point3d> > storedVertices(const std::vector<Point3d>& vertices)
+  {
+    if (vertices.size() < 3){
+      return boost::none;
+    }
+    try {
+      Plane plane(vertices);
+    }catch (const std::exception&){
+      return boost::none;
+    }
+
+    std::vector<Point3d> result;
+    for (const Point3d& vertex : vertices){
+      result.push_back(Point3d(boost::lexical_cast<double>(toString(vertex.x())),
+                               boost::lexical_cast<double>(toString(vertex.y())),
+                               boost::lexical_cast<double>(toString(vertex.z()))));
+    }
+    return result;
+  }
+
+  /** Intersects the surfaces of two spaces. The constructor and apply() read and modify the model,
+   *  plan() only works on the vertices copied by the constructor so that it can run on another thread. */
+  class SpacePairIntersection
+  {
+   public:
+
+    SpacePairIntersection(const Space& space, const Space& otherSpace);
+
+    /// computes all surface intersections without modifying the model
+    void plan();
+
+    /// modifies and creates surfaces as planned, rethrows anything thrown by plan
+    void apply();
+
+   private:
+
+    struct Step {
+      unsigned surface;
+      unsigned otherSurface;
+      detail::SurfaceIntersectionGeometry geometry;
+    };
+
+    std::vector<Surface> m_surfaces;
+    std::vector<Surface> m_otherSurfaces;
+    Transformation m_spaceTransformation;
+    Transformation m_otherSpaceTransformation;
+    std::vector<std::vector<Point3d> > m_vertices;
+    std::vector<std::vector<Point3d> > m_otherVertices;
+    std::vector<bool> m_eligible;
+    std::vector<bool> m_otherEligible;
+    std::vector<Step> m_steps;
+    std::exception_ptr m_exception;
+  };
+
+  SpacePairIntersection::SpacePairIntersection(const Space& space, const Space& otherSpace)
+    : m_surfaces(space.surfaces()),
+      m_otherSurfaces(otherSpace.surfaces()),
+      m_spaceTransformation(space.transformation()),
+      m_otherSpaceTransformation(otherSpace.transformation())
+  {
+    std::sort(m_surfaces.begin(), m_surfaces.end(), [](const Surface & a, const Surface & b) -> bool {return a.grossArea() > b.grossArea(); });
+    std::sort(m_otherSurfaces.begin(), m_otherSurfaces.end(), [](const Surface & a, const Surface & b) -> bool {return a.grossArea() > b.grossArea(); });
+
+    // surfaces with sub surfaces or adjacent surfaces are not intersected
+    for (const Surface& surface : m_surfaces){
+      m_vertices.push_back(surface.vertices());
+      m_eligible.push_back(surface.subSurfaces().empty() && !surface.adjacentSurface());
+    }
+    for (const Surface& otherSurface : m_otherSurfaces){
+      m_otherVertices.push_back(otherSurface.vertices());
+      m_otherEligible.push_back(otherSurface.subSurfaces().empty() && !otherSurface.adjacentSurface());
+    }
+  }
+
+  void SpacePairIntersection::plan()
+  {
+    try {
+      std::set<std::pair<unsigned, unsigned> > completedIntersections;
+
+      // transform from other to this coordinates
+      Transformation transformation = m_spaceTransformation.inverse()*m_otherSpaceTransformation;
+
+      bool anyNewSurfaces = true;
+      while(anyNewSurfaces){
+
+        // new surfaces are only considered in the next pass
+        unsigned numSurfaces = m_vertices.size();
+        unsigned numOtherSurfaces = m_otherVertices.size();
+
+        // surfaces that are apart can not intersect, so only surfaces with intersecting bounding
+        // boxes are tested below. intersection only ever clips a surface to the other one (snapping
+        // vertices within 1 cm), so the bounds are padded well beyond that for the whole pass.
+        std::vector<BoundingBox> bounds(numSurfaces);
+        for (unsigned i = 0; i < numSurfaces; ++i){
+          bounds[i].addPoints(m_vertices[i]);
+        }
+        std::vector<BoundingBox> otherBounds(numOtherSurfaces);
+        for (unsigned j = 0; j < numOtherSurfaces; ++j){
+          otherBounds[j].addPoints(transformation*m_otherVertices[j]);
+        }
+        std::vector<std::vector<unsigned> > candidates = intersectingBoundingBoxes(bounds, otherBounds, 0.1);
+
+        for (unsigned i = 0; i < numSurfaces; ++i){
+          if (!m_eligible[i]){
+            continue;
+          }
+
+          for (unsigned j : candidates[i]){
+            if (!m_otherEligible[j]){
+              continue;
+            }
+
+            // see if we have already tested these for intersection,
+            // surfaces that previously did not intersect will not intersect if vertices change
+            // surfaces that previously did intersect will intersect exactly
+            if (!completedIntersections.insert(std::make_pair(i, j)).second){
+              continue;
+            }
+
+            detail::SurfaceIntersectionGeometry geometry = detail::Surface_Impl::computeIntersectionGeometry(
+              m_vertices[i], m_spaceTransformation, m_otherVertices[j], m_otherSpaceTransformation);
+            if (!geometry.intersects){
+              if (!geometry.error.empty()){
+                m_steps.push_back(Step{i, j, geometry});
+              }
+              continue;
+            }
+            m_steps.push_back(Step{i, j, geometry});
+
+            // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
+            std::vector<unsigned> ineligibleSurfaces(1, i);
+            std::vector<unsigned> ineligibleOtherSurfaces(1, j);
+
+            if (!geometry.newVertices1.empty() || !geometry.newVertices2.empty()){
+              boost::optional<std::vector<Point3d> > vertices = storedVertices(geometry.vertices1);
+              if (vertices){
+                m_vertices[i] = *vertices;
+              }
+              vertices = storedVertices(geometry.vertices2);
+              if (vertices){
+                m_otherVertices[j] = *vertices;
+              }
+
+              // number of surfaces in each space will only increase in intersect
+              for (const std::vector<Point3d>& newVertices : geometry.newVertices1){
+                vertices = storedVertices(newVertices);
+                if (!vertices){
+                  // creating the surface throws in apply, nothing after it happens
+                  return;
+                }
+                ineligibleSurfaces.push_back(m_vertices.size());
+                m_vertices.push_back(*vertices);
+                m_eligible.push_back(true);
+              }
+              for (const std::vector<Point3d>& newVertices : geometry.newVertices2){
+                vertices = storedVertices(newVertices);
+                if (!vertices){
+                  return;
+                }
+                ineligibleOtherSurfaces.push_back(m_otherVertices.size());
+                m_otherVertices.push_back(*vertices);
+                m_otherEligible.push_back(true);
+              }
+            }
+
+            for (unsigned ineligibleSurface : ineligibleSurfaces){
+              for (unsigned ineligibleOtherSurface : ineligibleOtherSurfaces){
+                completedIntersections.insert(std::make_pair(ineligibleSurface, ineligibleOtherSurface));
+              }
+            }
+          }
+        }
+
+        anyNewSurfaces = (m_vertices.size() > numSurfaces) || (m_otherVertices.size() > numOtherSurfaces);
+      }
+    }catch (...){
+      m_exception = std::current_exception();
+    }
+  }
+
+  void SpacePairIntersection::apply()
+  {
+    for (const Step& step : m_steps){
+      Surface surface = m_surfaces[step.surface];
+      Surface otherSurface = m_otherSurfaces[step.otherSurface];
+      boost::optional<SurfaceIntersection> intersection = surface.getImpl<detail::Surface_Impl>()->applyIntersectionGeometry(otherSurface, step.geometry);
+      if (intersection){
+        std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
+        m_surfaces.insert(m_surfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
+
+        std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
+        m_otherSurfaces.insert(m_otherSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
+      }
+    }
+
+    if (m_exception){
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+} // namespace
+
 namespace detail {
 
   Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
@@ -914,6 +1129,9 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::FloorArea)) {
+      return *cached;
+    }
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.surfaceType(), "Floor"))
@@ -924,10 +1142,13 @@ namespace detail {
         result += surface.grossArea();
       }
     }
-    return result;
+    return cacheQuantity(CachedQuantity::FloorArea,result);
   }
 
   double Space_Impl::exteriorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ExteriorArea)) {
+      return *cached;
+    }
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -935,10 +1156,13 @@ namespace detail {
         result += surface.grossArea();
       }
     }
-    return result;
+    return cacheQuantity(CachedQuantity::ExteriorArea,result);
   }
 
   double Space_Impl::exteriorWallArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ExteriorWallArea)) {
+      return *cached;
+    }
     double result = 0;
     for (const Surface& surface : this->surfaces()) {
       if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
@@ -949,10 +1173,13 @@ namespace detail {
         }
       }
     }
-    return result;
+    return cacheQuantity(CachedQuantity::ExteriorWallArea,result);
   }
 
   double Space_Impl::volume() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::Volume)) {
+      return *cached;
+    }
     double result = 0;
 
     // TODO: need a better method
@@ -980,10 +1207,13 @@ namespace detail {
       result = (roofHeight - floorHeight) * this->floorArea();
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::Volume,result);
   }
 
   double Space_Impl::numberOfPeople() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::NumberOfPeople)) {
+      return *cached;
+    }
     double result = 0.0;
     double area = floorArea();
 
@@ -997,7 +1227,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::NumberOfPeople,result);
   }
 
   bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1062,6 +1292,9 @@ namespace detail {
 
 
   double Space_Impl::peoplePerFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::PeoplePerFloorArea)) {
+      return *cached;
+    }
     double result = 0.0;
     double area = floorArea();
 
@@ -1075,7 +1308,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::PeoplePerFloorArea,result);
   }
 
   bool Space_Impl::setPeoplePerFloorArea(double peoplePerFloorArea) {
@@ -1205,6 +1438,9 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::LightingPower)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1225,7 +1461,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::LightingPower,result);
   }
 
   bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1298,6 +1534,9 @@ namespace detail {
   }
 
   double Space_Impl::lightingPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::LightingPowerPerFloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1318,7 +1557,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::LightingPowerPerFloorArea,result);
   }
 
   bool Space_Impl::setLightingPowerPerFloorArea(double lightingPowerPerFloorArea) {
@@ -1392,6 +1631,9 @@ namespace detail {
   }
 
   double Space_Impl::lightingPowerPerPerson() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::LightingPowerPerPerson)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1412,7 +1654,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::LightingPowerPerPerson,result);
   }
 
   bool Space_Impl::setLightingPowerPerPerson(double lightingPowerPerPerson) {
@@ -1486,6 +1728,9 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentPower)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1500,10 +1745,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentPower,result);
   }
 
   double Space_Impl::electricEquipmentITEAirCooledPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentITEAirCooledPower)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
 
@@ -1517,7 +1765,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentITEAirCooledPower,result);
   }
 
   bool Space_Impl::setElectricEquipmentPower(double electricEquipmentPower) {
@@ -1584,6 +1832,9 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentPowerPerFloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1598,10 +1849,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentPowerPerFloorArea,result);
   }
 
   double Space_Impl::electricEquipmentITEAirCooledPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentITEAirCooledPowerPerFloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
 
@@ -1615,7 +1869,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentITEAirCooledPowerPerFloorArea,result);
   }
 
   bool Space_Impl::setElectricEquipmentPowerPerFloorArea(double electricEquipmentPowerPerFloorArea)
@@ -1683,6 +1937,9 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPowerPerPerson() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentPowerPerPerson)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1697,7 +1954,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentPowerPerPerson,result);
   }
 
   bool Space_Impl::setElectricEquipmentPowerPerPerson(double electricEquipmentPowerPerPerson) {
@@ -1765,6 +2022,9 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::GasEquipmentPower)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1779,7 +2039,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::GasEquipmentPower,result);
   }
 
   bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -1846,6 +2106,9 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPowerPerFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::GasEquipmentPowerPerFloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1860,7 +2123,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::GasEquipmentPowerPerFloorArea,result);
   }
 
   bool Space_Impl::setGasEquipmentPowerPerFloorArea(double gasEquipmentPowerPerFloorArea)
@@ -1928,6 +2191,9 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPowerPerPerson() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::GasEquipmentPowerPerPerson)) {
+      return *cached;
+    }
     double result(0.0);
     double area = floorArea();
     double numPeople = numberOfPeople();
@@ -1942,7 +2208,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::GasEquipmentPowerPerPerson,result);
   }
 
   bool Space_Impl::setGasEquipmentPowerPerPerson(double gasEquipmentPowerPerPerson) {
@@ -2010,6 +2276,9 @@ namespace detail {
   }
 
   double Space_Impl::infiltrationDesignFlowRate() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignFlowRate)) {
+      return *cached;
+    }
     double result(0.0);
     double floorArea = this->floorArea();
     double exteriorSurfaceArea = this->exteriorArea();
@@ -2032,10 +2301,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignFlowRate,result);
   }
 
   double Space_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignFlowPerSpaceFloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     double floorArea = this->floorArea();
     double exteriorSurfaceArea = this->exteriorArea();
@@ -2058,10 +2330,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignFlowPerSpaceFloorArea,result);
   }
 
   double Space_Impl::infiltrationDesignFlowPerExteriorSurfaceArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignFlowPerExteriorSurfaceArea)) {
+      return *cached;
+    }
     double result(0.0);
     double floorArea = this->floorArea();
     double exteriorSurfaceArea = this->exteriorArea();
@@ -2084,10 +2359,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignFlowPerExteriorSurfaceArea,result);
   }
 
   double Space_Impl::infiltrationDesignFlowPerExteriorWallArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignFlowPerExteriorWallArea)) {
+      return *cached;
+    }
     double result(0.0);
     double floorArea = this->floorArea();
     double exteriorSurfaceArea = this->exteriorArea();
@@ -2110,10 +2388,13 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignFlowPerExteriorWallArea,result);
   }
 
   double Space_Impl::infiltrationDesignAirChangesPerHour() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignAirChangesPerHour)) {
+      return *cached;
+    }
     double result(0.0);
     double floorArea = this->floorArea();
     double exteriorSurfaceArea = this->exteriorArea();
@@ -2136,7 +2417,7 @@ namespace detail {
       }
     }
 
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignAirChangesPerHour,result);
   }
 
   void Space_Impl::hardApplySpaceType(bool hardSizeLoads)
@@ -2290,7 +2571,33 @@ namespace detail {
     // transform from other to this coordinates
     Transformation transformation = this->transformation().inverse()*other.transformation();
 
-    for (Surface surface : this->surfaces()){
+    std::vector<Surface> otherSurfaces = other.surfaces();
+    std::vector<std::vector<Point3d> > allOtherVertices;
+    std::vector<boost::optional<Vector3d> > otherOutwardNormals;
+    std::vector<BoundingBox> otherBounds;
+    for (const Surface& otherSurface : otherSurfaces){
+      allOtherVertices.push_back(removeCollinear(transformation*otherSurface.vertices()));
+      otherOutwardNormals.push_back(getOutwardNormal(allOtherVertices.back()));
+      otherBounds.push_back(BoundingBox());
+      otherBounds.back().addPoints(allOtherVertices.back());
+    }
+
+    // matching surfaces have all vertices within tol, so only surfaces with intersecting bounding
+    // boxes need to be compared. the bounds include the sub surfaces as their vertices are
+    // compared below as well.
+    std::vector<Surface> surfaces = this->surfaces();
+    std::vector<BoundingBox> bounds;
+    for (const Surface& surface : surfaces){
+      bounds.push_back(BoundingBox());
+      bounds.back().addPoints(surface.vertices());
+      for (const SubSurface& subSurface : surface.subSurfaces()){
+        bounds.back().addPoints(subSurface.vertices());
+      }
+    }
+    std::vector<std::vector<unsigned> > candidates = intersectingBoundingBoxes(bounds, otherBounds, 2*tol);
+
+    for (unsigned i = 0; i < surfaces.size(); ++i){
+      Surface surface = surfaces[i];
 
       std::vector<Point3d> vertices = removeCollinear(surface.vertices());
 
@@ -2299,11 +2606,12 @@ namespace detail {
         continue;
       }
 
-      for (Surface otherSurface : other.surfaces()){
+      for (unsigned j : candidates[i]){
+        Surface otherSurface = otherSurfaces[j];
 
-        std::vector<Point3d> otherVertices = removeCollinear(transformation*otherSurface.vertices());
+        std::vector<Point3d> otherVertices = allOtherVertices[j];
 
-        boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
+        boost::optional<Vector3d> otherOutwardNormal = otherOutwardNormals[j];
         if (!otherOutwardNormal){
           continue;
         }
@@ -2351,92 +2659,9 @@ namespace detail {
       return;
     }
 
-    std::vector<Surface> surfaces = this->surfaces();
-    std::vector<Surface> otherSurfaces = other.surfaces();
-
-    std::sort(surfaces.begin(), surfaces.end(), [](const Surface & a, const Surface & b) -> bool {return a.grossArea() > b.grossArea(); });
-    std::sort(otherSurfaces.begin(), otherSurfaces.end(), [](const Surface & a, const Surface & b) -> bool {return a.grossArea() > b.grossArea(); });
-
-    std::map<std::string, bool> hasSubSurfaceMap;
-    std::map<std::string, bool> hasAdjacentSurfaceMap;
-    std::set<std::string> completedIntersections;
-
-    bool anyNewSurfaces = true;
-    while(anyNewSurfaces){
-
-      anyNewSurfaces = false;
-      std::vector<Surface> newSurfaces;
-      std::vector<Surface> newOtherSurfaces;
-
-      for (Surface surface : surfaces){
-        std::string surfaceHandle = toString(surface.handle());
-        if (hasSubSurfaceMap.find(surfaceHandle) == hasSubSurfaceMap.end()){
-          hasSubSurfaceMap[surfaceHandle] = !surface.subSurfaces().empty();
-          hasAdjacentSurfaceMap[surfaceHandle] = surface.adjacentSurface().has_value();
-        }
-
-        if (hasSubSurfaceMap[surfaceHandle] || hasAdjacentSurfaceMap[surfaceHandle]){
-          continue;
-        }
-
-        for (Surface otherSurface : otherSurfaces){
-          std::string otherSurfaceHandle = toString(otherSurface.handle());
-          if (hasSubSurfaceMap.find(otherSurfaceHandle) == hasSubSurfaceMap.end()){
-            hasSubSurfaceMap[otherSurfaceHandle] = !otherSurface.subSurfaces().empty();
-            hasAdjacentSurfaceMap[otherSurfaceHandle] = otherSurface.adjacentSurface().has_value();
-          }
-
-          if (hasSubSurfaceMap[otherSurfaceHandle] || hasAdjacentSurfaceMap[otherSurfaceHandle]){
-            continue;
-          }
-
-          // see if we have already tested these for intersection,
-          // surfaces that previously did not intersect will not intersect if vertices change
-          // surfaces that previously did intersect will intersect exactly
-          std::string intersectionKey = surfaceHandle + otherSurfaceHandle;
-          if (completedIntersections.find(intersectionKey) != completedIntersections.end()){
-            continue;
-          }
-          completedIntersections.insert(intersectionKey);
-
-          // number of surfaces in each space will only increase in intersect
-          boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
-          if (intersection){
-            std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
-            newSurfaces.insert(newSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
-
-            std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
-            newOtherSurfaces.insert(newOtherSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
-
-            // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
-            std::vector<Surface> ineligibleSurfaces;
-            ineligibleSurfaces.push_back(surface);
-            ineligibleSurfaces.insert(ineligibleSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
-
-            std::vector<Surface> ineligibleOtherSurfaces;
-            ineligibleOtherSurfaces.push_back(otherSurface);
-            ineligibleOtherSurfaces.insert(ineligibleOtherSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
-            for (Surface ineligibleSurface : ineligibleSurfaces){
-              for (Surface ineligibleOtherSurface : ineligibleOtherSurfaces){
-                std::string ineligibleIntersectionKey = toString(ineligibleSurface.handle()) + toString(ineligibleOtherSurface.handle()); 
-                completedIntersections.insert(ineligibleIntersectionKey);
-              }
-            }
-           
-          }
-        }
-      }
-
-      if (!newSurfaces.empty()){
-        surfaces.insert(surfaces.end(), newSurfaces.begin(), newSurfaces.end());
-        anyNewSurfaces = true;
-      }
-      if (!newOtherSurfaces.empty()){
-        otherSurfaces.insert(otherSurfaces.end(), newOtherSurfaces.begin(), newOtherSurfaces.end());
-        anyNewSurfaces = true;
-      }
-    }
-
+    SpacePairIntersection intersection(getObject<Space>(), other);
+    intersection.plan();
+    intersection.apply();
   }
 
   std::vector<Surface> Space_Impl::findSurfaces(boost::optional<double> minDegreesFromNorth,
@@ -2706,6 +2931,23 @@ namespace detail {
     OS_ASSERT(count == 1);
   }
 
+  boost::optional<double> Space_Impl::cachedQuantity(CachedQuantity quantity) const
+  {
+    unsigned long long revision = model().getImpl<Model_Impl>()->changeRevision();
+    if (m_cachedQuantitiesRevision != revision) {
+      m_cachedQuantities.fill(boost::none);
+      m_cachedQuantitiesRevision = revision;
+      return boost::none;
+    }
+    return m_cachedQuantities[static_cast<size_t>(quantity)];
+  }
+
+  double Space_Impl::cacheQuantity(CachedQuantity quantity, double value) const
+  {
+    m_cachedQuantities[static_cast<size_t>(quantity)] = value;
+    return value;
+  }
+
   std::vector<Point3d> Space_Impl::floorPrint() const
   {
     double tol = 0.01; // 1 cm tolerance
@@ -3447,24 +3689,127 @@ Space::Space(std::shared_ptr<detail::Space_Impl> impl)
 {}
 /// @endcond
 
-void intersectSurfaces(std::vector<Space>& t_spaces)
+void intersectSurfaces(std::vector<Space>& t_spaces, unsigned numThreads)
 {
-  std::vector<Space> spaces(t_spaces);	
+  std::vector<Space> spaces(t_spaces);
   std::sort(spaces.begin(), spaces.end(), [](const Space & a, const Space & b) -> bool {return a.floorArea() < b.floorArea(); });
- 
+
   std::vector<BoundingBox> bounds;
   for (const Space& space : spaces){
     bounds.push_back(space.transformation()*space.boundingBox());
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
-        continue;
+  // pairs come out in the same order as a double loop over spaces would visit them
+  std::vector<std::pair<unsigned, unsigned> > pairs;
+  for (const std::pair<unsigned, unsigned>& pair : intersectingBoundingBoxPairs(bounds)){
+    if (spaces[pair.first].handle() != spaces[pair.second].handle()){
+      pairs.push_back(pair);
+    }
+  }
+
+  if (numThreads == 0){
+    numThreads = System::numberOfProcessors();
+  }
+  numThreads = static_cast<unsigned>(std::min<std::size_t>(numThreads, pairs.size()));
+
+  if (numThreads <= 1){
+    for (const std::pair<unsigned, unsigned>& pair : pairs){
+      spaces[pair.first].intersectSurfaces(spaces[pair.second]);
+    }
+    return;
+  }
+
+  // pairs that share no space can be intersected at the same time. each pair must see the surfaces
+  // left behind by the previous pair (in the serial order) on each of its two spaces, so it is planned
+  // as soon as those have been applied. plans are applied in the serial order, which gives the same
+  // surfaces and names as the serial case.
+  unsigned numPairs = pairs.size();
+  std::vector<std::vector<unsigned> > dependentPairs(numPairs);
+  std::vector<unsigned> numDependencies(numPairs, 0);
+  std::map<Handle, unsigned> lastPair;
+  for (unsigned p = 0; p < numPairs; ++p){
+    for (unsigned i : {pairs[p].first, pairs[p].second}){
+      auto it = lastPair.find(spaces[i].handle());
+      if (it != lastPair.end()){
+        dependentPairs[it->second].push_back(p);
+        ++numDependencies[p];
+      }
+      lastPair[spaces[i].handle()] = p;
+    }
+  }
+
+  std::vector<std::unique_ptr<SpacePairIntersection> > intersections(numPairs);
+  std::vector<std::promise<void> > planned(numPairs);
+  std::deque<unsigned> readyPairs;
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool done = false;
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < numThreads; ++i){
+    workers.emplace_back([&]() {
+      while (true){
+        unsigned p;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          condition.wait(lock, [&]() { return done || !readyPairs.empty(); });
+          if (done){
+            return;
+          }
+          p = readyPairs.front();
+          readyPairs.pop_front();
+        }
+        intersections[p]->plan();
+        planned[p].set_value();
       }
-      spaces[i].intersectSurfaces(spaces[j]);
+    });
+  }
+
+  // stops the workers if anything goes wrong while applying intersections
+  auto joinWorkers = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      done = true;
     }
+    condition.notify_all();
+    for (std::thread& worker : workers){
+      worker.join();
+    }
+  };
+
+  // surfaces are read on this thread only
+  auto schedule = [&](unsigned p) {
+    intersections[p].reset(new SpacePairIntersection(spaces[pairs[p].first], spaces[pairs[p].second]));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      readyPairs.push_back(p);
+    }
+    condition.notify_one();
+  };
+
+  try {
+    for (unsigned p = 0; p < numPairs; ++p){
+      if (numDependencies[p] == 0){
+        schedule(p);
+      }
+    }
+
+    for (unsigned p = 0; p < numPairs; ++p){
+      planned[p].get_future().get();
+      intersections[p]->apply();
+      intersections[p].reset();
+
+      for (unsigned dependentPair : dependentPairs[p]){
+        if (--numDependencies[dependentPair] == 0){
+          schedule(dependentPair);
+        }
+      }
+    }
+  }catch (...){
+    joinWorkers();
+    throw;
   }
+  joinWorkers();
 }
 
 void matchSurfaces(std::vector<Space>& spaces)
@@ -3474,13 +3819,8 @@ void matchSurfaces(std::vector<Space>& spaces)
     bounds.push_back(space.transformation()*space.boundingBox());
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
-        continue;
-      }
-      spaces[i].matchSurfaces(spaces[j]);
-    }
+  for (const std::pair<unsigned, unsigned>& pair : intersectingBoundingBoxPairs(bounds)){
+    spaces[pair.first].matchSurfaces(spaces[pair.second]);
   }
 }
 
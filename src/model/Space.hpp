@@ -604,8 +604,10 @@ class MODEL_API Space : public PlanarSurfaceGroup {
   REGISTER_LOGGER("openstudio.model.Space");
 };
 
-/** Intersect surfaces within spaces. */
-MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
+/** Intersect surfaces within spaces. Spaces are intersected pairwise, pairs that share no space are
+ *  intersected on up to numThreads threads (0 uses all processors). The model is only modified on the
+ *  calling thread and the result is the same for any number of threads. */
+MODEL_API void intersectSurfaces(std::vector<Space>& spaces, unsigned numThreads = 1);
 
 /** Match surfaces and sub surfaces within spaces. */
 MODEL_API void matchSurfaces(std::vector<Space>& spaces);
@@ -37,6 +37,8 @@
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
+#include <array>
+
 namespace openstudio {
 namespace model {
 
@@ -525,6 +527,43 @@ namespace detail {
     // helper function to get a boost polygon point from a Point3d
     boost::tuple<double, double> point3dToTuple(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) const;
 
+    // Quantities derived from the surfaces and loads of the space, and of its space type. They
+    // are kept until anything in the model changes, see Workspace_Impl::changeRevision.
+    enum class CachedQuantity {
+      FloorArea,
+      ExteriorArea,
+      ExteriorWallArea,
+      Volume,
+      NumberOfPeople,
+      PeoplePerFloorArea,
+      LightingPower,
+      LightingPowerPerFloorArea,
+      LightingPowerPerPerson,
+      ElectricEquipmentPower,
+      ElectricEquipmentITEAirCooledPower,
+      ElectricEquipmentPowerPerFloorArea,
+      ElectricEquipmentITEAirCooledPowerPerFloorArea,
+      ElectricEquipmentPowerPerPerson,
+      GasEquipmentPower,
+      GasEquipmentPowerPerFloorArea,
+      GasEquipmentPowerPerPerson,
+      InfiltrationDesignFlowRate,
+      InfiltrationDesignFlowPerSpaceFloorArea,
+      InfiltrationDesignFlowPerExteriorSurfaceArea,
+      InfiltrationDesignFlowPerExteriorWallArea,
+      InfiltrationDesignAirChangesPerHour,
+      NumCachedQuantities
+    };
+
+    // Returns the cached value of quantity, if it was computed since the model last changed.
+    boost::optional<double> cachedQuantity(CachedQuantity quantity) const;
+
+    // Caches and returns value.
+    double cacheQuantity(CachedQuantity quantity, double value) const;
+
+    mutable std::array<boost::optional<double>, static_cast<size_t>(CachedQuantity::NumCachedQuantities)> m_cachedQuantities;
+    mutable unsigned long long m_cachedQuantitiesRevision = 0;
+
   };
 
 } // detail
@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "PlanarSurface_Impl.hpp"
 
+#include "../utilities/geometry/Transformation.hpp"
+
 namespace openstudio {
 namespace model {
 
@@ -51,6 +53,27 @@ class FoundationKiva;
 
 namespace detail {
 
+  /** Result of intersecting the vertices of two surfaces in different spaces. Vertices are in the
+   *  coordinates of each surface's space. */
+  struct SurfaceIntersectionGeometry {
+    /// set if the intersection could not be computed
+    std::string error;
+    /// true if the surfaces overlap
+    bool intersects = false;
+    /// area of each surface before intersection, if it could be computed
+    boost::optional<double> area1;
+    boost::optional<double> area2;
+    /// area of each surface after intersection
+    double intersectedArea1 = 0.0;
+    double intersectedArea2 = 0.0;
+    /// new vertices of each surface, empty if the surfaces already match
+    std::vector<Point3d> vertices1;
+    std::vector<Point3d> vertices2;
+    /// vertices of the surfaces split off of each surface
+    std::vector<std::vector<Point3d> > newVertices1;
+    std::vector<std::vector<Point3d> > newVertices2;
+  };
+
   /** Surface_Impl is a PlanarSurface_Impl that is the implementation class for Surface.*/
   class MODEL_API Surface_Impl : public PlanarSurface_Impl {
 
@@ -222,6 +245,17 @@ namespace detail {
     bool intersect(Surface& otherSurface);
     boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+    /** Polygon math behind computeIntersection, does not read or modify the model so it may be
+     *  called from any thread. Transformations go from each surface's space to building coordinates. */
+    static SurfaceIntersectionGeometry computeIntersectionGeometry(const std::vector<Point3d>& vertices,
+                                                                   const Transformation& spaceTransformation,
+                                                                   const std::vector<Point3d>& otherVertices,
+                                                                   const Transformation& otherSpaceTransformation);
+
+    /** Modifies this surface and otherSurface and creates new surfaces as computed by
+     *  computeIntersectionGeometry for their current vertices. */
+    boost::optional<SurfaceIntersection> applyIntersectionGeometry(Surface& otherSurface, const SurfaceIntersectionGeometry& geometry);
+
     boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
     bool isPartOfEnvelope() const;
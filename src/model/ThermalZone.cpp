@@ -967,43 +967,58 @@ namespace detail {
   }
 
   double ThermalZone_Impl::floorArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::FloorArea)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.floorArea();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::FloorArea,result);
   }
 
   double ThermalZone_Impl::exteriorSurfaceArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ExteriorSurfaceArea)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.exteriorArea();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::ExteriorSurfaceArea,result);
   }
 
   double ThermalZone_Impl::exteriorWallArea() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ExteriorWallArea)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.exteriorWallArea();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::ExteriorWallArea,result);
   }
 
   double ThermalZone_Impl::airVolume() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::AirVolume)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.volume();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::AirVolume,result);
   }
 
   double ThermalZone_Impl::numberOfPeople() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::NumberOfPeople)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.numberOfPeople();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::NumberOfPeople,result);
   }
 
   double ThermalZone_Impl::peoplePerFloorArea() const {
@@ -1034,11 +1049,14 @@ namespace detail {
   }
 
   double ThermalZone_Impl::lightingPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::LightingPower)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.lightingPower();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::LightingPower,result);
   }
 
   double ThermalZone_Impl::lightingPowerPerFloorArea() const {
@@ -1072,11 +1090,14 @@ namespace detail {
   }
 
   double ThermalZone_Impl::electricEquipmentPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::ElectricEquipmentPower)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.electricEquipmentPower();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::ElectricEquipmentPower,result);
   }
 
   double ThermalZone_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -1110,11 +1131,14 @@ namespace detail {
   }
 
   double ThermalZone_Impl::gasEquipmentPower() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::GasEquipmentPower)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()){
       result += space.gasEquipmentPower();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::GasEquipmentPower,result);
   }
 
   double ThermalZone_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -1148,11 +1172,14 @@ namespace detail {
   }
 
   double ThermalZone_Impl::infiltrationDesignFlowRate() const {
+    if (boost::optional<double> cached = cachedQuantity(CachedQuantity::InfiltrationDesignFlowRate)) {
+      return *cached;
+    }
     double result(0.0);
     for (const Space& space : spaces()) {
       result += space.infiltrationDesignFlowRate();
     }
-    return result;
+    return cacheQuantity(CachedQuantity::InfiltrationDesignFlowRate,result);
   }
 
   double ThermalZone_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -1215,6 +1242,23 @@ namespace detail {
     return (idfr/volume) * 3600.0;
   }
 
+  boost::optional<double> ThermalZone_Impl::cachedQuantity(CachedQuantity quantity) const
+  {
+    unsigned long long revision = model().getImpl<Model_Impl>()->changeRevision();
+    if (m_cachedQuantitiesRevision != revision) {
+      m_cachedQuantities.fill(boost::none);
+      m_cachedQuantitiesRevision = revision;
+      return boost::none;
+    }
+    return m_cachedQuantities[static_cast<size_t>(quantity)];
+  }
+
+  double ThermalZone_Impl::cacheQuantity(CachedQuantity quantity, double value) const
+  {
+    m_cachedQuantities[static_cast<size_t>(quantity)] = value;
+    return value;
+  }
+
   boost::optional<std::string> ThermalZone_Impl::isConditioned() const {
     boost::optional<std::string> result;
 
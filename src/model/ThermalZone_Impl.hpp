@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "HVACComponent_Impl.hpp"
 
+#include <array>
+
 
 namespace openstudio {
 namespace model {
@@ -456,6 +458,30 @@ namespace detail {
     bool setSecondaryDaylightingControlAsModelObject(const boost::optional<ModelObject>& modelObject);
     bool setIlluminanceMapAsModelObject(const boost::optional<ModelObject>& modelObject);
     bool setRenderingColorAsModelObject(const boost::optional<ModelObject>& modelObject);
+
+    // Sums over the spaces of the zone, see Space_Impl::cachedQuantity. They are kept until
+    // anything in the model changes, see Workspace_Impl::changeRevision.
+    enum class CachedQuantity {
+      FloorArea,
+      ExteriorSurfaceArea,
+      ExteriorWallArea,
+      AirVolume,
+      NumberOfPeople,
+      LightingPower,
+      ElectricEquipmentPower,
+      GasEquipmentPower,
+      InfiltrationDesignFlowRate,
+      NumCachedQuantities
+    };
+
+    // Returns the cached value of quantity, if it was computed since the model last changed.
+    boost::optional<double> cachedQuantity(CachedQuantity quantity) const;
+
+    // Caches and returns value.
+    double cacheQuantity(CachedQuantity quantity, double value) const;
+
+    mutable std::array<boost::optional<double>, static_cast<size_t>(CachedQuantity::NumCachedQuantities)> m_cachedQuantities;
+    mutable unsigned long long m_cachedQuantitiesRevision = 0;
   };
 
 } // detail
@@ -47,6 +47,10 @@
 #include "../FanConstantVolume.hpp"
 #include "../CoilHeatingElectric.hpp"
 #include "../CoilCoolingDXSingleSpeed.hpp"
+#include "../PlantLoop.hpp"
+#include "../PipeAdiabatic.hpp"
+
+#include <chrono>
 
 using namespace openstudio::model;
 
@@ -120,3 +124,67 @@ TEST_F(ModelFixture,Loop_DeleteUnitaryVAVChangeoverBypassAirLoopHVAC)
   EXPECT_EQ(3, inletComponents.size());
 
 }
+
+TEST_F(ModelFixture,Loop_TopologyCache)
+{
+  Model model = Model();
+
+  PlantLoop plantLoop(model);
+  std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  unsigned numPipes = plantLoop.demandComponents(PipeAdiabatic::iddObjectType()).size();
+
+  // queries answered from the cached topology match
+  EXPECT_EQ(demandComponents, plantLoop.demandComponents());
+
+  // adding a branch invalidates the topology, the first branch reuses the empty branch node
+  PipeAdiabatic pipe1(model);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(pipe1));
+  EXPECT_EQ(numPipes + 1, plantLoop.demandComponents(PipeAdiabatic::iddObjectType()).size());
+  EXPECT_EQ(demandComponents.size() + 2, plantLoop.demandComponents().size());
+  EXPECT_TRUE(plantLoop.demandComponent(pipe1.handle()));
+  EXPECT_FALSE(plantLoop.supplyComponent(pipe1.handle()));
+
+  // so does adding a component in series on that branch
+  PipeAdiabatic pipe2(model);
+  Node outletNode = pipe1.outletModelObject()->cast<Node>();
+  EXPECT_TRUE(pipe2.addToNode(outletNode));
+  std::vector<ModelObject> branch = plantLoop.demandComponents(pipe1, pipe2);
+  ASSERT_EQ(3u, branch.size());
+  EXPECT_EQ(pipe1, branch[0]);
+  EXPECT_EQ(pipe2, branch[2]);
+  EXPECT_EQ(1u, plantLoop.demandComponents(pipe1, pipe2, Node::iddObjectType()).size());
+
+  // and removing it
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(pipe1));
+  EXPECT_EQ(numPipes, plantLoop.demandComponents(PipeAdiabatic::iddObjectType()).size());
+  EXPECT_EQ(demandComponents.size(), plantLoop.demandComponents().size());
+}
+
+TEST_F(ModelFixture,DISABLED_Loop_TopologyCache_Benchmark)
+{
+  Model model = Model();
+
+  PlantLoop plantLoop(model);
+  unsigned numPipes = plantLoop.demandComponents(PipeAdiabatic::iddObjectType()).size();
+  for (unsigned i = 0; i < 500; ++i) {
+    PipeAdiabatic pipe(model);
+    EXPECT_TRUE(plantLoop.addDemandBranchForComponent(pipe));
+    Node node = pipe.outletModelObject()->cast<Node>();
+    PipeAdiabatic pipe2(model);
+    EXPECT_TRUE(pipe2.addToNode(node));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::size_t n = plantLoop.demandComponents().size();
+  std::chrono::duration<double> firstTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < 100; ++i) {
+    EXPECT_EQ(n, plantLoop.demandComponents().size());
+    EXPECT_EQ(numPipes + 1000u, plantLoop.demandComponents(PipeAdiabatic::iddObjectType()).size());
+  }
+  std::chrono::duration<double> cachedTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << "components " << n << " first query " << firstTime.count() << "s 200 cached queries "
+            << cachedTime.count() << "s" << std::endl;
+}
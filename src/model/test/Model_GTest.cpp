@@ -74,6 +74,18 @@
 #include "../FanConstantVolume_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../AirLoopHVAC_Impl.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../InteriorPartitionSurface.hpp"
+#include "../InteriorPartitionSurface_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
+#include "../Schedule.hpp"
+#include "../Schedule_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
 
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
@@ -86,6 +98,8 @@
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <chrono>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -748,3 +762,94 @@ TEST_F(ModelFixture,Model_BadSwaps) {
   EXPECT_ANY_THROW(workspace.swap(model));
   EXPECT_ANY_THROW(model.swap(workspace));
 }
+
+namespace {
+
+  // getModelObjects<T> the way it was done before Model_Impl::getObjectsByImplType, by casting
+  // every object in the model
+  template <typename T>
+  std::vector<T> getModelObjectsByScan(const Model& model) {
+    std::vector<T> result;
+    for (const WorkspaceObject& object : model.objects()) {
+      if (boost::optional<T> candidate = object.optionalCast<T>()) {
+        result.push_back(*candidate);
+      }
+    }
+    return result;
+  }
+
+  template <typename T>
+  void checkGetModelObjects(const Model& model, const std::string& typeName) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<T> scanned;
+    for (int i = 0; i < 10; ++i) {
+      scanned = getModelObjectsByScan<T>(model);
+    }
+    std::chrono::duration<double, std::milli> scanTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<T> indexed;
+    for (int i = 0; i < 10; ++i) {
+      indexed = model.getModelObjects<T>();
+    }
+    std::chrono::duration<double, std::milli> indexTime = std::chrono::steady_clock::now() - start;
+
+    LOG_FREE(Info, "ModelFixture", "10 x getModelObjects<" << typeName << ">() on " << model.numObjects() << " objects: "
+             << scanTime.count() << " ms scanning, " << indexTime.count() << " ms indexed, " << indexed.size() << " objects found.");
+
+    std::set<Handle> expected;
+    for (const T& object : scanned) {
+      expected.insert(object.handle());
+    }
+    std::set<Handle> actual;
+    for (const T& object : indexed) {
+      actual.insert(object.handle());
+    }
+    EXPECT_EQ(scanned.size(), indexed.size()) << typeName;
+    EXPECT_TRUE(expected == actual) << typeName;
+  }
+
+}
+
+TEST_F(ModelFixture, Model_GetModelObjects_TypeIndex) {
+  Model model = exampleModel();
+
+  // grow the example into a larger building
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  for (int i = 0; i < 50; ++i) {
+    for (const Space& space : spaces) {
+      space.clone(model);
+    }
+  }
+
+  checkGetModelObjects<ModelObject>(model, "ModelObject");
+  checkGetModelObjects<ParentObject>(model, "ParentObject");
+  checkGetModelObjects<ResourceObject>(model, "ResourceObject");
+  checkGetModelObjects<PlanarSurface>(model, "PlanarSurface");
+  checkGetModelObjects<SpaceLoad>(model, "SpaceLoad");
+  checkGetModelObjects<Schedule>(model, "Schedule");
+  checkGetModelObjects<HVACComponent>(model, "HVACComponent");
+  checkGetModelObjects<Space>(model, "Space");
+
+  // the version object is not a ModelObject returned by getModelObjects
+  for (const ModelObject& object : model.getModelObjects<ModelObject>()) {
+    EXPECT_NE(IddObjectType(IddObjectType::OS_Version), object.iddObject().type());
+  }
+
+  // types added after the index was first used are picked up
+  EXPECT_TRUE(model.getConcreteModelObjects<InteriorPartitionSurface>().empty());
+  unsigned numPlanarSurfaces = model.getModelObjects<PlanarSurface>().size();
+  std::vector<Point3d> vertices;
+  vertices.push_back(Point3d(0, 0, 1));
+  vertices.push_back(Point3d(0, 0, 0));
+  vertices.push_back(Point3d(1, 0, 0));
+  vertices.push_back(Point3d(1, 0, 1));
+  InteriorPartitionSurface partition(vertices, model);
+  EXPECT_EQ(numPlanarSurfaces + 1, model.getModelObjects<PlanarSurface>().size());
+  checkGetModelObjects<PlanarSurface>(model, "PlanarSurface");
+
+  // and removed objects are not
+  partition.remove();
+  EXPECT_EQ(numPlanarSurfaces, model.getModelObjects<PlanarSurface>().size());
+}
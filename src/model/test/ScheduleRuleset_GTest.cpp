@@ -42,11 +42,16 @@
 #include "../RunPeriodControlSpecialDays_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
 #include "../ScheduleTypeLimits_Impl.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleConstant_Impl.hpp"
 
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
 
+#include <chrono>
+#include <iostream>
+
 using namespace openstudio::model;
 using namespace openstudio;
 
@@ -838,6 +843,125 @@ TEST_F(ModelFixture, ScheduleRuleset_DesignDays)
   EXPECT_FALSE(summerSchedule.handle().isNull());
 }
 
+TEST_F(ModelFixture, ScheduleRuleset_AnnualValues)
+{
+  Model model;
+
+  model::YearDescription yd = model.getUniqueModelObject<model::YearDescription>();
+  yd.setCalendarYear(2009);
+
+  ScheduleRuleset schedule(model);
+  schedule.defaultDaySchedule().addValue(Time(0, 8), 0.1);
+  schedule.defaultDaySchedule().addValue(Time(0, 18), 0.9);
+  schedule.defaultDaySchedule().addValue(Time(0, 24), 0.2);
+
+  ScheduleRule weekendRule(schedule);
+  weekendRule.setApplySunday(true);
+  weekendRule.setApplySaturday(true);
+  weekendRule.daySchedule().setInterpolatetoTimestep(true);
+  weekendRule.daySchedule().addValue(Time(0, 12), 0.0);
+  weekendRule.daySchedule().addValue(Time(0, 24), 1.0);
+
+  Date jan1 = yd.makeDate(MonthOfYear::Jan, 1);
+  Date dec31 = yd.makeDate(MonthOfYear::Dec, 31);
+
+  // every timestep matches the day schedule in effect that day
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(jan1, dec31);
+  ASSERT_EQ(365u, daySchedules.size());
+  std::vector<double> values = schedule.annualValues(Time(0, 0, 15));
+  ASSERT_EQ(365u * 96u, values.size());
+  for (unsigned i = 0; i < 365u; ++i){
+    for (unsigned j = 0; j < 96u; ++j){
+      EXPECT_DOUBLE_EQ(daySchedules[i].getValue(Time(0, 0, 15 * (j + 1))), values[96 * i + j]);
+    }
+  }
+
+  // Jan 3 2009 is a Saturday
+  EXPECT_DOUBLE_EQ(0.1, values[0]);
+  EXPECT_DOUBLE_EQ(0.9, values[40]);
+  EXPECT_DOUBLE_EQ(0.2, values[95]);
+  EXPECT_DOUBLE_EQ(0.0, values[2 * 96 + 47]);
+  EXPECT_DOUBLE_EQ(0.5, values[2 * 96 + 71]);
+  EXPECT_DOUBLE_EQ(1.0, values[2 * 96 + 95]);
+
+  // hourly values of the same schedule
+  values = schedule.annualValues(Time(0, 1));
+  ASSERT_EQ(365u * 24u, values.size());
+  EXPECT_DOUBLE_EQ(0.1, values[7]);
+  EXPECT_DOUBLE_EQ(0.9, values[8]);
+
+  // changes to a day schedule are picked up
+  schedule.defaultDaySchedule().addValue(Time(0, 8), 0.3);
+  values = schedule.annualValues(Time(0, 1));
+  ASSERT_EQ(365u * 24u, values.size());
+  EXPECT_DOUBLE_EQ(0.3, values[7]);
+  EXPECT_DOUBLE_EQ(0.3, schedule.defaultDaySchedule().timestepValues(Time(0, 1))[7]);
+
+  // as are changes to the rules
+  weekendRule.setApplySaturday(false);
+  values = schedule.annualValues(Time(0, 1));
+  ASSERT_EQ(365u * 24u, values.size());
+  EXPECT_DOUBLE_EQ(0.3, values[2 * 24]);
+
+  // a timestep that does not divide a day
+  EXPECT_TRUE(schedule.annualValues(Time(0, 0, 7)).empty());
+
+  // many schedules at once
+  ScheduleConstant constant(model);
+  constant.setValue(0.7);
+  std::vector<ScheduleBase> schedules{schedule, constant, schedule.defaultDaySchedule()};
+  std::vector<std::vector<double> > allValues = annualScheduleValues(schedules, Time(0, 1));
+  ASSERT_EQ(3u, allValues.size());
+  EXPECT_EQ(values, allValues[0]);
+  EXPECT_EQ(std::vector<double>(365u * 24u, 0.7), allValues[1]);
+  ASSERT_EQ(365u * 24u, allValues[2].size());
+  EXPECT_DOUBLE_EQ(0.3, allValues[2][2 * 24]);
+}
+
+TEST_F(ModelFixture, DISABLED_ScheduleRuleset_AnnualValues_Benchmark)
+{
+  Model model;
+
+  std::vector<ScheduleBase> schedules;
+  for (unsigned i = 0; i < 100; ++i){
+    ScheduleRuleset schedule(model);
+    for (unsigned hour = 1; hour <= 24; ++hour){
+      schedule.defaultDaySchedule().addValue(Time(0, hour), 0.01 * (i + hour));
+    }
+    ScheduleRule weekendRule(schedule);
+    weekendRule.setApplySunday(true);
+    weekendRule.setApplySaturday(true);
+    weekendRule.daySchedule().addValue(Time(0, 24), 0.5);
+    schedules.push_back(schedule);
+  }
+
+  std::chrono::time_point<std::chrono::high_resolution_clock> start = std::chrono::high_resolution_clock::now();
+  double total = 0;
+  for (const ScheduleBase& schedule : schedules){
+    ScheduleRuleset ruleset = schedule.cast<ScheduleRuleset>();
+    for (const ScheduleDay& daySchedule : ruleset.getDaySchedules(Date(MonthOfYear::Jan, 1), Date(MonthOfYear::Dec, 31))){
+      for (unsigned j = 1; j <= 96; ++j){
+        total += daySchedule.getValue(Time(0, 0, 15 * j));
+      }
+    }
+  }
+  std::chrono::time_point<std::chrono::high_resolution_clock> end = std::chrono::high_resolution_clock::now();
+  std::cout << "getValue: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+  start = std::chrono::high_resolution_clock::now();
+  std::vector<std::vector<double> > allValues = annualScheduleValues(schedules, Time(0, 0, 15));
+  end = std::chrono::high_resolution_clock::now();
+  std::cout << "annualScheduleValues: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+
+  double annualTotal = 0;
+  for (const std::vector<double>& values : allValues){
+    for (double value : values){
+      annualTotal += value;
+    }
+  }
+  EXPECT_NEAR(total, annualTotal, 1.0e-6 * total);
+}
+
 /*
 January
 
@@ -71,6 +71,7 @@
 #include "../../utilities/idf/WorkspaceObjectWatcher.hpp"
 #include "../../utilities/core/Compare.hpp"
 
+#include <chrono>
 #include <iostream>
 
 using namespace openstudio;
@@ -255,6 +256,59 @@ TEST_F(ModelFixture, Space_FloorArea)
   EXPECT_NEAR(6, space.floorArea(), 0.0001);
 }
 
+TEST_F(ModelFixture, Space_CachedQuantities)
+{
+  Model model;
+  Space space1(model);
+  Space space2(model);
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(space1.setThermalZone(thermalZone));
+  EXPECT_TRUE(space2.setThermalZone(thermalZone));
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 10, 0));
+  points.push_back(Point3d(10, 10, 0));
+  points.push_back(Point3d(10, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor(points, model);
+  floor.setParent(space1);
+  EXPECT_NEAR(100, space1.floorArea(), 0.0001);
+  EXPECT_NEAR(100, thermalZone.floorArea(), 0.0001);
+
+  // changes to the model are seen by the next query
+  unsigned long long revision = model.getImpl<openstudio::model::detail::Model_Impl>()->changeRevision();
+  points[0] = Point3d(0, 20, 0);
+  points[1] = Point3d(10, 20, 0);
+  EXPECT_TRUE(floor.setVertices(points));
+  EXPECT_NE(revision, model.getImpl<openstudio::model::detail::Model_Impl>()->changeRevision());
+  EXPECT_NEAR(200, space1.floorArea(), 0.0001);
+  EXPECT_NEAR(200, thermalZone.floorArea(), 0.0001);
+
+  floor.setParent(space2);
+  EXPECT_EQ(0, space1.floorArea());
+  EXPECT_NEAR(200, space2.floorArea(), 0.0001);
+  EXPECT_NEAR(200, thermalZone.floorArea(), 0.0001);
+
+  // loads of the space type
+  SpaceType spaceType(model);
+  LightsDefinition definition(model);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(1));
+  Lights lights(definition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_EQ(0, space2.lightingPower());
+  EXPECT_TRUE(space2.setSpaceType(spaceType));
+  EXPECT_NEAR(200, space2.lightingPower(), 0.0001);
+  EXPECT_NEAR(200, thermalZone.lightingPower(), 0.0001);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(2));
+  EXPECT_NEAR(400, space2.lightingPower(), 0.0001);
+  EXPECT_NEAR(400, thermalZone.lightingPower(), 0.0001);
+
+  floor.remove();
+  EXPECT_EQ(0, space2.floorArea());
+  EXPECT_EQ(0, space2.lightingPower());
+  EXPECT_EQ(0, thermalZone.floorArea());
+}
+
 TEST_F(ModelFixture, Space_ThermalZone)
 {
   Model model;
@@ -1996,4 +2050,135 @@ TEST_F(ModelFixture, Space_intersectSurfaces_degenerate3) {
   //EXPECT_NEAR(interiorRoofArea, 412.9019, 0.01);
 
   //m.save("intersect3.osm", true);
-}
\ No newline at end of file
+}
+
+namespace {
+
+  // grid of 3 m x 3 m x 3 m spaces, odd columns are shifted 1.5 m along y so that intersection has work to do
+  void addStaggeredGrid(Model& model, int nx, int ny, int nz)
+  {
+    Point3dVector floorPrint;
+    floorPrint.push_back(Point3d(0, 3, 0));
+    floorPrint.push_back(Point3d(3, 3, 0));
+    floorPrint.push_back(Point3d(3, 0, 0));
+    floorPrint.push_back(Point3d(0, 0, 0));
+
+    for (int i = 0; i < nx; ++i){
+      for (int j = 0; j < ny; ++j){
+        for (int k = 0; k < nz; ++k){
+          boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+          ASSERT_TRUE(space);
+          space->setXOrigin(3*i);
+          space->setYOrigin(3*j + ((i % 2 == 0) ? 0.0 : 1.5));
+          space->setZOrigin(3*k);
+        }
+      }
+    }
+  }
+
+  // space name -> (surface name, vertices) sorted by surface name
+  std::map<std::string, std::vector<std::pair<std::string, std::vector<Point3d> > > > surfacesBySpace(const Model& model)
+  {
+    std::map<std::string, std::vector<std::pair<std::string, std::vector<Point3d> > > > result;
+    for (const Space& space : model.getConcreteModelObjects<Space>()){
+      std::vector<std::pair<std::string, std::vector<Point3d> > >& surfaces = result[space.nameString()];
+      for (const Surface& surface : space.surfaces()){
+        surfaces.push_back(std::make_pair(surface.nameString(), surface.vertices()));
+      }
+      std::sort(surfaces.begin(), surfaces.end(), [](const std::pair<std::string, std::vector<Point3d> >& a,
+                                                     const std::pair<std::string, std::vector<Point3d> >& b) { return a.first < b.first; });
+    }
+    return result;
+  }
+
+}
+
+TEST_F(ModelFixture, Space_IntersectAndMatch_Scaling)
+{
+  std::vector<std::vector<int> > grids = {{10, 10, 1}, {10, 10, 10}};
+  for (const std::vector<int>& grid : grids){
+    Model model;
+    addStaggeredGrid(model, grid[0], grid[1], grid[2]);
+
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+
+    auto start = std::chrono::steady_clock::now();
+    intersectSurfaces(spaces);
+    std::chrono::duration<double, std::milli> intersectTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    matchSurfaces(spaces);
+    std::chrono::duration<double, std::milli> matchTime = std::chrono::steady_clock::now() - start;
+
+    LOG(Info, spaces.size() << " spaces: intersectSurfaces took " << intersectTime.count() << " ms, matchSurfaces took "
+        << matchTime.count() << " ms.");
+
+    // every surface is either matched or on the outside of the grid
+    unsigned numMatched = 0;
+    double exteriorArea = 0;
+    for (const Surface& surface : model.getConcreteModelObjects<Surface>()){
+      if (surface.adjacentSurface()){
+        ++numMatched;
+        EXPECT_EQ(surface.handle(), surface.adjacentSurface()->adjacentSurface()->handle());
+      }
+      else{
+        exteriorArea += surface.grossArea();
+      }
+    }
+    EXPECT_EQ(0u, numMatched % 2);
+    EXPECT_LT(0u, numMatched);
+
+    // exterior of the staggered grid: roofs and floors, the two long sides, and the ends of the
+    // columns (offset columns stick out 1.5 m at each end)
+    double nx = grid[0];
+    double ny = grid[1];
+    double nz = grid[2];
+    double expectedExteriorArea = 2*9*nx*ny + 2*3*3*nz*ny + 2*3*3*nz*nx + 2*3*1.5*nz*(nx - 1);
+    EXPECT_NEAR(expectedExteriorArea, exteriorArea, 0.01);
+  }
+}
+
+TEST_F(ModelFixture, Space_IntersectSurfaces_Threads)
+{
+  Model serialModel;
+  addStaggeredGrid(serialModel, 6, 6, 3);
+  std::vector<Space> serialSpaces = serialModel.getConcreteModelObjects<Space>();
+
+  auto start = std::chrono::steady_clock::now();
+  intersectSurfaces(serialSpaces);
+  std::chrono::duration<double, std::milli> serialTime = std::chrono::steady_clock::now() - start;
+
+  auto expected = surfacesBySpace(serialModel);
+  EXPECT_EQ(108u, expected.size());
+  EXPECT_LT(108u*6u, serialModel.getConcreteModelObjects<Surface>().size());
+
+  for (unsigned numThreads : {4u, 0u}){
+    Model model;
+    addStaggeredGrid(model, 6, 6, 3);
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+
+    start = std::chrono::steady_clock::now();
+    intersectSurfaces(spaces, numThreads);
+    std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+    LOG(Info, "intersectSurfaces took " << serialTime.count() << " ms serially and " << time.count()
+        << " ms with numThreads = " << numThreads << ".");
+
+    // same surface names and bit-identical vertices
+    auto actual = surfacesBySpace(model);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (const auto& space : expected){
+      const auto& actualSurfaces = actual[space.first];
+      ASSERT_EQ(space.second.size(), actualSurfaces.size()) << space.first;
+      for (unsigned i = 0; i < space.second.size(); ++i){
+        EXPECT_EQ(space.second[i].first, actualSurfaces[i].first);
+        ASSERT_EQ(space.second[i].second.size(), actualSurfaces[i].second.size());
+        for (unsigned j = 0; j < space.second[i].second.size(); ++j){
+          EXPECT_EQ(space.second[i].second[j].x(), actualSurfaces[i].second[j].x());
+          EXPECT_EQ(space.second[i].second[j].y(), actualSurfaces[i].second[j].y());
+          EXPECT_EQ(space.second[i].second[j].z(), actualSurfaces[i].second[j].z());
+        }
+      }
+    }
+  }
+}
@@ -617,7 +617,8 @@ void VersionTranslator::update(const VersionString& startVersion) {
   std::map<VersionString, IdfFile>::const_iterator start = m_map.find(startVersion);
   if (start != m_map.end()) {
 
-    std::string translatedIdf;
+    UpdateStream translated;
+    bool updated = false;
     VersionString lastVersion("0.0.0");
     boost::optional<IddFileAndFactoryWrapper> oIddFile;
     for (std::map<VersionString, OSVersionUpdater>::const_iterator it = m_updateMethods.begin(),
@@ -628,28 +629,22 @@ void VersionTranslator::update(const VersionString& startVersion) {
       lastVersion = it->first;
       if (startVersion < it->first) {
         oIddFile = getIddFile(it->first);
-        translatedIdf = it->second(this,start->second,*oIddFile);
+        translated = it->second(this,start->second,*oIddFile);
+        updated = true;
         break;
       }
     }
 
-    if (translatedIdf.empty()) {
+    if (!updated) {
       LOG(Error,"Unable to complete translation from " << startVersion.str() << " to "
           << lastVersion.str() << ". Unable to find and execute the appropriate update method.");
       return;
     }
-    std::stringstream ss(translatedIdf);
-    OptionalIdfFile oIdfFile;
-    if (oIddFile->iddFileType() == IddFileType::UserCustom) {
-      oIdfFile = IdfFile::load(ss,oIddFile->iddFile());
-    }
-    else {
-      oIdfFile = IdfFile::load(ss,oIddFile->iddFileType());
-    }
+    OptionalIdfFile oIdfFile = translated.toIdfFile(*oIddFile);
     if (!oIdfFile) {
       LOG(Error,"Unable to complete translation from " << startVersion.str()
           << " to " << lastVersion.str() << ". Could not load translated IDF using the "
-          << "latter version's IddFile. Translated text: " << std::endl << translatedIdf);
+          << "latter version's IddFile. Translated text: " << std::endl << translated.text());
       return;
     }
     IdfFile idfFile = *oIdfFile;
@@ -659,11 +654,136 @@ void VersionTranslator::update(const VersionString& startVersion) {
   }
 }
 
-std::string VersionTranslator::defaultUpdate(const IdfFile& idf,
+VersionTranslator::UpdateStream::UpdateStream(UpdateStream&& other)
+  : std::stringstream(std::move(other)),
+    m_textBefore(std::move(other.m_textBefore)),
+    m_objects(std::move(other.m_objects))
+{}
+
+VersionTranslator::UpdateStream& VersionTranslator::UpdateStream::operator=(UpdateStream&& other) {
+  std::stringstream::operator=(std::move(other));
+  m_textBefore = std::move(other.m_textBefore);
+  m_objects = std::move(other.m_objects);
+  return *this;
+}
+
+void VersionTranslator::UpdateStream::append(const IdfObject& object) {
+  m_textBefore.push_back(str());
+  str(std::string());
+  m_objects.push_back(object);
+}
+
+std::string VersionTranslator::UpdateStream::text() const {
+  std::stringstream ss;
+  for (unsigned i = 0, n = m_objects.size(); i < n; ++i) {
+    ss << m_textBefore[i] << m_objects[i];
+  }
+  ss << str();
+  return ss.str();
+}
+
+boost::optional<IdfFile> VersionTranslator::UpdateStream::toIdfFile(const IddFileAndFactoryWrapper& targetIdd) const {
+  if (OptionalIdfFile result = toIdfFileInMemory(targetIdd)) {
+    return result;
+  }
+
+  std::stringstream ss(text());
+  if (targetIdd.iddFileType() == IddFileType::UserCustom) {
+    return IdfFile::load(ss,targetIdd.iddFile());
+  }
+  return IdfFile::load(ss,targetIdd.iddFileType());
+}
+
+boost::optional<IdfFile> VersionTranslator::UpdateStream::toIdfFileInMemory(const IddFileAndFactoryWrapper& targetIdd) const {
+  auto isBlank = [](const std::string& text) {
+    return text.find_first_not_of(" \t\n\v\f\r") == std::string::npos;
+  };
+
+  // the only text allowed is the header, before the first object, which must read back as a
+  // single comment block
+  std::string header = m_objects.empty() ? str() : m_textBefore[0];
+  boost::trim(header);
+  if (!header.empty()) {
+    // it is only read back as the header if a blank line follows it
+    std::string text = m_objects.empty() ? str() : m_textBefore[0];
+    std::string::size_type end = text.find_last_not_of(" \t\n\v\f\r");
+    if (std::count(text.begin() + end + 1,text.end(),'\n') < 2) {
+      return boost::none;
+    }
+    std::stringstream headerLines(header);
+    std::string line;
+    while (std::getline(headerLines,line)) {
+      boost::trim(line);
+      if (line.empty() || (line[0] != '!')) {
+        return boost::none;
+      }
+    }
+  }
+  for (unsigned i = 1, n = m_textBefore.size(); i < n; ++i) {
+    if (!isBlank(m_textBefore[i])) {
+      return boost::none;
+    }
+  }
+  if (!m_objects.empty() && !isBlank(str())) {
+    return boost::none;
+  }
+
+  IdfFile result = (targetIdd.iddFileType() == IddFileType::UserCustom) ?
+                   IdfFile(targetIdd.iddFile()) : IdfFile(targetIdd.iddFileType());
+  if (OptionalIdfObject versionObject = result.versionObject()) {
+    // the update method streams in its own
+    result.removeObject(*versionObject);
+  }
+  if (!header.empty()) {
+    result.setHeader(header);
+  }
+
+  // objects whose types are unknown to targetIdd would become Catchall objects, leave that to
+  // the text. IddObject lookups are done once per type.
+  std::map<std::string, OptionalIddObject> iddObjects;
+  int numObjects = 0;
+  for (const IdfObject& object : m_objects) {
+    std::string objectType = object.iddObject().name();
+    auto it = iddObjects.find(objectType);
+    if (it == iddObjects.end()) {
+      it = iddObjects.insert(std::make_pair(objectType,targetIdd.getObject(objectType))).first;
+    }
+    if (!it->second || (it->second->type() == IddObjectType::Catchall)) {
+      return boost::none;
+    }
+
+    if (it->second->type() == IddObjectType::CommentOnly) {
+      if (boost::trim_copy(object.comment()).empty()) {
+        // prints as nothing at all
+        continue;
+      }
+      if (header.empty() && (result.numObjects() == 0)) {
+        // would be read back as the header
+        return boost::none;
+      }
+    }
+    else {
+      ++numObjects;
+    }
+
+    OptionalIdfObject translated = IdfObject::load(object,*it->second);
+    if (!translated) {
+      return boost::none;
+    }
+    result.addObject(*translated);
+  }
+
+  if (numObjects == 0) {
+    return boost::none;
+  }
+  return result;
+}
+
+VersionTranslator::UpdateStream VersionTranslator::defaultUpdate(const IdfFile& idf,
                                              const IddFileAndFactoryWrapper& targetIdd)
 {
   // use for version increments with no IDD changes
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf.header() << std::endl << std::endl;
 
@@ -676,12 +796,12 @@ std::string VersionTranslator::defaultUpdate(const IdfFile& idf,
     ss << object;
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
+VersionTranslator::UpdateStream VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
   // Url field refinements
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_7_1.header() << std::endl << std::endl;
 
@@ -705,7 +825,7 @@ std::string VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, c
     ss << toPrint;
   }
 
-  return ss.str();
+  return ss;
 }
 
 IdfObject VersionTranslator::updateUrlField_0_7_1_to_0_7_2(const IdfObject& object, unsigned index) {
@@ -729,9 +849,9 @@ IdfObject VersionTranslator::updateUrlField_0_7_1_to_0_7_2(const IdfObject& obje
   return result;
 }
 
-std::string VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
+VersionTranslator::UpdateStream VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
   // use for version increments with no IDD changes
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_7_2.header() << std::endl << std::endl;
 
@@ -749,11 +869,11 @@ std::string VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, c
     ss << object;
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
+  UpdateStream ss;
   IddObject componentDataIdd = idd_0_7_4.getObject("OS:ComponentData").get();
   IdfObject componentDataIdf(componentDataIdd);
   int fs = IdfObject::printedFieldSpace();
@@ -968,7 +1088,7 @@ std::string VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, c
     ss << objectSS.str();
   }
 
-  return ss.str();
+  return ss;
 }
 
 std::vector< std::shared_ptr<VersionTranslator::InterobjectIssueInformation> >
@@ -1368,10 +1488,10 @@ void VersionTranslator::fixInterobjectIssuesStage2_0_8_3_to_0_8_4(
 
 }
 
-std::string VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2)
+VersionTranslator::UpdateStream VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2)
 {
   // use for version increments with no IDD changes
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_9_1.header() << std::endl << std::endl;
 
@@ -1584,10 +1704,10 @@ std::string VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6)
+VersionTranslator::UpdateStream VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6)
 {
   // if multiple OS:RunPeriod objects remove them all
   bool skipRunPeriods = false;
@@ -1608,7 +1728,7 @@ std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, c
   }
 
   // use for version increments with no IDD changes
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_9_5.header() << std::endl << std::endl;
 
@@ -1670,12 +1790,12 @@ std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0)
+VersionTranslator::UpdateStream VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0)
 {
-std::stringstream ss;
+UpdateStream ss;
 
   ss << idf_0_9_6.header() << std::endl << std::endl;
 
@@ -1704,13 +1824,13 @@ std::stringstream ss;
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1)
+VersionTranslator::UpdateStream VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1)
 {
   // use for version increments with no IDD changes
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_11_0.header() << std::endl << std::endl;
 
@@ -1787,16 +1907,16 @@ std::string VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0
 
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2)
+VersionTranslator::UpdateStream VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2)
 {
   // This version update has two things to do.
   // Make updates for new control related objects.
   // Make updates for component costs.
 
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_11_1.header() << std::endl << std::endl;
 
@@ -2051,15 +2171,15 @@ std::string VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1
 
   }
 
-  return ss.str();
+  return ss;
 }
 
 
-std::string VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5)
+VersionTranslator::UpdateStream VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5)
 {
   // Make updates for component costs.
 
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_11_4.header() << std::endl << std::endl;
 
@@ -2161,14 +2281,14 @@ std::string VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4
 
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6)
+VersionTranslator::UpdateStream VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6)
 {
   // Update the OS:PortList object to point back to the OS:ThermalZone
 
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_0_11_5.header() << std::endl << std::endl;
 
@@ -2244,12 +2364,12 @@ std::string VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2)
+VersionTranslator::UpdateStream VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_0_1.header() << std::endl << std::endl;
 
@@ -2303,13 +2423,13 @@ std::string VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
 
-std::string VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3)
+VersionTranslator::UpdateStream VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_0_2.header() << std::endl << std::endl;
 
@@ -2344,12 +2464,12 @@ std::string VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3)
+VersionTranslator::UpdateStream VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_2_2.header() << std::endl << std::endl;
 
@@ -2485,12 +2605,12 @@ std::string VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, c
     ss << newBuildingObject;
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5)
+VersionTranslator::UpdateStream VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_3_4.header() << std::endl << std::endl;
 
@@ -2523,12 +2643,12 @@ std::string VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4)
+VersionTranslator::UpdateStream VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_5_3.header() << std::endl << std::endl;
 
@@ -2547,12 +2667,12 @@ std::string VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2)
+VersionTranslator::UpdateStream VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_7_1.header() << std::endl << std::endl;
 
@@ -2605,12 +2725,12 @@ std::string VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5)
+VersionTranslator::UpdateStream VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_7_4.header() << std::endl << std::endl;
 
@@ -2699,12 +2819,12 @@ std::string VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4)
+VersionTranslator::UpdateStream VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_8_3.header() << std::endl << std::endl;
 
@@ -2807,12 +2927,12 @@ std::string VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5)
+VersionTranslator::UpdateStream VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_8_4.header() << std::endl << std::endl;
 
@@ -2861,12 +2981,12 @@ std::string VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0)
+VersionTranslator::UpdateStream VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_8_5.header() << std::endl << std::endl;
 
@@ -2897,12 +3017,12 @@ std::string VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3)
+VersionTranslator::UpdateStream VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_9_2.header() << std::endl << std::endl;
 
@@ -2993,12 +3113,12 @@ std::string VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5)
+VersionTranslator::UpdateStream VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_9_4.header() << std::endl << std::endl;
 
@@ -3063,12 +3183,12 @@ std::string VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0)
+VersionTranslator::UpdateStream VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0)
 {
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_9_5.header() << std::endl << std::endl;
 
@@ -3129,12 +3249,12 @@ std::string VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5,
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
+VersionTranslator::UpdateStream VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
 
-  std::stringstream ss;
+  UpdateStream ss;
 
   ss << idf_1_10_1.header() << std::endl << std::endl;
 
@@ -3233,11 +3353,11 @@ std::string VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1
     ss << newObject;
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
+  UpdateStream ss;
 
   ss << idf_1_10_5.header() << std::endl << std::endl;
 
@@ -3277,11 +3397,11 @@ std::string VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
+  UpdateStream ss;
 
   ss << idf_1_11_3.header() << std::endl << std::endl;
 
@@ -3319,11 +3439,11 @@ std::string VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
+  UpdateStream ss;
 
   ss << idf_1_11_4.header() << std::endl << std::endl;
 
@@ -3362,11 +3482,11 @@ std::string VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
+  UpdateStream ss;
 
   ss << idf_1_12_0.header() << std::endl << std::endl;
 
@@ -3396,11 +3516,11 @@ std::string VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
+  UpdateStream ss;
 
   ss << idf_1_12_3.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_1_12_4.iddFile());
@@ -3434,11 +3554,11 @@ std::string VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
+  UpdateStream ss;
 
   ss << idf_2_1_0.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_1_1.iddFile());
@@ -3500,11 +3620,11 @@ std::string VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
+  UpdateStream ss;
 
   ss << idf_2_1_1.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_1_2.iddFile());
@@ -3553,11 +3673,11 @@ std::string VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
+  UpdateStream ss;
 
   ss << idf_2_3_0.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_3_1.iddFile());
@@ -3842,11 +3962,11 @@ std::string VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
+  UpdateStream ss;
 
   ss << idf_2_4_1.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_4_2.iddFile());
@@ -3966,12 +4086,12 @@ std::string VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
 
-std::string VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0){
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0){
+  UpdateStream ss;
 
   ss << idf_2_4_3.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_5_0.iddFile());
@@ -4024,11 +4144,11 @@ std::string VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
+  UpdateStream ss;
   boost::optional<std::string> value;
 
   ss << idf_2_6_0.header() << std::endl << std::endl;
@@ -4115,11 +4235,11 @@ std::string VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
+  UpdateStream ss;
 
   ss << idf_2_6_1.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_6_2.iddFile());
@@ -4184,12 +4304,12 @@ std::string VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
 
-std::string VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
+  UpdateStream ss;
 
   ss << idf_2_6_2.header() << std::endl << std::endl;
   IdfFile targetIdf(idd_2_7_0.iddFile());
@@ -4378,11 +4498,11 @@ std::string VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, c
     }
   }
 
-  return ss.str();
+  return ss;
 }
 
-std::string VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
+  UpdateStream ss;
   boost::optional<std::string> value;
 
   ss << idf_2_7_0.header() << std::endl << std::endl;
@@ -4417,12 +4537,12 @@ std::string VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, c
     }
   }
 
-  return ss.str();
+  return ss;
 
 }
 
-std::string VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
+  UpdateStream ss;
   boost::optional<std::string> value;
 
   ss << idf_2_7_1.header() << std::endl << std::endl;
@@ -4490,12 +4610,12 @@ std::string VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 
 }
 
-std::string VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
+  UpdateStream ss;
   boost::optional<std::string> value;
 
   ss << idf_2_8_1.header() << std::endl << std::endl;
@@ -4779,12 +4899,12 @@ std::string VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, c
     }
   }
 
-  return ss.str();
+  return ss;
 
 }
 
-std::string VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
-  std::stringstream ss;
+VersionTranslator::UpdateStream VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
+  UpdateStream ss;
   boost::optional<std::string> value;
 
   ss << idf_2_9_0.header() << std::endl << std::endl;
@@ -4868,7 +4988,7 @@ std::string VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, c
     }
   }
 
-  return ss.str();
+  return ss;
 
 }
 
@@ -52,7 +52,11 @@
 #include <utilities/idd/OS_Version_FieldEnums.hxx>
 
 #include "../../utilities/core/Compare.hpp"
+#include "../../utilities/core/UUID.hpp"
+#include "../../utilities/idd/IddFile.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
 
+#include <chrono>
 
 
 #include <resources.hxx>
@@ -539,3 +543,43 @@ TEST_F(OSVersionFixture,KeepHandles) {
   EXPECT_TRUE(idfObjects[0].handle() == workspaceObjects[0].handle());
 }
 */
+
+// --gtest_also_run_disabled_tests --gtest_filter=OSVersionFixture.DISABLED_VersionTranslator_LargeModel_Benchmark
+TEST_F(OSVersionFixture, DISABLED_VersionTranslator_LargeModel_Benchmark) {
+  // blow up the oldest example model by copying all of its objects under new handles
+  VersionString version("1.13.4");
+  boost::optional<IddFile> idd = IddFile::load(iddPath(version));
+  ASSERT_TRUE(idd);
+  boost::optional<IdfFile> example = IdfFile::load(exampleModelPath(version), *idd);
+  ASSERT_TRUE(example);
+
+  IdfFile large(*idd);
+  large.setHeader(example->header());
+  if (boost::optional<IdfObject> versionObject = large.versionObject()) {
+    large.removeObject(*versionObject);
+  }
+  large.addObject(example->versionObject().get());
+  for (unsigned i = 0; i < 100; ++i) {
+    for (const IdfObject& object : example->objects()) {
+      if (object.iddObject().isVersionObject()) {
+        continue;
+      }
+      IdfObject copy = object.clone();
+      if (copy.iddObject().hasHandleField()) {
+        copy.setString(0, toString(createUUID()));
+      }
+      large.addObject(copy);
+    }
+  }
+  openstudio::path path = versionResourcesPath(version) / toPath("example_large.osm");
+  ASSERT_TRUE(large.save(path, true));
+
+  osversion::VersionTranslator translator;
+  auto start = std::chrono::steady_clock::now();
+  model::OptionalModel result = translator.loadModel(path);
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  openstudio::filesystem::remove(path);
+  ASSERT_TRUE(result);
+  std::cout << "Updated " << large.numObjects() << " objects from " << version.str() << " to "
+            << result->version().str() << " in " << elapsed.count() << " s" << std::endl;
+}
@@ -30,23 +30,22 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <limits>
+#include <map>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio{
 namespace radiance{
 
+  // conversion from footcandles to lux
+  static const double footcandlesToLux(10.76);
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
   {}
@@ -81,14 +80,8 @@ namespace radiance{
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
-    // conversion from footcandles to lux
-    const double footcandlesToLux(10.76);
+    // row of m_illuminances for each date and time read so far
+    std::map<DateTime, unsigned> rows;
 
     // read the rest of the file line by line
     while(getline(file, line)){
@@ -119,66 +112,174 @@ namespace radiance{
 
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
-        // followed by M*N illuminance points
-
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string > tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string >::iterator it(tk.begin()); it!=tk.end(); ++it)
-        {
-           lineVector.push_back(*it);
+        // followed by M*N illuminance points, which are appended to m_illuminances as they are read
+        const char* str = line.c_str();
+        char* end = nullptr;
+
+        double header[6];
+        unsigned numHeaderValues = 0;
+        for (; numHeaderValues < 6; ++numHeaderValues){
+          header[numHeaderValues] = std::strtod(str, &end);
+          if (end == str){
+            break;
+          }
+          str = end;
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        std::size_t rowBegin = m_illuminances.size();
+        if (numHeaderValues == 6){
+          if (m_dateTimes.empty()){
+            // guess the number of lines from the length of the first one
+            std::size_t numLines = openstudio::filesystem::file_size(path) / (line.size() + 1) + 1;
+            m_illuminances.reserve(numLines * M * N);
+          }
 
-        if (numValues != M*N){
+          while (true){
+            float value = std::strtof(str, &end);
+            if (end == str){
+              break;
+            }
+            m_illuminances.push_back(value);
+            str = end;
+          }
+        }
+
+        // anything left over is not a number
+        while (*str == ' ' || *str == '\t' || *str == '\r'){
+          ++str;
+        }
+        if (*str != '\0'){
+          m_illuminances.resize(rowBegin);
+          LOG(Fatal,  "Cannot read value '" << str << "' on line " << lineNum << ".");
+          return;
+        }
+
+        std::size_t numValues = m_illuminances.size() - rowBegin;
+
+        if (numHeaderValues != 6 || numValues != M*N){
+          m_illuminances.resize(rowBegin);
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
           return;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          MonthOfYear month = monthOfYear(static_cast<unsigned>(header[0]));
+          unsigned day = static_cast<unsigned>(header[1]);
+          double fracDays = header[2] / 24.0;
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
           DateTime dateTime(Date(month, day), Time(fracDays));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
-
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
+          // the last map read wins if a date and time is repeated, overwrite the earlier row with it
+          auto inserted = rows.insert(std::make_pair(dateTime, static_cast<unsigned>(m_dateTimes.size())));
+          if (inserted.second){
+            m_dateTimes.push_back(dateTime);
+          }else{
+            LOG(Warn,  "Repeated date and time " << dateTime << " on line " << lineNum << " replaces the earlier map.");
+            std::copy(m_illuminances.begin() + rowBegin, m_illuminances.end(),
+                      m_illuminances.begin() + static_cast<std::size_t>(inserted.first->second) * M*N);
+            m_illuminances.resize(rowBegin);
           }
-
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
         }
       }
     }
 
     // close file
     file.close();
+
+    if (m_illuminances.capacity() > m_illuminances.size() + m_illuminances.size() / 4){
+      m_illuminances.shrink_to_fit();
+    }
+
+    m_sortedDateTimes.reserve(rows.size());
+    for (const auto& row : rows){
+      m_sortedDateTimes.push_back(row.second);
+    }
+  }
+
+  unsigned AnnualIlluminanceMap::numPoints() const
+  {
+    return m_xVector.size() * m_yVector.size();
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    auto it = std::lower_bound(m_sortedDateTimes.begin(), m_sortedDateTimes.end(), dateTime, [this](unsigned t, const DateTime& dt) {
+      return m_dateTimes[t] < dt;
+    });
+    if (it != m_sortedDateTimes.end() && m_dateTimes[*it] == dateTime){
+      unsigned M = m_xVector.size();
+      unsigned N = m_yVector.size();
+      const float* row = m_illuminances.data() + static_cast<std::size_t>(*it) * numPoints();
+
+      Matrix result(M,N);
+      for (unsigned j = 0; j < N; ++j){
+        for (unsigned i = 0; i < M; ++i){
+          result(i,j) = footcandlesToLux*row[j*M + i];
+        }
+      }
+      return result;
     }
 
     return m_nullIlluminanceMap;
   }
 
+  std::vector<double> AnnualIlluminanceMap::illuminances(unsigned i, unsigned j) const
+  {
+    std::vector<double> result;
+    if (i >= m_xVector.size() || j >= m_yVector.size()){
+      return result;
+    }
+
+    std::size_t P = numPoints();
+    std::size_t p = j*m_xVector.size() + i;
+    result.reserve(m_dateTimes.size());
+    for (std::size_t t = 0; t < m_dateTimes.size(); ++t){
+      result.push_back(footcandlesToLux*m_illuminances[t*P + p]);
+    }
+    return result;
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double minimumIlluminance) const
+  {
+    return fractionBetween(minimumIlluminance, std::numeric_limits<double>::infinity());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::usefulDaylightIlluminance(double lowerIlluminance, double upperIlluminance) const
+  {
+    return fractionBetween(lowerIlluminance, upperIlluminance);
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::fractionBetween(double lowerIlluminance, double upperIlluminance) const
+  {
+    unsigned M = m_xVector.size();
+    unsigned N = m_yVector.size();
+    std::size_t P = numPoints();
+    std::size_t T = m_dateTimes.size();
+
+    // one pass over the rows, counting for all points at once
+    std::vector<unsigned> counts(P, 0);
+    for (std::size_t t = 0; t < T; ++t){
+      const float* row = m_illuminances.data() + t*P;
+      for (std::size_t p = 0; p < P; ++p){
+        double illuminance = footcandlesToLux*row[p];
+        counts[p] += (illuminance >= lowerIlluminance && illuminance <= upperIlluminance) ? 1 : 0;
+      }
+    }
+
+    Matrix result(M,N,0.0);
+    if (T > 0){
+      for (unsigned j = 0; j < N; ++j){
+        for (unsigned i = 0; i < M; ++i){
+          result(i,j) = static_cast<double>(counts[j*M + i]) / T;
+        }
+      }
+    }
+    return result;
+  }
+
 
 } // radiance
 } // openstudio
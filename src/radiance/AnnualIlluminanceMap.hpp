@@ -38,20 +38,22 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <vector>
+
 namespace openstudio{
 namespace radiance{
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   The maps of all dates and times are kept in a single array, one row of xVector().size() *
+  *   yVector().size() single precision values per date and time, so that annual metrics can be
+  *   computed point by point without building a Matrix for each date and time. A date and time
+  *   that is repeated in the file keeps a single row, holding the last map read.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
-    private:
-
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
-
     public:
 
       /// default constructor
@@ -76,17 +78,38 @@ namespace radiance{
       /// get the illuminance map in lux corresponding to date and time
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// get the illuminance in lux at point (i, j) of the map for each of the dateTimes
+      std::vector<double> illuminances(unsigned i, unsigned j) const;
+
+      /// get the fraction of the dateTimes at which the illuminance is at least minimumIlluminance lux,
+      /// for each point of the map
+      openstudio::Matrix daylightAutonomy(double minimumIlluminance) const;
+
+      /// get the fraction of the dateTimes at which the illuminance is between lowerIlluminance and
+      /// upperIlluminance lux (inclusive), for each point of the map
+      openstudio::Matrix usefulDaylightIlluminance(double lowerIlluminance = 100.0, double upperIlluminance = 2000.0) const;
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
       void init(const openstudio::path& path);
 
+      openstudio::Matrix fractionBetween(double lowerIlluminance, double upperIlluminance) const;
+
+      unsigned numPoints() const;
+
       openstudio::DateTimeVector m_dateTimes;
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+
+      // illuminance in footcandles, point (i, j) of the map for m_dateTimes[t] is at t*numPoints() + j*M + i,
+      // m_dateTimes holds each date and time once in the order first read
+      std::vector<float> m_illuminances;
+
+      // indices into m_dateTimes sorted by date and time, for lookups
+      std::vector<unsigned> m_sortedDateTimes;
   };
 
 } // radiance
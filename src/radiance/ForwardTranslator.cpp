@@ -77,6 +77,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/System.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -86,6 +87,8 @@
 #include "../utilities/bcl/LocalBCL.hpp"
 
 
+#include <atomic>
+#include <functional>
 #include <thread>
 
 #include <boost/lexical_cast.hpp>
@@ -95,6 +98,7 @@
 #include <radiance/embedded_files.hxx>
 
 
+#include <cstdio>
 #include <cstring>
 #include <cmath>
 #include <sstream>
@@ -129,29 +133,18 @@ namespace radiance {
   // internal method used to format doubles as strings
   std::string formatString(double t_d, unsigned t_prec)
   {
-    std::stringstream ss;
-    ss << std::setprecision(t_prec) << std::noshowpoint << std::fixed << t_d;
-    std::string s = ss.str();
-
-    /*
-    // truncate 0's from the end
-    int i = s.size() - 1;
-    while (i > 0 && s[i] == '0')
-    {
-      --i;
+    // same text as std::fixed with std::setprecision, without constructing a stream for every value
+    char buffer[64];
+    int n = std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(t_prec), t_d);
+    if (n < 0){
+      return std::string();
     }
-
-    if (i > 0)
-    {
-      s.erase(i + 1);
-
-      if (*s.rbegin() == '.')
-      {
-        s.push_back('0');
-      }
+    if (n < static_cast<int>(sizeof(buffer))){
+      return std::string(buffer, n);
     }
-    */
-
+    std::string s(n + 1, '\0');
+    std::snprintf(&s[0], s.size(), "%.*f", static_cast<int>(t_prec), t_d);
+    s.resize(n);
     return s;
   }
 
@@ -162,6 +155,66 @@ namespace radiance {
     return boost::lexical_cast<std::string>(t);
   }
 
+  namespace {
+
+    // Text of one space's scene file. The model is only read on the calling thread, which queues up
+    // writers holding copies of the geometry they need. The writers of different spaces are then run
+    // on worker threads and the results are merged in space order, so the output does not depend on
+    // the number of threads.
+    struct SpaceScene
+    {
+      std::string name;
+      std::vector<std::function<void(SpaceScene&)> > writers;
+      std::string geometry;
+      std::set<std::string> materials;
+      std::set<std::string> mixMaterials;
+    };
+
+    // objects come back from the model in handle order, which changes every time the model is cloned
+    template<typename T>
+    std::vector<T> sortedByName(std::vector<T> objects)
+    {
+      std::sort(objects.begin(), objects.end(), IdfObjectNameLess());
+      return objects;
+    }
+
+    void formatSpaceScenes(std::vector<SpaceScene>& scenes, unsigned numThreads)
+    {
+      auto format = [](SpaceScene& scene) {
+        for (const auto& writer : scene.writers){
+          writer(scene);
+        }
+        scene.writers.clear();
+      };
+
+      if (numThreads == 0){
+        numThreads = System::numberOfProcessors();
+      }
+      numThreads = static_cast<unsigned>(std::min<std::size_t>(numThreads, scenes.size()));
+
+      if (numThreads <= 1){
+        for (SpaceScene& scene : scenes){
+          format(scene);
+        }
+        return;
+      }
+
+      std::atomic<std::size_t> next(0);
+      std::vector<std::thread> workers;
+      for (unsigned i = 0; i < numThreads; ++i){
+        workers.emplace_back([&]() {
+          for (std::size_t j = next++; j < scenes.size(); j = next++){
+            format(scenes[j]);
+          }
+        });
+      }
+      for (std::thread& worker : workers){
+        worker.join();
+      }
+    }
+
+  } // namespace
+
   // basic constructor
   ForwardTranslator::ForwardTranslator()
     : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
@@ -171,7 +224,8 @@ namespace radiance {
     m_logSink.setThreadId(std::this_thread::get_id());
   }
 
-  std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model)
+  std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model,
+                                                                   unsigned numThreads)
   {
     m_model = model.clone(true).cast<openstudio::model::Model>();
 
@@ -313,7 +367,7 @@ namespace radiance {
       siteShadingSurfaceGroups(radDir, site.shadingSurfaceGroups(), outfiles);
 
       // get spaces
-      buildingSpaces(radDir, building.spaces(), outfiles);
+      buildingSpaces(radDir, building.spaces(), outfiles, numThreads);
 
       // write options files
       std::string dcmatsStringin;
@@ -1064,12 +1118,14 @@ namespace radiance {
   }
 
   void ForwardTranslator::buildingSpaces(const openstudio::path &t_radDir, const std::vector<openstudio::model::Space> &t_spaces,
-      std::vector<openstudio::path> &t_outfiles)
+      std::vector<openstudio::path> &t_outfiles, unsigned numThreads)
   {
     std::vector<std::string> space_names;
 
+    std::vector<SpaceScene> scenes;
+    scenes.reserve(t_spaces.size());
 
-    for (const auto & space : t_spaces)
+    for (const auto & space : sortedByName(t_spaces))
     {
       std::string space_name = cleanName(space.name().get());
 
@@ -1077,11 +1133,14 @@ namespace radiance {
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      scenes.emplace_back();
+      SpaceScene& scene = scenes.back();
+      scene.name = space_name;
+      scene.geometry = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
-      std::vector<openstudio::model::Surface> surfaces = space.surfaces();
+      std::vector<openstudio::model::Surface> surfaces = sortedByName(space.surfaces());
 
       for (const auto & surface : surfaces)
       {
@@ -1092,13 +1151,7 @@ namespace radiance {
         }
 
         std::string surface_name = cleanName(surface.name().get());
-
-        // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
-
-        // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5; // default for space surfaces
@@ -1114,71 +1167,81 @@ namespace radiance {
 
         // create polygon object
         openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
-        for (const openstudio::Point3dVector& polygon : polygons) {
-
-          if (!surface.adjacentSurface()) {
-            // 2-sided material
-
-            // header
-            m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
-              "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
-
-            // material definition
-
-            //interior
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
-              + "\n0\n0\n5\n" + formatString(interiorVisibleReflectance, 3)
-              + " " + formatString(interiorVisibleReflectance, 3)
-              + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-            //exterior
-            m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3)
-              + "\n0\n0\n5\n" + formatString(exteriorVisibleReflectance, 3)
-              + " " + formatString(exteriorVisibleReflectance, 3)
-              + " " + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
-            // mixfunc
-            m_radMixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
-              "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + "\n4 " + \
-              "refl_" + formatString(exteriorVisibleReflectance, 3) + " " + \
-              "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+        bool adjacent = surface.adjacentSurface().is_initialized();
+
+        scene.writers.push_back([=](SpaceScene& s) {
+          // add surface to space geometry
+          s.geometry += "# surface: " + surface_name + "\n";
+
+          // set construction of surface
+          s.geometry += "# construction: " + constructionName + "\n";
+
+          for (const openstudio::Point3dVector& polygon : polygons) {
+
+            if (!adjacent) {
+              // 2-sided material
+
+              // header
+              s.geometry += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3) + \
+                "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+
+              // material definition
+
+              //interior
+              s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
+                + "\n0\n0\n5\n" + formatString(interiorVisibleReflectance, 3)
+                + " " + formatString(interiorVisibleReflectance, 3)
+                + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+              //exterior
+              s.materials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3)
+                + "\n0\n0\n5\n" + formatString(exteriorVisibleReflectance, 3)
+                + " " + formatString(exteriorVisibleReflectance, 3)
+                + " " + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
+              // mixfunc
+              s.mixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+                "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + "\n4 " + \
+                "refl_" + formatString(exteriorVisibleReflectance, 3) + " " + \
+                "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+
+              // polygon reference
+              s.geometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+                "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
+                surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
+            }
+            else {
+              // interior-only material
 
-            // polygon reference
-            m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
-              "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
-              surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
-          }
-          else {
-            // interior-only material
+              // header
+              s.geometry += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
-            // header
-            m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+              // material definition
+              s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
+                + "\n0\n0\n5\n" + formatString(interiorVisibleReflectance, 3)
+                + " " + formatString(interiorVisibleReflectance, 3)
+                + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
-            // material definition
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3)
-              + "\n0\n0\n5\n" + formatString(interiorVisibleReflectance, 3)
-              + " " + formatString(interiorVisibleReflectance, 3)
-              + " " + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
+              // polygon reference
+              s.geometry += "refl_" + formatString(interiorVisibleReflectance, 3)
+                + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
-            // polygon reference
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3)
-              + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
+            };
 
-          };
+            // add polygon vertices
+            for (const auto & vertex : polygon)
+            {
+              s.geometry += formatString(vertex.x()) + " "
+                + formatString(vertex.y()) + " "
+                + formatString(vertex.z()) + "\n";
+            }
+            s.geometry += "\n";
 
-          // add polygon vertices
-          for (const auto & vertex : polygon)
-          {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " "
-              + formatString(vertex.y()) + " "
-              + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
-
-        }
+        });
         // end(surface)
 
 
         // get sub surfaces
-        std::vector<openstudio::model::SubSurface> subSurfaces = surface.subSurfaces();
+        std::vector<openstudio::model::SubSurface> subSurfaces = sortedByName(surface.subSurfaces());
 
         for (const auto & subSurface : subSurfaces)
         {
@@ -1394,108 +1457,111 @@ namespace radiance {
 
             }
 
-            openstudio::Vector3d offset;
-
             // subSurface.outwardNormal not in global coordinate system
             outwardNormal = subSurface.outwardNormal();
             boost::optional<Vector3d> optionalOutwardNormal = openstudio::getOutwardNormal(polygon);
-            if (optionalOutwardNormal){
-              Vector3d outwardNormal = *optionalOutwardNormal;
 
-              size_t N = polygon.size();
-              for (size_t i = 0; i < N; ++i)
-              {
-                size_t index1 = i;
-                size_t index2 = (i + 1) % N;
-
-                if (outsideRevealDepth && (*outsideRevealDepth > 0.0)){
-                  // window polygon is already offset from the wall
-                  offset = outsideRevealDepth.get() * outwardNormal;
-                  Point3d vertex1 = polygon[index1];
-                  Point3d vertex2 = polygon[index1] + offset;
-                  Point3d vertex3 = polygon[index2] + offset;
-                  Point3d vertex4 = polygon[index2];
-
-                  // TODO: get exterior reflectance of surface
-                  double interiorVisibleReflectance = 0.5;
-                  double exteriorVisibleReflectance = 0.2;
-                  //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
-                  // write material
-                  m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
-                                        formatString(exteriorVisibleReflectance, 3) + " " + \
-                                        formatString(exteriorVisibleReflectance, 3) + " " + \
-                                        formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
-                  // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
-                }
-
-                // make interior sill/reveal surfaces
-                if (insideRevealDepth && (*insideRevealDepth > 0.0)){
-
-                  // window polygon is already offset from the wall
-                  offset = -insideRevealDepth.get() * outwardNormal;
-                  Point3d vertex1 = polygon[index1];
-                  Point3d vertex2 = polygon[index1] + offset;
-                  Point3d vertex3 = polygon[index2] + offset;
-                  Point3d vertex4 = polygon[index2];
-
-                  // TODO: get exterior reflectance of surface
-                  double interiorVisibleReflectance = 0.5;
-                  double exteriorVisibleReflectance = 0.2;
-                  //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
-                  // write material
-                  m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
-                                        formatString(interiorVisibleReflectance, 3) + " " + \
-                                        formatString(interiorVisibleReflectance, 3) + " " + \
-                                        formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-                  // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
-                }
-
-                if (insideSillDepth && (*insideSillDepth > 0.0)){
-
-                  // window polygon is already offset from the wall
-                  offset = -insideSillDepth.get() * outwardNormal;
-                  Point3d vertex1 = polygon[index1];
-                  Point3d vertex2 = polygon[index1] + offset;
-                  Point3d vertex3 = polygon[index2] + offset;
-                  Point3d vertex4 = polygon[index2];
-
-                  // TODO: get exterior reflectance of surface
-                  double interiorVisibleReflectance = 0.5;
-                  double exteriorVisibleReflectance = 0.2;
-                  //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
-                  // write material
-                  m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
-                                        formatString(interiorVisibleReflectance, 3) + " " + \
-                                        formatString(interiorVisibleReflectance, 3) + " " + \
-                                        formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-                  // write polygon
-                  m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+            scene.writers.push_back([=](SpaceScene& s) {
+              openstudio::Vector3d offset;
+
+              if (optionalOutwardNormal){
+                Vector3d outwardNormal = *optionalOutwardNormal;
+
+                size_t N = polygon.size();
+                for (size_t i = 0; i < N; ++i)
+                {
+                  size_t index1 = i;
+                  size_t index2 = (i + 1) % N;
+
+                  if (outsideRevealDepth && (*outsideRevealDepth > 0.0)){
+                    // window polygon is already offset from the wall
+                    offset = outsideRevealDepth.get() * outwardNormal;
+                    Point3d vertex1 = polygon[index1];
+                    Point3d vertex2 = polygon[index1] + offset;
+                    Point3d vertex3 = polygon[index2] + offset;
+                    Point3d vertex4 = polygon[index2];
+
+                    // TODO: get exterior reflectance of surface
+                    double interiorVisibleReflectance = 0.5;
+                    double exteriorVisibleReflectance = 0.2;
+                    //polygon header
+                    s.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                    s.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                    // write material
+                    s.materials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                                          formatString(exteriorVisibleReflectance, 3) + " " + \
+                                          formatString(exteriorVisibleReflectance, 3) + " " + \
+                                          formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
+                    // write polygon
+                    s.geometry += "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + std::to_string(i) + "\n";
+                    s.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                    s.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                    s.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                    s.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                    s.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  }
+
+                  // make interior sill/reveal surfaces
+                  if (insideRevealDepth && (*insideRevealDepth > 0.0)){
+
+                    // window polygon is already offset from the wall
+                    offset = -insideRevealDepth.get() * outwardNormal;
+                    Point3d vertex1 = polygon[index1];
+                    Point3d vertex2 = polygon[index1] + offset;
+                    Point3d vertex3 = polygon[index2] + offset;
+                    Point3d vertex4 = polygon[index2];
+
+                    // TODO: get exterior reflectance of surface
+                    double interiorVisibleReflectance = 0.5;
+                    double exteriorVisibleReflectance = 0.2;
+                    //polygon header
+                    s.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                    s.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                    // write material
+                    s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                                          formatString(interiorVisibleReflectance, 3) + " " + \
+                                          formatString(interiorVisibleReflectance, 3) + " " + \
+                                          formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+                    // write polygon
+                    s.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + std::to_string(i) + "\n";
+                    s.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                    s.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                    s.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                    s.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                    s.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  }
+
+                  if (insideSillDepth && (*insideSillDepth > 0.0)){
+
+                    // window polygon is already offset from the wall
+                    offset = -insideSillDepth.get() * outwardNormal;
+                    Point3d vertex1 = polygon[index1];
+                    Point3d vertex2 = polygon[index1] + offset;
+                    Point3d vertex3 = polygon[index2] + offset;
+                    Point3d vertex4 = polygon[index2];
+
+                    // TODO: get exterior reflectance of surface
+                    double interiorVisibleReflectance = 0.5;
+                    double exteriorVisibleReflectance = 0.2;
+                    //polygon header
+                    s.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                    s.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                    // write material
+                    s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                                          formatString(interiorVisibleReflectance, 3) + " " + \
+                                          formatString(interiorVisibleReflectance, 3) + " " + \
+                                          formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+                    // write polygon
+                    s.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + std::to_string(i) + "\n";
+                    s.geometry += "0\n0\n" + formatString(4 * 3) + "\n";
+                    s.geometry += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                    s.geometry += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                    s.geometry += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                    s.geometry += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  }
                 }
               }
-            }
+            });
 
             // finally, write the actual window
             // add polygon header (same for all)
@@ -1743,22 +1809,25 @@ namespace radiance {
             double exteriorVisibleAbsorptance = subSurface.exteriorVisibleAbsorptance().get();
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
-            //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
-            // write material
-            m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
-              formatString(interiorVisibleReflectance, 3) + " " + \
-              formatString(interiorVisibleReflectance, 3) + " " + \
-              formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-            // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
-            for (const auto & vertex : polygon)
-            {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
-            }
+            scene.writers.push_back([=](SpaceScene& s) {
+              //polygon header
+              s.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+              s.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+              // write material
+              s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+                formatString(interiorVisibleReflectance, 3) + " " + \
+                formatString(interiorVisibleReflectance, 3) + " " + \
+                formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+              // write polygon
+              s.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+              s.geometry += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+
+              for (const auto & vertex : polygon)
+              {
+                s.geometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              }
+            });
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
 
@@ -1776,20 +1845,14 @@ namespace radiance {
 
       // get shading surfaces
 
-      std::vector<openstudio::model::ShadingSurfaceGroup> shadingSurfaceGroups = space.shadingSurfaceGroups();
+      std::vector<openstudio::model::ShadingSurfaceGroup> shadingSurfaceGroups = sortedByName(space.shadingSurfaceGroups());
       for (const auto & shadingSurfaceGroup : shadingSurfaceGroups)
       {
-        std::vector<openstudio::model::ShadingSurface> shadingSurfaces = shadingSurfaceGroup.shadingSurfaces();
+        std::vector<openstudio::model::ShadingSurface> shadingSurfaces = sortedByName(shadingSurfaceGroup.shadingSurfaces());
         for (const auto & shadingSurface : shadingSurfaces)
         {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
-
-          // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
-
-          // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25; // default for space shading surfaces
@@ -1803,50 +1866,57 @@ namespace radiance {
             exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
           }
 
-          // write (two-sided) material
-          // exterior reflectance for front side
-          m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
-              + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
-              + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
+          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
 
-          // interior reflectance for back side
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
-              + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
-              + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+          scene.writers.push_back([=](SpaceScene& s) {
+            // add surface to zone geometry
+            s.geometry += "# surface: " + shadingSurface_name + "\n";
 
-          // mixfunc
-          m_radMixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
-              "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + "\n4 " + \
-              "refl_" + formatString(exteriorVisibleReflectance, 3) + " " + \
-              "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
+            // set construction of space shadingSurface
+            s.geometry += "# construction: " + constructionName + "\n";
 
-          // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+            // write (two-sided) material
+            // exterior reflectance for front side
+            s.materials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
+                + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
 
-          // get / write surface polygon
+            // interior reflectance for back side
+            s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
+                + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
+                + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
 
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
-              "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
-          shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
+            // mixfunc
+            s.mixMaterials.insert("void mixfunc reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+                "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + "\n4 " + \
+                "refl_" + formatString(exteriorVisibleReflectance, 3) + " " + \
+                "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
-          for (const auto & vertex : polygon)
-          {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
-          }
-          m_radSpaces[space_name] += "\n";
+            // polygon header
+            s.geometry += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+            s.geometry += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+
+            // write surface polygon
+            s.geometry += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + \
+                "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3) + " polygon " + \
+            shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
+            for (const auto & vertex : polygon)
+            {
+              s.geometry += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            }
+            s.geometry += "\n";
+          });
         }
       } // end shading surfaces
 
 
       //get the interior partition surfaces
 
-      std::vector<openstudio::model::InteriorPartitionSurfaceGroup> interiorPartitionSurfaceGroups = space.interiorPartitionSurfaceGroups();
+      std::vector<openstudio::model::InteriorPartitionSurfaceGroup> interiorPartitionSurfaceGroups = sortedByName(space.interiorPartitionSurfaceGroups());
       for (const auto & interiorPartitionSurfaceGroup : interiorPartitionSurfaceGroups)
       {
-        std::vector<openstudio::model::InteriorPartitionSurface> interiorPartitionSurfaces = interiorPartitionSurfaceGroup.interiorPartitionSurfaces();
+        std::vector<openstudio::model::InteriorPartitionSurface> interiorPartitionSurfaces = sortedByName(interiorPartitionSurfaceGroup.interiorPartitionSurfaces());
         for (const auto & interiorPartitionSurface : interiorPartitionSurfaces)
         {
 
@@ -1862,15 +1932,9 @@ namespace radiance {
             continue;
           }
 
-          // add surface to zone geometry
-
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
-
-          // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
 
-         // get reflectance
+          // get reflectance
           double interiorVisibleReflectance = 0.5; // set some default
           if (interiorPartitionSurface.interiorVisibleAbsorptance()){
             double interiorVisibleAbsorptance = interiorPartitionSurface.interiorVisibleAbsorptance().get();
@@ -1883,23 +1947,31 @@ namespace radiance {
             exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
           }
 
-          // write material
-          m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
-            formatString(interiorVisibleReflectance, 3) + " " + \
-            formatString(interiorVisibleReflectance, 3) + " " + \
-            formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
-          // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
-          // get / write surface polygon
-
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
-          interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
-          for (const auto & vertex : polygon)
-          {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
-          }
+
+          scene.writers.push_back([=](SpaceScene& s) {
+            // add surface to zone geometry
+            s.geometry += "# surface: " + interiorPartitionSurface_name + "\n";
+
+            // set construction of interiorPartitionSurface
+            s.geometry += "# construction: " + constructionName + "\n";
+
+            // write material
+            s.materials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n" + \
+              formatString(interiorVisibleReflectance, 3) + " " + \
+              formatString(interiorVisibleReflectance, 3) + " " + \
+              formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
+            // polygon header
+            s.geometry += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            s.geometry += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            // write surface polygon
+            s.geometry += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + \
+            interiorPartitionSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
+            for (const auto & vertex : polygon)
+            {
+              s.geometry += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            }
+          });
         }
       } // end interior partitions
 
@@ -1913,7 +1985,7 @@ namespace radiance {
       //}
 
       // get daylighting controls
-      std::vector<openstudio::model::DaylightingControl> daylightingControls = space.daylightingControls();
+      std::vector<openstudio::model::DaylightingControl> daylightingControls = sortedByName(space.daylightingControls());
       for (const auto & control : daylightingControls)
       {
 
@@ -1966,7 +2038,7 @@ namespace radiance {
 
 
       // get glare sensors
-      std::vector<openstudio::model::GlareSensor> glareSensors = space.glareSensors();
+      std::vector<openstudio::model::GlareSensor> glareSensors = sortedByName(space.glareSensors());
       for (const auto & sensor : glareSensors)
       {
         m_radGlareSensors[space_name] = "";
@@ -2060,7 +2132,7 @@ namespace radiance {
 
 
       // get illuminance map points, write to file
-      std::vector<openstudio::model::IlluminanceMap> illuminanceMaps = space.illuminanceMaps();
+      std::vector<openstudio::model::IlluminanceMap> illuminanceMaps = sortedByName(space.illuminanceMaps());
       for (const auto & map : illuminanceMaps)
       {
         m_radMaps[space_name] = "";
@@ -2086,28 +2158,47 @@ namespace radiance {
       } //end illuminance map
 
 
+    }
+
+    // format the scene files of all spaces, then write them out in space order
+    formatSpaceScenes(scenes, numThreads);
+
+    for (SpaceScene& scene : scenes)
+    {
+      m_radMaterials.insert(scene.materials.begin(), scene.materials.end());
+      m_radMixMaterials.insert(scene.mixMaterials.begin(), scene.mixMaterials.end());
+
+      std::string& geometry = m_radSpaces[scene.name];
+      geometry = std::move(scene.geometry);
+
       // write geometry
-      openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
+      openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(scene.name + ".rad");
       OFSTREAM file(filename);
       if (file.is_open()){
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
+        file << geometry;
       } else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
+    }
 
-      for (const auto & windowGroup : m_windowGroups)
-      {
-        std::string windowGroup_name = windowGroup.name();
+    // window groups and materials are shared by all of the spaces, write them once they are complete
+    if (t_spaces.empty()){
+      return;
+    }
 
-        //write windows (and glazed doors)
-        if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
-        {
+    for (const auto & windowGroup : m_windowGroups)
+    {
+      std::string windowGroup_name = windowGroup.name();
+
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
+      {
 
-          // get the Radiance parameters... so we have them.
-          openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
-          if(windowGroup_name != "WG0"){
+        // get the Radiance parameters... so we have them.
+        openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
+        if(windowGroup_name != "WG0"){
 						if (radianceParameters.skyDiscretizationResolution() == "146"){
 							LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
 						} else if (radianceParameters.skyDiscretizationResolution() == "578"){
@@ -2117,138 +2208,137 @@ namespace radiance {
 						}
 					}
 
-          openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()){
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else{
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
-          }
+        openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
+        OFSTREAM glazefile(glazefilename);
+        if (glazefile.is_open()){
+          t_outfiles.push_back(glazefilename);
+          m_radSceneFiles.push_back(glazefilename);
+          glazefile << m_radWindowGroups[windowGroup_name];
+        } else{
+          LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+        }
 
-          if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
-            openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
-            OFSTREAM shadefile(shadefilename);
-            if (shadefile.is_open()){
-              t_outfiles.push_back(shadefilename);
-              m_radSceneFiles.push_back(shadefilename);
-              shadefile << m_radWindowGroupShades[windowGroup_name];
-            } else{
-              LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
-            }
+        if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
+          openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
+          OFSTREAM shadefile(shadefilename);
+          if (shadefile.is_open()){
+            t_outfiles.push_back(shadefilename);
+            m_radSceneFiles.push_back(shadefilename);
+            shadefile << m_radWindowGroupShades[windowGroup_name];
+          } else{
+            LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
           }
+        }
 
-          // write window group control points
-          // only write for controlled window groups
-          if(windowGroup_name != "WG0"){
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()){
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else{
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+        // write window group control points
+        // only write for controlled window groups
+        if(windowGroup_name != "WG0"){
+          openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
+          OFSTREAM file(filename);
+          if (file.is_open()){
+            t_outfiles.push_back(filename);
+            file << windowGroup.windowGroupPoints();
+          } else{
+            LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
           }
         }
       }
+    }
 
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()){
-        t_outfiles.push_back(materialsfilename);
-        for (const auto & line : m_radMaterials)
-        {
-          materialsfile << line;
-        };
-        for (const auto & line : m_radMixMaterials)
-        {
-          materialsfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
+    OFSTREAM materialsfile(materialsfilename);
+    if (materialsfile.is_open()){
+      t_outfiles.push_back(materialsfilename);
+      for (const auto & line : m_radMaterials)
+      {
+        materialsfile << line;
+      };
+      for (const auto & line : m_radMixMaterials)
+      {
+        materialsfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
+    }
 
 
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()){
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto & line : m_radMaterialsDC)
-        {
-          materials_vmxfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
-      }
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
+    OFSTREAM materials_vmxfile(materials_vmxfilename);
+    if (materials_vmxfile.is_open()){
+      t_outfiles.push_back(materials_vmxfilename);
+      for (const auto & line : m_radMaterialsDC)
+      {
+        materials_vmxfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
+    }
 
 
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()){
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto & line : m_radMaterialsWG0)
-        {
-          materials_WG0file << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
-      }
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
+    OFSTREAM materials_WG0file(materials_WG0filename);
+    if (materials_WG0file.is_open()){
+      t_outfiles.push_back(materials_WG0filename);
+      for (const auto & line : m_radMaterialsWG0)
+      {
+        materials_WG0file << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
+    }
 
-      // write radiance blackout materials file (blacks out everything)
-      m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
-      OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
-      if (materials_SwitchableBasefile.is_open()){
-        t_outfiles.push_back(materials_SwitchableBasefilename);
-        for (const auto & line : m_radMaterialsSwitchableBase)
-        {
-          materials_SwitchableBasefile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
-      }
+    // write radiance blackout materials file (blacks out everything)
+    m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
+    OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
+    if (materials_SwitchableBasefile.is_open()){
+      t_outfiles.push_back(materials_SwitchableBasefilename);
+      for (const auto & line : m_radMaterialsSwitchableBase)
+      {
+        materials_SwitchableBasefile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
+    }
 
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()){
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto & line : m_radDCmats)
-        {
-          materials_dcfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
-      }
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
+    openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
+    OFSTREAM materials_dcfile(materials_dcfilename);
+    if (materials_dcfile.is_open()){
+      t_outfiles.push_back(materials_dcfilename);
+      for (const auto & line : m_radDCmats)
+      {
+        materials_dcfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+    }
 
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
+    // write complete scene
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+    OFSTREAM modelfile(modelfilename);
 
-      if (modelfile.is_open()){
-        t_outfiles.push_back(modelfilename);
+    if (modelfile.is_open()){
+      t_outfiles.push_back(modelfilename);
 
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+      std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
 
-        for (const auto & filename : uniquePaths)
-        {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
-        }
-      } else{
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
+      for (const auto & filename : uniquePaths)
+      {
+        modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
       }
+    } else{
+      LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
     }
   }
 
@@ -63,9 +63,12 @@ namespace radiance {
 
     ForwardTranslator();
 
-    /** Translates a Model to radiance format in directory outPath
+    /** Translates a Model to radiance format in directory outPath. The scene files of the spaces are
+     *  formatted on up to numThreads threads (0 uses all processors), the output does not depend on
+     *  the number of threads.
      */
-    std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model);
+    std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model,
+                                                 unsigned numThreads = 0);
 
     /** Get warning messages generated by the last translation.
      */
@@ -172,7 +175,8 @@ namespace radiance {
 
       void buildingSpaces(const openstudio::path &t_radDir,
           const std::vector<openstudio::model::Space> &t_spaces,
-          std::vector<openstudio::path> &t_outpaths);
+          std::vector<openstudio::path> &t_outpaths,
+          unsigned numThreads);
 
     // get a bsdf possibly from the BCL
     boost::optional<openstudio::path> getBSDF(double vlt, double vltSpecular, const std::string& shadeType);
@@ -33,6 +33,9 @@
 
 #include <resources.hxx>
 
+#include <chrono>
+#include <fstream>
+#include <iostream>
 
 
 using namespace std;
@@ -80,3 +83,134 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Metrics)
+{
+  // 3 x 2 points, the second date and time comes first
+  openstudio::path path = toPath("./AnnualIlluminanceMap_Metrics.ill");
+  {
+    std::ofstream file(openstudio::toSystemFilename(path));
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 2 9 0 45 100 0 5 10 20 200 300\n";
+    file << "1 1 12 0 45 100 1 2 3 4 5 6\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(2u, map.dateTimes().size());
+
+  openstudio::Matrix jan1 = map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 12)));
+  ASSERT_EQ(3u, jan1.size1());
+  ASSERT_EQ(2u, jan1.size2());
+  EXPECT_NEAR(1*10.76, jan1(0,0), 1.0e-4);
+  EXPECT_NEAR(3*10.76, jan1(2,0), 1.0e-4);
+  EXPECT_NEAR(4*10.76, jan1(0,1), 1.0e-4);
+  EXPECT_NEAR(6*10.76, jan1(2,1), 1.0e-4);
+
+  openstudio::Matrix jan2 = map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 2), openstudio::Time(0, 9)));
+  ASSERT_EQ(3u, jan2.size1());
+  EXPECT_NEAR(200*10.76, jan2(1,1), 1.0e-3);
+
+  EXPECT_EQ(0u, map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 3), openstudio::Time(0, 9))).size1());
+
+  std::vector<double> illuminances = map.illuminances(1, 0);
+  ASSERT_EQ(2u, illuminances.size());
+  EXPECT_NEAR(5*10.76, illuminances[0], 1.0e-4);
+  EXPECT_NEAR(2*10.76, illuminances[1], 1.0e-4);
+  EXPECT_TRUE(map.illuminances(3, 0).empty());
+
+  openstudio::Matrix da = map.daylightAutonomy(100.0);
+  EXPECT_DOUBLE_EQ(0.0, da(0,0));
+  EXPECT_DOUBLE_EQ(0.0, da(1,0));
+  EXPECT_DOUBLE_EQ(0.5, da(2,0));
+  EXPECT_DOUBLE_EQ(0.5, da(0,1));
+  EXPECT_DOUBLE_EQ(0.5, da(1,1));
+  EXPECT_DOUBLE_EQ(0.5, da(2,1));
+
+  openstudio::Matrix udi = map.usefulDaylightIlluminance(100.0, 2000.0);
+  EXPECT_DOUBLE_EQ(0.0, udi(0,0));
+  EXPECT_DOUBLE_EQ(0.5, udi(0,1));
+  EXPECT_DOUBLE_EQ(0.0, udi(1,1));
+  EXPECT_DOUBLE_EQ(0.0, udi(2,1));
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_RepeatedDateTime)
+{
+  // the first date and time is repeated at the end, the last map read replaces the first one
+  openstudio::path path = toPath("./AnnualIlluminanceMap_RepeatedDateTime.ill");
+  {
+    std::ofstream file(openstudio::toSystemFilename(path));
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 2 9 0 45 100 0 5 10 20 200 300\n";
+    file << "1 1 12 0 45 100 1 2 3 4 5 6\n";
+    file << "1 2 9 0 45 100 10 10 10 10 10 10\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(2u, map.dateTimes().size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 2), openstudio::Time(0, 9)), map.dateTimes()[0]);
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 12)), map.dateTimes()[1]);
+
+  openstudio::Matrix jan2 = map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 2), openstudio::Time(0, 9)));
+  ASSERT_EQ(3u, jan2.size1());
+  EXPECT_NEAR(10*10.76, jan2(0,0), 1.0e-4);
+  EXPECT_NEAR(10*10.76, jan2(2,1), 1.0e-4);
+
+  std::vector<double> illuminances = map.illuminances(1, 0);
+  ASSERT_EQ(2u, illuminances.size());
+  EXPECT_NEAR(10*10.76, illuminances[0], 1.0e-4);
+  EXPECT_NEAR(2*10.76, illuminances[1], 1.0e-4);
+
+  // the replaced map is not counted
+  openstudio::Matrix da = map.daylightAutonomy(100.0);
+  openstudio::Matrix udi = map.usefulDaylightIlluminance(100.0, 2000.0);
+  for (unsigned j = 0; j < 2; ++j){
+    for (unsigned i = 0; i < 3; ++i){
+      EXPECT_DOUBLE_EQ(0.5, da(i,j));
+      EXPECT_DOUBLE_EQ(0.5, udi(i,j));
+    }
+  }
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, DISABLED_AnnualIlluminanceMap_Benchmark)
+{
+  // 8760 hours of a 50 x 50 map
+  openstudio::path path = toPath("./AnnualIlluminanceMap_Benchmark.ill");
+  {
+    std::ofstream file(openstudio::toSystemFilename(path));
+    file << "0 0 0 49 0 0 0 49 0\n";
+    file << "1 1 0\n";
+    for (unsigned d = 0; d < 365; ++d){
+      openstudio::Date date = openstudio::Date(openstudio::MonthOfYear::Jan, 1) + openstudio::Time(d);
+      for (unsigned h = 0; h < 24; ++h){
+        file << openstudio::month(date.monthOfYear()) << " " << date.dayOfMonth() << " " << h + 0.5 << " 0 45 100";
+        for (unsigned p = 0; p < 2500; ++p){
+          file << " " << ((d*24 + h)*7 + p*13) % 5000 / 10.0;
+        }
+        file << "\n";
+      }
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  AnnualIlluminanceMap map(path);
+  std::chrono::duration<double> loadTime = std::chrono::steady_clock::now() - start;
+  ASSERT_EQ(8760u, map.dateTimes().size());
+
+  start = std::chrono::steady_clock::now();
+  double sum = 0;
+  for (const openstudio::DateTime& dateTime : map.dateTimes()){
+    sum += map.illuminanceMap(dateTime)(0,0);
+  }
+  std::chrono::duration<double> mapTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  openstudio::Matrix da = map.daylightAutonomy(300.0);
+  openstudio::Matrix udi = map.usefulDaylightIlluminance();
+  std::chrono::duration<double> metricsTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << "load " << loadTime.count() << "s, 8760 illuminance maps " << mapTime.count() << "s, "
+            << "daylight autonomy and UDI " << metricsTime.count() << "s (" << sum + da(0,0) + udi(0,0) << ")" << std::endl;
+}
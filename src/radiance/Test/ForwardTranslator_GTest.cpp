@@ -35,6 +35,7 @@
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/SubSurface.hpp"
 #include "../../model/SubSurface_Impl.hpp"
@@ -53,9 +54,14 @@
 #include "../../utilities/geometry/Point3d.hpp"
 #include "../../utilities/geometry/Geometry.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <chrono>
+#include <fstream>
+#include <iterator>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -342,6 +348,73 @@ TEST(Radiance, ForwardTranslator_ExampleModel_NoThermalZoneLinks)
 
 }
 
+// adds copies of each space in the example model, side by side along the x axis
+Model largeExampleModel(unsigned numCopies){
+  Model model = exampleModel();
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  for (unsigned i = 1; i <= numCopies; ++i){
+    for (const Space& space : spaces){
+      Space copy = space.clone(model).cast<Space>();
+      copy.setXOrigin(space.xOrigin() + 100.0*i);
+      if (boost::optional<ThermalZone> thermalZone = space.thermalZone()){
+        copy.setThermalZone(*thermalZone);
+      }
+    }
+  }
+  return model;
+}
+
+std::string readFile(const openstudio::path& p){
+  std::ifstream file(openstudio::toSystemFilename(p), std::ios_base::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(Radiance, ForwardTranslator_NumThreads)
+{
+  Model model = largeExampleModel(2);
+
+  openstudio::path outpath1 = toPath("./ForwardTranslator_NumThreads1");
+  openstudio::path outpath4 = toPath("./ForwardTranslator_NumThreads4");
+  openstudio::filesystem::remove_all(outpath1);
+  openstudio::filesystem::remove_all(outpath4);
+
+  // both translators log to the same thread, so count the messages before the second translation
+  ForwardTranslator ft1;
+  std::vector<path> outpaths1 = ft1.translateModel(outpath1, model, 1);
+  std::size_t numErrors = ft1.errors().size();
+  std::size_t numWarnings = ft1.warnings().size();
+  ForwardTranslator ft4;
+  std::vector<path> outpaths4 = ft4.translateModel(outpath4, model, 4);
+
+  ASSERT_FALSE(outpaths1.empty());
+  ASSERT_EQ(outpaths1.size(), outpaths4.size());
+  for (unsigned i = 0; i < outpaths1.size(); ++i){
+    EXPECT_EQ(relativePath(outpaths1[i], outpath1), relativePath(outpaths4[i], outpath4));
+    EXPECT_EQ(readFile(outpaths1[i]), readFile(outpaths4[i])) << toString(outpaths1[i]);
+  }
+  EXPECT_EQ(numErrors, ft4.errors().size());
+  EXPECT_EQ(numWarnings, ft4.warnings().size());
+}
+
+TEST(Radiance, DISABLED_ForwardTranslator_Benchmark)
+{
+  Model model = largeExampleModel(100);
+
+  for (unsigned numThreads : {1u, 0u}){
+    openstudio::path outpath = toPath("./ForwardTranslator_Benchmark");
+    openstudio::filesystem::remove_all(outpath);
+
+    ForwardTranslator ft;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<path> outpaths = ft.translateModel(outpath, model, numThreads);
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    EXPECT_FALSE(outpaths.empty());
+
+    std::cout << "spaces " << model.getConcreteModelObjects<Space>().size() << " threads " << numThreads
+              << " files " << outpaths.size() << " export " << time.count() << "s" << std::endl;
+  }
+}
+
 TEST(Radiance, ForwardTranslator_formatString)
 {
   EXPECT_EQ("44", formatString(44.12345, 0));
@@ -355,4 +428,7 @@ TEST(Radiance, ForwardTranslator_formatString)
   EXPECT_EQ("0", formatString(0.4412345, 0));
   EXPECT_EQ("0.4", formatString(0.4412345, 1));
   EXPECT_EQ("0.44", formatString(0.4412345, 2));
+
+  EXPECT_EQ("-0.500", formatString(-0.5, 3));
+  EXPECT_EQ("1234567.125000000000000", formatString(1234567.125));
 }
@@ -40,7 +40,7 @@ namespace openstudio{
   {
     // DLM: why would you not want to set the members?
     if (setMembers) {
-      m_checksum = openstudio::checksum(m_path);
+      m_checksum = openstudio::cachedChecksum(m_path);
 
       std::string fileType = this->fileType();
       if (fileType == "osm"){
@@ -194,7 +194,7 @@ namespace openstudio{
 
   bool BCLFileReference::checkForUpdate()
   {
-    std::string newChecksum = openstudio::checksum(this->path());
+    std::string newChecksum = openstudio::cachedChecksum(this->path());
     if (m_checksum != newChecksum){
       m_checksum = newChecksum;
       return true;
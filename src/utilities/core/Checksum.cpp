@@ -29,60 +29,124 @@
 
 #include "Checksum.hpp"
 
-#include <sstream>
-
 #include <boost/crc.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c)
+    // Tables for computing the CRC-32 used by boost::crc_32_type eight bytes at a time
+    const std::array<std::array<std::uint32_t, 256>, 8>& crc32Tables()
+    {
+      static const std::array<std::array<std::uint32_t, 256>, 8> tables = []() {
+        std::array<std::array<std::uint32_t, 256>, 8> result;
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          std::uint32_t crc = i;
+          for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+          }
+          result[0][i] = crc;
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+          for (std::size_t t = 1; t < 8; ++t) {
+            result[t][i] = (result[t - 1][i] >> 8) ^ result[0][result[t - 1][i] & 0xFFu];
+          }
+        }
+        return result;
+      }();
+      return tables;
+    }
+
+    std::uint32_t crc32Update(std::uint32_t crc, const char* data, std::size_t size)
+    {
+      const auto& t = crc32Tables();
+      const auto* p = reinterpret_cast<const unsigned char*>(data);
+      while (size >= 8) {
+        std::uint32_t low = crc ^ (static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+                                   (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24));
+        std::uint32_t high = static_cast<std::uint32_t>(p[4]) | (static_cast<std::uint32_t>(p[5]) << 8) |
+                             (static_cast<std::uint32_t>(p[6]) << 16) | (static_cast<std::uint32_t>(p[7]) << 24);
+        crc = t[7][low & 0xFFu] ^ t[6][(low >> 8) & 0xFFu] ^ t[5][(low >> 16) & 0xFFu] ^ t[4][low >> 24] ^
+              t[3][high & 0xFFu] ^ t[2][(high >> 8) & 0xFFu] ^ t[1][(high >> 16) & 0xFFu] ^ t[0][high >> 24];
+        p += 8;
+        size -= 8;
+      }
+      while (size > 0) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFu];
+        ++p;
+        --size;
+      }
+      return crc;
+    }
+
+    // ignore just line feed, so files checksum the same with either line ending
+    std::uint32_t crc32UpdateIgnoringCR(std::uint32_t crc, const char* data, std::size_t size)
     {
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+      const char* end = data + size;
+      while (data < end) {
+        const char* cr = static_cast<const char*>(std::memchr(data, '\r', end - data));
+        const char* stop = cr ? cr : end;
+        crc = crc32Update(crc, data, stop - data);
+        data = cr ? cr + 1 : end;
+      }
+      return crc;
+    }
 
-      // ignore just line feed
-      bool result = (c == '\r');
+    std::string crc32ToString(std::uint32_t crc)
+    {
+      char result[9];
+      std::snprintf(result, sizeof(result), "%08X", static_cast<unsigned>(crc ^ 0xFFFFFFFFu));
+      return std::string(result, 8);
+    }
 
-      return result;
+    struct CachedChecksum
+    {
+      std::uintmax_t size;
+      std::time_t lastWriteTime;
+      std::time_t checkedTime;
+      std::string checksum;
+    };
+
+    std::mutex& checksumCacheMutex()
+    {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    std::map<path, CachedChecksum>& checksumCache()
+    {
+      static std::map<path, CachedChecksum> cache;
+      return cache;
     }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    return detail::crc32ToString(detail::crc32UpdateIgnoringCR(0xFFFFFFFFu, s.data(), s.size()));
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    std::uint32_t crc = 0xFFFFFFFFu;
+    std::vector<char> buffer(1 << 16);
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
+      is.read(buffer.data(), buffer.size());
+      crc = detail::crc32UpdateIgnoringCR(crc, buffer.data(), static_cast<std::size_t>(is.gcount()));
     } while ( is );
 
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
-
-    return result;
+    return detail::crc32ToString(crc);
   }
 
   /// return 8 character hex checksum of file contents
@@ -99,6 +163,41 @@ namespace openstudio {
     return result;
   }
 
+  std::string cachedChecksum(const path& p)
+  {
+    boost::system::error_code ec;
+    path key = openstudio::filesystem::system_complete(p, ec);
+    if (ec || !openstudio::filesystem::is_regular_file(key, ec)) {
+      return checksum(p);
+    }
+    std::uintmax_t size = openstudio::filesystem::file_size(key, ec);
+    if (ec) {
+      return checksum(p);
+    }
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time(key, ec);
+    if (ec) {
+      return checksum(p);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(detail::checksumCacheMutex());
+      auto it = detail::checksumCache().find(key);
+      // a file written in the same second it was checked may have changed without changing its time
+      if ((it != detail::checksumCache().end()) && (it->second.size == size) &&
+          (it->second.lastWriteTime == lastWriteTime) && (lastWriteTime < it->second.checkedTime))
+      {
+        return it->second.checksum;
+      }
+    }
+
+    std::time_t checkedTime = std::time(nullptr);
+    std::string result = checksum(key);
+
+    std::lock_guard<std::mutex> lock(detail::checksumCacheMutex());
+    detail::checksumCache()[key] = detail::CachedChecksum{size, lastWriteTime, checkedTime, result};
+    return result;
+  }
+
   int crc16(const char *ptr, int count) {
     // Simulate CRC-CCITT
     boost::crc_basic<16>  crc_ccitt1(0x1021, 0xFFFF, 0, false, false);
@@ -47,6 +47,11 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /** Returns the same checksum as checksum(const path&), reusing the checksum from an earlier call for the same
+   *  file if its size and last write time are unchanged. Meant for directories that are checked repeatedly,
+   *  such as those of measures. */
+  UTILITIES_API std::string cachedChecksum(const path& p);
+
   /// returns the CRC-16 checksum of the first len bytes of data.  Replaces Qt implementation qChecksum.
   UTILITIES_API int crc16(const char *ptr, int count);
 
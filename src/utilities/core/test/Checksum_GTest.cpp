@@ -35,9 +35,18 @@
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <random>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
+using openstudio::cachedChecksum;
 using openstudio::createUUID;
 using openstudio::StringVector;
 using openstudio::toString;
@@ -125,3 +134,90 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, MatchesBoostCrc)
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::string data(200000, ' ');
+  for (char& c : data) {
+    c = static_cast<char>(byte(gen));
+  }
+
+  // sizes around the read buffer and the eight byte stride
+  for (std::size_t size : {0u, 1u, 7u, 8u, 9u, 100u, 65535u, 65536u, 65537u, 200000u}) {
+    std::string s = data.substr(0, size);
+    std::string stripped = s;
+    stripped.erase(std::remove(stripped.begin(), stripped.end(), '\r'), stripped.end());
+    boost::crc_32_type crc;
+    crc.process_bytes(stripped.data(), stripped.size());
+    char expected[9];
+    snprintf(expected, sizeof(expected), "%08X", static_cast<unsigned>(crc.checksum()));
+
+    EXPECT_EQ(expected, checksum(s)) << size;
+    stringstream ss(s);
+    EXPECT_EQ(expected, checksum(ss)) << size;
+  }
+}
+
+TEST(Checksum, CachedChecksum)
+{
+  path p = resourcesPath() / toPath("utilities/Checksum/CachedChecksum.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", cachedChecksum(p));
+
+  // same size and most likely the same second, the file is checksummed again
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  EXPECT_EQ("D5682D26", cachedChecksum(p));
+
+  // once the file is older than the last check the cached value is used
+  std::time_t lastWriteTime = std::time(nullptr) - 10;
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("D5682D26", cachedChecksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("D5682D26", cachedChecksum(p));
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  // a change in size is always seen
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hithere";
+  }
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("597EA479", cachedChecksum(p));
+
+  openstudio::filesystem::remove(p);
+  EXPECT_EQ("00000000", cachedChecksum(p));
+}
+
+TEST(Checksum, DISABLED_Benchmark)
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::string data(64 * 1024 * 1024, ' ');
+  for (char& c : data) {
+    c = static_cast<char>(byte(gen));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::string result = checksum(data);
+  std::chrono::duration<double> checksumTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  boost::crc_32_type crc;
+  crc.process_bytes(data.data(), data.size());
+  std::chrono::duration<double> boostTime = std::chrono::steady_clock::now() - start;
+
+  cout << "64 MB checksum " << checksumTime.count() << "s, boost::crc_32_type " << boostTime.count() << "s" << endl;
+  EXPECT_EQ(8u, result.size());
+}
@@ -141,6 +141,60 @@ TEST_F(DataFixture,TimeSeries_IntervalConstructor)
   }
 }
 
+TEST_F(DataFixture, TimeSeries_SharedAxis)
+{
+  std::string units = "W";
+
+  DateTime firstDateTime(Date(MonthOfYear(MonthOfYear::Feb), 21), Time(0,1,0,0));
+  Time interval = Time(0,1,0,0);
+  TimeSeriesAxis axis(firstDateTime, interval, 3);
+  EXPECT_EQ(3u, axis.size());
+  EXPECT_EQ(firstDateTime, axis.firstReportDateTime());
+  ASSERT_TRUE(axis.intervalLength());
+  EXPECT_EQ(interval, *axis.intervalLength());
+
+  Vector values1(3);
+  Vector values2(3);
+  for (unsigned i = 0; i < 3; ++i){
+    values1(i) = i;
+    values2(i) = 2*i;
+  }
+
+  // series constructed from the same axis share their reporting times
+  TimeSeries timeSeries1(axis, values1, units);
+  TimeSeries timeSeries2(axis, std::move(values2), units);
+  EXPECT_TRUE(axis == timeSeries1.axis());
+  EXPECT_TRUE(timeSeries1.axis() == timeSeries2.axis());
+  EXPECT_EQ(3u, values1.size());
+  EXPECT_EQ(0u, values2.size()); // storage was taken over by timeSeries2
+
+  ASSERT_EQ(3u, timeSeries2.values().size());
+  for (unsigned i = 0; i < 3; ++i){
+    EXPECT_EQ(2*i, timeSeries2.values()[i]);
+  }
+  EXPECT_EQ(firstDateTime, timeSeries2.firstReportDateTime());
+  EXPECT_EQ(timeSeries1.secondsFromFirstReport(), timeSeries2.secondsFromFirstReport());
+  EXPECT_EQ(2*timeSeries1.integrate(), timeSeries2.integrate());
+  EXPECT_EQ(2, timeSeries2.value(firstDateTime + Time(0, 0, 60, 0)));
+
+  // scaling keeps the reporting times
+  TimeSeries scaled = 2*timeSeries1;
+  EXPECT_TRUE(scaled.axis() == timeSeries1.axis());
+  EXPECT_TRUE(timeSeries2.values() == scaled.values());
+
+  // series constructed separately do not share reporting times
+  Vector values3(3);
+  TimeSeries timeSeries3(firstDateTime, interval, std::move(values3), units);
+  EXPECT_EQ(0u, values3.size());
+  EXPECT_TRUE(timeSeries3.axis() != timeSeries1.axis());
+  EXPECT_EQ(timeSeries1.secondsFromFirstReport(), timeSeries3.secondsFromFirstReport());
+
+  // sizes must match
+  Vector values4(4);
+  EXPECT_THROW(TimeSeries(axis, values4, units), openstudio::Exception);
+  EXPECT_THROW(TimeSeries(axis, std::move(values4), units), openstudio::Exception);
+}
+
 TEST_F(DataFixture,TimeSeries_DetailedConstructor_FirstReport)
 {
   std::string units = "W";
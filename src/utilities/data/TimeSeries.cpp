@@ -30,6 +30,8 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+
 
 using namespace std;
 using namespace boost;
@@ -38,16 +40,13 @@ namespace openstudio{
 
 namespace detail{
 
-TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(unsigned numReports)
+  : m_secondsFromFirstReport(numReports), m_firstIntervalSeconds(0), m_wrapAround(false)
 {}
 
-TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const Date& startDate, const Time& intervalLength, unsigned numReports)
+  : m_secondsFromFirstReport(numReports), m_intervalLength(intervalLength), m_wrapAround(false)
 {
-  if (values.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-  }
-
   // length of interval in seconds
   int secondsPerInterval = intervalLength.totalSeconds();
 
@@ -57,35 +56,17 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 
   m_startDateTime = DateTime(startDate, Time(0));
 
-  for (unsigned i = 0; i < values.size(); ++i) {
+  m_firstIntervalSeconds = secondsPerInterval;
+  for (unsigned i = 0; i < numReports; ++i) {
     m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-  long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
   }
 
-  // check for wrap around
-  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-  if (!calendarYear) {
-    DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-    Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-    if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-      m_wrapAround = true;
-    }
-  }
+  checkWrapAround();
 }
 
-TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, unsigned numReports)
+  : m_secondsFromFirstReport(numReports), m_intervalLength(intervalLength), m_wrapAround(false)
 {
-  if (values.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-  }
-
   // length of interval in seconds
   int secondsPerInterval = intervalLength.totalSeconds();
 
@@ -94,284 +75,159 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 
   m_startDateTime = m_firstReportDateTime - intervalLength;
 
-  for (unsigned i = 0; i < values.size(); ++i) {
+  m_firstIntervalSeconds = secondsPerInterval;
+  for (unsigned i = 0; i < numReports; ++i) {
     m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
   }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
 
-  long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
-  }
-
-  // check for wrap around
-  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-  if (!calendarYear) {
-    DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-    Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-    if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-      m_wrapAround = true;
-    }
-  }
+  checkWrapAround();
 }
 
-TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays)
+  : m_firstReportDateTime(firstReportDateTime), m_startDateTime(firstReportDateTime), m_firstIntervalSeconds(0), m_wrapAround(false)
 {
-  if (timeInDays.size() != values.size()) {
-    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
-  }
-
-  if (values.empty() || timeInDays.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-    m_startDateTime = firstReportDateTime;
-    m_firstReportDateTime = firstReportDateTime;
-  } else {
-
-    // DLM: firstReportDateTime may or may not have baseYear defined
-    m_firstReportDateTime = firstReportDateTime;
-
-    std::copy(values.begin(), values.end(), m_values.begin());
-
-    if (timeInDays[0] == 0) { // This is the old, BROKEN way
-      int firstIntervalSeconds = firstReportDateTime.time().totalSeconds();
-      if (firstIntervalSeconds == 0) {
-        LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
-      }
-      LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
-      m_startDateTime = DateTime(m_firstReportDateTime.date());
-
-      for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
-        if (i > 0) {
-          if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
-            LOG_AND_THROW("Days from first report must be monotonically increasing");
-          }
-        }
-      }
-    } else { // This is the new way
-      m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
-      for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
-        if (i > 0) {
-          if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
-            LOG_AND_THROW("Days from first report must be monotonically increasing");
-          }
-        }
-      }
-    }
-
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
-
-    // check for wrap around
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-    if (!calendarYear) {
-      DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-      Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-      if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-        m_wrapAround = true;
-      }
-    }
-  }
+  setTimeInDays(timeInDays);
 }
 
-TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values, const std::string& units)
-  : m_secondsFromFirstReport(timeInDays.size()), m_secondsFromStart(values.size()), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays)
+  : m_firstReportDateTime(firstReportDateTime), m_startDateTime(firstReportDateTime), m_firstIntervalSeconds(0), m_wrapAround(false)
 {
+  setTimeInDays(timeInDays);
+}
 
-  if (timeInDays.size() != values.size()) {
-    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
+template <typename T>
+void TimeSeriesAxis_Impl::setTimeInDays(const T& timeInDays)
+{
+  if (timeInDays.empty()) {
+    return;
   }
 
-  if (values.empty() || timeInDays.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-    m_startDateTime = firstReportDateTime;
-    m_firstReportDateTime = firstReportDateTime;
-  } else {
-
-    // DLM: firstReportDateTime may or may not have baseYear defined
-    m_firstReportDateTime = firstReportDateTime;
-
-    std::copy(values.begin(), values.end(), m_values.begin());
-
-    if (timeInDays[0] == 0) { // This is the old, BROKEN way
-      int firstIntervalSeconds = firstReportDateTime.time().totalSeconds();
-      if (firstIntervalSeconds == 0) {
-        LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
-      }
-      LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
-      m_startDateTime = DateTime(m_firstReportDateTime.date());
+  m_secondsFromFirstReport.resize(timeInDays.size());
 
-      for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
-        if (i > 0) {
-          if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
-            LOG_AND_THROW("Days from first report must be monotonically increasing");
-          }
-        }
-      }
-    } else { // This is the new way
-      m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
-      for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
-        if (i > 0) {
-          if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
-            LOG_AND_THROW("Days from first report must be monotonically increasing");
-          }
+  if (timeInDays[0] == 0) { // This is the old, BROKEN way
+    int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
+    if (firstIntervalSeconds == 0) {
+      LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
+    }
+    LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
+    m_startDateTime = DateTime(m_firstReportDateTime.date());
+    m_firstIntervalSeconds = firstIntervalSeconds;
+
+    for (unsigned i = 0; i < timeInDays.size(); ++i) {
+      m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
+      if (i > 0) {
+        if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+          LOG_AND_THROW("Days from first report must be monotonically increasing");
         }
       }
     }
-
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
-
-    // check for wrap around
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-    if (!calendarYear) {
-      DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-      Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-      if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-        m_wrapAround = true;
+  } else { // This is the new way
+    m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+    m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
+    for (unsigned i = 0; i < timeInDays.size(); ++i) {
+      m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
+      if (i > 0) {
+        if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+          LOG_AND_THROW("Days from first report must be monotonically increasing");
+        }
       }
     }
   }
+
+  checkWrapAround();
 }
 
-TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const DateTimeVector& dateTimes, const boost::optional<DateTime>& startDateTime)
+  : m_secondsFromFirstReport(dateTimes.size()), m_firstIntervalSeconds(0), m_wrapAround(false)
 {
   // DLM: this seems to be a pretty fragile constructor with a lot going on
 
-  if (values.empty() || inDateTimes.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-  } else {
+  if (dateTimes.empty()) {
+    return;
+  }
 
-    bool extraTime(false);
-    DateTimeVector dateTimes = inDateTimes;
-    if (dateTimes.size() != values.size()) {
-      if (dateTimes.size() - 1 == values.size()) {
-        extraTime = true;
-        m_startDateTime = inDateTimes.front();
-        dateTimes = DateTimeVector(inDateTimes.cbegin() + 1, inDateTimes.cend());
-      } else {
-        LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << dateTimes.size() << ")");
-      }
-    }
+  // DLM: startDate may or may not have baseYear defined
+  m_firstReportDateTime = dateTimes.front();
+  // unsigned numDateTimes = dateTimes.size();
+  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
 
-    // DLM: startDate may or may not have baseYear defined
-    m_firstReportDateTime = dateTimes.front();
-    // unsigned numDateTimes = dateTimes.size();
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-
-    // Check for wrap around
-    m_wrapAround = false;
-    if (!calendarYear) {
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        if (dateTimes[i] < dateTimes[i - 1]) {
-          m_wrapAround = true;
-          break;
-        }
+  // Check for wrap around
+  if (!calendarYear) {
+    for (unsigned i = 1; i < dateTimes.size(); i++) {
+      if (dateTimes[i] < dateTimes[i - 1]) {
+        m_wrapAround = true;
+        break;
       }
     }
+  }
 
-    // Compute the seconds from first report
-    if (m_wrapAround) {
-      m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
-      int delta = 0;
-      DateTime firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(),
-        m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()), m_firstReportDateTime.time());
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        DateTime wrappedDateTime = DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(),
+  // Compute the seconds from first report
+  if (m_wrapAround) {
+    m_secondsFromFirstReport[0] = 0;
+    int delta = 0;
+    DateTime firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(),
+      m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()), m_firstReportDateTime.time());
+    for (unsigned i = 1; i < dateTimes.size(); i++) {
+      DateTime wrappedDateTime = DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(),
+        m_firstReportDateTime.date().year() + delta), dateTimes[i].time());
+      if (wrappedDateTime < dateTimes[i - 1]) {
+        ++delta;
+        wrappedDateTime = DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(),
           m_firstReportDateTime.date().year() + delta), dateTimes[i].time());
-        if (wrappedDateTime < dateTimes[i - 1]) {
-          ++delta;
-          wrappedDateTime = DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(),
-            m_firstReportDateTime.date().year() + delta), dateTimes[i].time());
-        }
-        m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-        m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-      }
-    } else {
-      m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-        m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
       }
+      m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
     }
-
+  } else {
+    m_secondsFromFirstReport[0] = 0;
     for (unsigned i = 1; i < dateTimes.size(); i++) {
-      if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
-        LOG_AND_THROW("Dates from first report must be monotonically increasing");
-      }
+      m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
     }
+  }
 
-    // Try to get a start time if we don't have one already
-    if (!extraTime) {
-      int delta;
-      bool foundInterval = false;
-      if (m_secondsFromStart.size() > 1) {
-        // check if all data is reported at a constant interval
-        delta = m_secondsFromStart[1] - m_secondsFromStart[0];
-        foundInterval = true;
-        for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-          if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1])
-            foundInterval = false;
-          break;
-        }
-      }
-      if (foundInterval) {
-        // DLM: shouldn't we also set m_intervalLength here?
-        // DLM: we could but some behavior seems to expect this to stay unset, TEST_F(DataFixture,TimeSeries_DetailedConstructor_WrapAroundDates)
-        //m_intervalLength = Time(0, 0, 0, delta);
-        m_startDateTime = m_firstReportDateTime - Time(0, 0, 0, delta);
-      } else {
-        if (m_firstReportDateTime.time().totalSeconds() == 0) {
-          LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
-        }
-        LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
-        m_startDateTime = DateTime(m_firstReportDateTime.date());
-      }
+  for (unsigned i = 1; i < dateTimes.size(); i++) {
+    if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+      LOG_AND_THROW("Dates from first report must be monotonically increasing");
     }
+  }
 
-    int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-    // Compute the seconds from start
-    m_secondsFromStart[0] = firstIntervalSeconds;
-    for (unsigned i = 1; i < dateTimes.size(); i++) {
-      m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
+  // Try to get a start time if we don't have one already
+  if (startDateTime) {
+    m_startDateTime = *startDateTime;
+  } else {
+    int delta;
+    bool foundInterval = false;
+    if (m_secondsFromFirstReport.size() > 1) {
+      // check if all data is reported at a constant interval
+      delta = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
+      foundInterval = true;
+      for (unsigned i = 2; i < m_secondsFromFirstReport.size(); i++) {
+        if (delta != m_secondsFromFirstReport[i] - m_secondsFromFirstReport[i - 1])
+          foundInterval = false;
+        break;
+      }
+    }
+    if (foundInterval) {
+      // DLM: shouldn't we also set m_intervalLength here?
+      // DLM: we could but some behavior seems to expect this to stay unset, TEST_F(DataFixture,TimeSeries_DetailedConstructor_WrapAroundDates)
+      //m_intervalLength = Time(0, 0, 0, delta);
+      m_startDateTime = m_firstReportDateTime - Time(0, 0, 0, delta);
+    } else {
+      if (m_firstReportDateTime.time().totalSeconds() == 0) {
+        LOG_AND_THROW("Cannot calculate the series start date for first report at the beginning of a day");
+      }
+      LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
+      m_startDateTime = DateTime(m_firstReportDateTime.date());
     }
-
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
   }
+
+  m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
 }
 
-TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+TimeSeriesAxis_Impl::TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds)
+  : m_firstReportDateTime(firstReportDateTime), m_startDateTime(firstReportDateTime), m_secondsFromFirstReport(timeInSeconds.size()),
+    m_firstIntervalSeconds(0), m_wrapAround(false)
 {
-  if (timeInSeconds.size() != values.size()) {
-    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
-  }
-  if (values.empty() || timeInSeconds.empty()) {
-    LOG(Warn, "Creating empty timeseries");
-    m_startDateTime = firstReportDateTime;
-    m_firstReportDateTime = firstReportDateTime;
-  } else {
+  if (!timeInSeconds.empty()) {
     // Check that seconds are monotonic
     for (unsigned i = 1; i < timeInSeconds.size(); ++i) {
       if (timeInSeconds[i] < timeInSeconds[i - 1]) {
@@ -385,29 +241,26 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(firstReportDateTime.date());
-      m_firstReportDateTime = firstReportDateTime;
-      int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-      m_secondsFromStart = timeInSeconds;
-      for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-        m_secondsFromStart[i] += firstIntervalSeconds;
-      }
+      m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
       m_secondsFromFirstReport = timeInSeconds;
 
     } else { // This is the new behavior
       m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
-      m_firstReportDateTime = firstReportDateTime;
-      m_secondsFromStart = timeInSeconds;
+      m_firstIntervalSeconds = timeInSeconds[0];
 
       // Get rid of this later
       m_secondsFromFirstReport[0] = 0;
-      for (unsigned i = 1; i < values.size(); ++i) {
+      for (unsigned i = 1; i < timeInSeconds.size(); ++i) {
         m_secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
       }
     }
   }
 
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+  checkWrapAround();
+}
 
+void TimeSeriesAxis_Impl::checkWrapAround()
+{
   long durationSeconds = 0;
   if (!m_secondsFromFirstReport.empty()) {
     durationSeconds = m_secondsFromFirstReport.back();
@@ -424,17 +277,142 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
   }
 }
 
+const DateTime& TimeSeriesAxis_Impl::firstReportDateTime() const
+{
+  return m_firstReportDateTime;
+}
+
+const std::vector<long>& TimeSeriesAxis_Impl::secondsFromFirstReport() const
+{
+  return m_secondsFromFirstReport;
+}
+
+long TimeSeriesAxis_Impl::firstIntervalSeconds() const
+{
+  return m_firstIntervalSeconds;
+}
+
+const OptionalTime& TimeSeriesAxis_Impl::intervalLength() const
+{
+  return m_intervalLength;
+}
+
+bool TimeSeriesAxis_Impl::wrapAround() const
+{
+  return m_wrapAround;
+}
+
+std::size_t TimeSeriesAxis_Impl::size() const
+{
+  return m_secondsFromFirstReport.size();
+}
+
+TimeSeries_Impl::TimeSeries_Impl()
+  : m_axis(std::make_shared<const TimeSeriesAxis_Impl>()), m_outOfRangeValue(0.0)
+{}
+
+TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
+  : m_axis(std::make_shared<const TimeSeriesAxis_Impl>(startDate, intervalLength, values.size())), m_values(values), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
+  : m_axis(std::make_shared<const TimeSeriesAxis_Impl>(firstReportDateTime, intervalLength, values.size())), m_values(values), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
+  : m_values(values), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (timeInDays.size() != values.size()) {
+    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
+  }
+
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+
+  m_axis = std::make_shared<const TimeSeriesAxis_Impl>(firstReportDateTime, timeInDays);
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values, const std::string& units)
+  : m_values(createVector(values)), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (timeInDays.size() != values.size()) {
+    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
+  }
+
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+
+  m_axis = std::make_shared<const TimeSeriesAxis_Impl>(firstReportDateTime, timeInDays);
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& dateTimes, const Vector& values, const std::string& units)
+  : m_values(values), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (values.empty() || dateTimes.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+    m_axis = std::make_shared<const TimeSeriesAxis_Impl>(values.size());
+  } else if (dateTimes.size() == values.size()) {
+    m_axis = std::make_shared<const TimeSeriesAxis_Impl>(dateTimes, boost::none);
+  } else if (dateTimes.size() - 1 == values.size()) {
+    // the first date time is the start of the series
+    m_axis = std::make_shared<const TimeSeriesAxis_Impl>(DateTimeVector(dateTimes.cbegin() + 1, dateTimes.cend()), dateTimes.front());
+  } else {
+    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << dateTimes.size() << ")");
+  }
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
+  : m_values(values), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (timeInSeconds.size() != values.size()) {
+    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
+  }
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+
+  m_axis = std::make_shared<const TimeSeriesAxis_Impl>(firstReportDateTime, timeInSeconds);
+}
+
+TimeSeries_Impl::TimeSeries_Impl(const std::shared_ptr<const TimeSeriesAxis_Impl>& axis, Vector&& values, const std::string& units)
+  : m_axis(axis), m_units(units), m_outOfRangeValue(0.0)
+{
+  if (m_axis->size() != values.size()) {
+    LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << m_axis->size() << ")");
+  }
+  if (values.empty()) {
+    LOG(Warn, "Creating empty timeseries");
+  }
+
+  m_values.swap(values);
+}
+
+std::shared_ptr<const TimeSeriesAxis_Impl> TimeSeries_Impl::axis() const
+{
+  return m_axis;
+}
+
 /// interval length if any
 OptionalTime TimeSeries_Impl::intervalLength() const
 {
-  return m_intervalLength;
+  return m_axis->intervalLength();
 }
 
 DateTimeVector TimeSeries_Impl::dateTimes() const
 {
-  DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+  DateTimeVector dateTimeObjs(m_axis->secondsFromFirstReport().size());
+  for (unsigned i = 0; i < m_axis->secondsFromFirstReport().size(); i++) {
+    dateTimeObjs[i] = m_axis->firstReportDateTime() + openstudio::Time(0, 0, 0, m_axis->secondsFromFirstReport()[i]);
   }
   return dateTimeObjs;
 }
@@ -442,9 +420,9 @@ DateTimeVector TimeSeries_Impl::dateTimes() const
 /// time in days from end of the first reporting interval
 Vector TimeSeries_Impl::daysFromFirstReport() const
 {
-  Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  Vector daysFromFirstReport(m_axis->secondsFromFirstReport().size());
+  for (unsigned i = 0; i < m_axis->secondsFromFirstReport().size(); i++) {
+    daysFromFirstReport[i] = Time(0, 0, 0, m_axis->secondsFromFirstReport()[i]).totalDays();
   }
   return daysFromFirstReport;
 }
@@ -453,8 +431,8 @@ Vector TimeSeries_Impl::daysFromFirstReport() const
 double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 {
   double value = m_outOfRangeValue;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  if (i < m_axis->secondsFromFirstReport().size()) {
+    value = Time(0, 0, 0, m_axis->secondsFromFirstReport()[i]).totalDays();
   }
   return value;
 }
@@ -462,7 +440,7 @@ double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 /// time in seconds from end of the first reporting interval
 std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const
 {
-  return m_secondsFromFirstReport;
+  return m_axis->secondsFromFirstReport();
 }
 
 /// time in seconds from end of the first reporting interval at index i
@@ -470,8 +448,8 @@ long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const
 {
   //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
   long value = 0;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = m_secondsFromFirstReport[i];
+  if (i < m_axis->secondsFromFirstReport().size()) {
+    value = m_axis->secondsFromFirstReport()[i];
   }
   return value;
 }
@@ -501,7 +479,7 @@ const std::string TimeSeries_Impl::units() const
 /// first report date
 openstudio::DateTime TimeSeries_Impl::firstReportDateTime() const
 {
-  return m_firstReportDateTime;
+  return m_axis->firstReportDateTime();
 }
 
 /// get value at number of seconds from start date and time
@@ -509,25 +487,25 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
 {
   double result = m_outOfRangeValue;
 
-  if (m_secondsFromFirstReport.empty()) {
+  if (m_axis->secondsFromFirstReport().empty()) {
     LOG(Debug, "Cannot compute value because timeseries is empty");
     return result;
   }
 
-  long duration = m_secondsFromFirstReport.back();
+  long duration = m_axis->secondsFromFirstReport().back();
 
-  if (m_intervalLength) {
+  if (m_axis->intervalLength()) {
 
     // before the start of the first interval
-    if (secondsFromFirstReport <= -m_intervalLength->totalSeconds()) {
-      LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds before first reporting time when interval length is " << *m_intervalLength);
+    if (secondsFromFirstReport <= -m_axis->intervalLength()->totalSeconds()) {
+      LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds before first reporting time when interval length is " << *m_axis->intervalLength());
     } else if (secondsFromFirstReport > duration) {
       // after end of time series
       LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
     } else {
       // faster look up if know we have fixed interval
-      unsigned numIntervals = secondsFromFirstReport / m_intervalLength->totalSeconds();
-      unsigned remainder = secondsFromFirstReport % m_intervalLength->totalSeconds();
+      unsigned numIntervals = secondsFromFirstReport / m_axis->intervalLength()->totalSeconds();
+      unsigned remainder = secondsFromFirstReport % m_axis->intervalLength()->totalSeconds();
       unsigned index;
       if (secondsFromFirstReport < 0) {
         OS_ASSERT(numIntervals == 0);
@@ -556,8 +534,13 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
       // after end of time series
       LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
     } else {
-      // normal interpolation
-      result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+      // normal interpolation, hold the value of the next report
+      const std::vector<long>& seconds = m_axis->secondsFromFirstReport();
+      std::size_t index = seconds.size() - 1;
+      if (secondsFromFirstReport < duration) {
+        index = std::lower_bound(seconds.begin(), seconds.end(), secondsFromFirstReport) - seconds.begin();
+      }
+      result = m_values[index];
     }
   }
 
@@ -579,14 +562,14 @@ double TimeSeries_Impl::value(const Time& timeFromFirstReport) const
 /// get value at date and time
 double TimeSeries_Impl::value(const DateTime& dateTime) const
 {
-  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
+  boost::optional<int> calendarYear = m_axis->firstReportDateTime().date().baseYear();
 
   // If our timeseries doesn't have a year, we force it to the assumed one
-  DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
-  int timeSeriesYear = m_firstReportDateTime.date().year();
+  DateTime firstReportDateTimeWithYear = m_axis->firstReportDateTime();
+  int timeSeriesYear = m_axis->firstReportDateTime().date().year();
   if (!calendarYear) {
-    firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), timeSeriesYear),
-                                           m_firstReportDateTime.time());
+    firstReportDateTimeWithYear = DateTime(Date(m_axis->firstReportDateTime().date().monthOfYear(), m_axis->firstReportDateTime().date().dayOfMonth(), timeSeriesYear),
+                                           m_axis->firstReportDateTime().time());
   }
 
   // If our requested datetime doesn't have an assigned year, we default to the one of the **TimeSeries** (whether hard assigned or not)
@@ -600,16 +583,16 @@ double TimeSeries_Impl::value(const DateTime& dateTime) const
 
     int secondsFromFirstReport = (dateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
-    // If it's negative, then: if m_intervalLength exist we check that it's even bigger than intervalLength,
+    // If it's negative, then: if the interval length is known we check that it's even bigger than the interval length,
     // in which case we do shift to next year, otherwise we do nothing
     // This allows passing "2005-01-01 00:01:00" to report at "2005-01-01 01:00:00" (historical behavior)
     // cf valueAtSecondsFromFirstReport which will allow it
-    if (secondsFromFirstReport < 0 && (!m_intervalLength || secondsFromFirstReport <= -m_intervalLength->totalSeconds())) {
+    if (secondsFromFirstReport < 0 && (!m_axis->intervalLength() || secondsFromFirstReport <= -m_axis->intervalLength()->totalSeconds())) {
       dateTimeWithYear = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth(), timeSeriesYear + 1), dateTime.time());
     }
   }
 
-  LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime);
+  LOG(Debug, "Initial: dateTime=" << dateTime << ", first report=" << m_axis->firstReportDateTime());
   LOG(Debug, "Querying with dateTimeWithYear=" << dateTimeWithYear <<  ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
 
   return value(dateTimeWithYear - firstReportDateTimeWithYear);
@@ -618,13 +601,13 @@ double TimeSeries_Impl::value(const DateTime& dateTime) const
 /// get values between start and end date times
 Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& endDateTime) const
 {
-  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
+  boost::optional<int> calendarYear = m_axis->firstReportDateTime().date().baseYear();
 
   // If our timeseries doesn't have a year, we force it to the assumed one
-  DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
-  int timeSeriesYear = m_firstReportDateTime.date().year();
+  DateTime firstReportDateTimeWithYear = m_axis->firstReportDateTime();
+  int timeSeriesYear = m_axis->firstReportDateTime().date().year();
   if (!calendarYear) {
-    firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), timeSeriesYear), m_firstReportDateTime.time());
+    firstReportDateTimeWithYear = DateTime(Date(m_axis->firstReportDateTime().date().monthOfYear(), m_axis->firstReportDateTime().date().dayOfMonth(), timeSeriesYear), m_axis->firstReportDateTime().time());
   }
 
   // If our requested start doen't have an assigned year, we default to the one of the **TimeSeries** (whether hard assigned or not)
@@ -657,7 +640,7 @@ Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& en
   }
 
   LOG(Debug, "Initial: startDateTime=" << startDateTime << ", endDateTime=" << endDateTime <<
-      ", m_firstReportDateTime=" << m_firstReportDateTime);
+      ", first report=" << m_axis->firstReportDateTime());
   LOG(Debug, "Querying with startDateTimeWithYear=" << startDateTimeWithYear << ", endDateTimeWithYear=" << endDateTimeWithYear
       <<  ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
 
@@ -665,13 +648,13 @@ Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& en
   double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
   unsigned numValues = m_values.size();
-  OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+  OS_ASSERT(numValues == m_axis->secondsFromFirstReport().size());
 
   Vector result(numValues);
   unsigned resultSize = 0;
   for (unsigned i = 0; i < numValues; ++i) {
-    if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) &&
-      (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+    if ((m_axis->secondsFromFirstReport()[i] >= startSecondsFromFirstReport) &&
+      (m_axis->secondsFromFirstReport()[i] <= endSecondsFromFirstReport)) {
       result[resultSize] = m_values[i];
       ++resultSize;
     }
@@ -777,33 +760,29 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
 }
 
 std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
-  if (m_intervalLength) {
-    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime,
-      m_intervalLength.get(),
-      m_values*d,
-      m_units));
-  }
-  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime,
-    m_secondsFromFirstReport,
-    m_values*d,
-    m_units));
+  // the result is reported at the same times
+  Vector values = m_values*d;
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_axis, std::move(values), m_units));
 }
 
 double TimeSeries_Impl::integrate() const
 {
   double result = 0;
-  if (m_intervalLength) {
-    int secs = m_intervalLength.get().totalSeconds();
+  if (m_axis->intervalLength()) {
+    int secs = m_axis->intervalLength().get().totalSeconds();
     // Use a Riemann sum to integrate under the curve
     for (unsigned i = 0; i < m_values.size(); i++) {
       result += secs * m_values[i];
     }
   } else {
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    long firstIntervalSeconds = m_axis->firstIntervalSeconds();
     double lastTime = 0;
     // Use a Riemann sum to integrate under the curve
     for (unsigned i = 0; i < m_values.size(); i++) {
-      result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-      lastTime = m_secondsFromStart[i];
+      double secondsFromStart = secondsFromFirstReport[i] + firstIntervalSeconds;
+      result += (secondsFromStart - lastTime) * m_values[i];
+      lastTime = secondsFromStart;
     }
   }
   return result;
@@ -811,14 +790,60 @@ double TimeSeries_Impl::integrate() const
 
 double TimeSeries_Impl::averageValue() const
 {
-  if (m_secondsFromStart.size() > 0) {
-    return integrate() / m_secondsFromStart.back();
+  if (m_axis->size() > 0) {
+    return integrate() / (m_axis->secondsFromFirstReport().back() + m_axis->firstIntervalSeconds());
   }
   return 0;
 }
 
 } // detail
 
+TimeSeriesAxis::TimeSeriesAxis() :
+m_impl(std::make_shared<const detail::TimeSeriesAxis_Impl>())
+{}
+
+TimeSeriesAxis::TimeSeriesAxis(const DateTime& firstReportDateTime, const Time& intervalLength, unsigned numReports) :
+m_impl(std::make_shared<const detail::TimeSeriesAxis_Impl>(firstReportDateTime, intervalLength, numReports))
+{}
+
+TimeSeriesAxis::TimeSeriesAxis(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds) :
+m_impl(std::make_shared<const detail::TimeSeriesAxis_Impl>(firstReportDateTime, timeInSeconds))
+{}
+
+TimeSeriesAxis::TimeSeriesAxis(std::shared_ptr<const detail::TimeSeriesAxis_Impl> impl)
+  : m_impl(impl)
+{}
+
+openstudio::OptionalTime TimeSeriesAxis::intervalLength() const
+{
+  return m_impl->intervalLength();
+}
+
+openstudio::DateTime TimeSeriesAxis::firstReportDateTime() const
+{
+  return m_impl->firstReportDateTime();
+}
+
+std::vector<long> TimeSeriesAxis::secondsFromFirstReport() const
+{
+  return m_impl->secondsFromFirstReport();
+}
+
+unsigned TimeSeriesAxis::size() const
+{
+  return m_impl->size();
+}
+
+bool TimeSeriesAxis::operator==(const TimeSeriesAxis& other) const
+{
+  return (m_impl == other.m_impl);
+}
+
+bool TimeSeriesAxis::operator!=(const TimeSeriesAxis& other) const
+{
+  return (m_impl != other.m_impl);
+}
+
 TimeSeries::TimeSeries() :
 m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl()))
 {}
@@ -847,6 +872,31 @@ TimeSeries::TimeSeries(const DateTime& firstReportDateTime, const std::vector<lo
 m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl(firstReportDateTime, timeInSeconds, values, units)))
 {}
 
+TimeSeries::TimeSeries(const Date& startDate, const Time& intervalLength, Vector&& values, const std::string& units) :
+m_impl(std::make_shared<detail::TimeSeries_Impl>(std::make_shared<const detail::TimeSeriesAxis_Impl>(startDate, intervalLength, values.size()), std::move(values), units))
+{}
+
+TimeSeries::TimeSeries(const DateTime& firstReportDateTime, const Time& intervalLength, Vector&& values, const std::string& units) :
+m_impl(std::make_shared<detail::TimeSeries_Impl>(std::make_shared<const detail::TimeSeriesAxis_Impl>(firstReportDateTime, intervalLength, values.size()), std::move(values), units))
+{}
+
+TimeSeries::TimeSeries(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, Vector&& values, const std::string& units) :
+m_impl(std::make_shared<detail::TimeSeries_Impl>(std::make_shared<const detail::TimeSeriesAxis_Impl>(firstReportDateTime, timeInSeconds), std::move(values), units))
+{}
+
+TimeSeries::TimeSeries(const TimeSeriesAxis& axis, const Vector& values, const std::string& units) :
+m_impl(std::make_shared<detail::TimeSeries_Impl>(axis.m_impl, Vector(values), units))
+{}
+
+TimeSeries::TimeSeries(const TimeSeriesAxis& axis, Vector&& values, const std::string& units) :
+m_impl(std::make_shared<detail::TimeSeries_Impl>(axis.m_impl, std::move(values), units))
+{}
+
+TimeSeriesAxis TimeSeries::axis() const
+{
+  return TimeSeriesAxis(m_impl->axis());
+}
+
 openstudio::OptionalTime TimeSeries::intervalLength() const
 {
   return m_impl->intervalLength();
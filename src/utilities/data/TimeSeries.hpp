@@ -46,6 +46,70 @@ namespace openstudio{
 
 namespace detail{
 
+/// Reporting times of a TimeSeries, never modified after construction so that it can be shared by all series
+/// reported at the same times.
+class UTILITIES_API TimeSeriesAxis_Impl
+{
+public:
+
+  // numReports reports at the first report date and time, only used for degenerate input
+  explicit TimeSeriesAxis_Impl(unsigned numReports = 0);
+
+  TimeSeriesAxis_Impl(const Date& startDate, const Time& intervalLength, unsigned numReports);
+
+  TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, unsigned numReports);
+
+  TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays);
+
+  TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays);
+
+  // if startDateTime is not given it is computed from dateTimes
+  TimeSeriesAxis_Impl(const DateTimeVector& dateTimes, const boost::optional<DateTime>& startDateTime);
+
+  TimeSeriesAxis_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds);
+
+  const DateTime& firstReportDateTime() const;
+
+  const std::vector<long>& secondsFromFirstReport() const;
+
+  // seconds from the start of the series to the first report
+  long firstIntervalSeconds() const;
+
+  const OptionalTime& intervalLength() const;
+
+  bool wrapAround() const;
+
+  std::size_t size() const;
+
+private:
+
+  REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+  template <typename T>
+  void setTimeInDays(const T& timeInDays);
+
+  // sets m_wrapAround from the duration of the series
+  void checkWrapAround();
+
+  // fully qualified first report date
+  DateTime m_firstReportDateTime;
+
+  // start date and time of time series
+  DateTime m_startDateTime;
+
+  // integer seconds from first report date time, used for quick interpolation
+  std::vector<long> m_secondsFromFirstReport;
+
+  // seconds from m_startDateTime to m_firstReportDateTime, seconds from start are seconds from first report plus this
+  long m_firstIntervalSeconds;
+
+  // length of the reporting interval if known, can be used to speed up interpolation
+  OptionalTime m_intervalLength;
+
+  // true if the time series should support wrap around dates, e.g. 4/11-4/10 without specific year
+  bool m_wrapAround;
+};
+
 class UTILITIES_API TimeSeries_Impl
 {
 public:
@@ -64,8 +128,13 @@ public:
 
   TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units);
 
+  // adopts the buffer of values
+  TimeSeries_Impl(const std::shared_ptr<const TimeSeriesAxis_Impl>& axis, Vector&& values, const std::string& units);
+
   ~TimeSeries_Impl() {}
 
+  std::shared_ptr<const TimeSeriesAxis_Impl> axis() const;
+
   openstudio::OptionalTime intervalLength() const;
 
   openstudio::DateTime firstReportDateTime() const;
@@ -113,34 +182,74 @@ public:
 private:
 
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
-  // fully qualified first report date
-  DateTime m_firstReportDateTime;
 
-  // start date and time of time series
-  DateTime m_startDateTime;
+  // reporting times, shared with other series reported at the same times
+  std::shared_ptr<const TimeSeriesAxis_Impl> m_axis;
 
-  // integer seconds from first report date time, used for quick interpolation
-  std::vector<long> m_secondsFromFirstReport;
-  Vector m_secondsFromFirstReportAsVector; // same as m_secondsFromFirstReport but stored as Vector
-  std::vector<long> m_secondsFromStart;
-
-  // values reported at m_dateTimes
+  // one value per reporting time
   Vector m_values;
 
   // units of the values
   std::string m_units;
 
-  // length of the reporting interval if known, can be used to speed up interpolation
-  OptionalTime m_intervalLength;
-
   // value used for out of range data
   double m_outOfRangeValue;
-
-  // true if the time series should support wrap around dates, e.g. 4/11-4/10 without specific year
-  bool m_wrapAround;
 };
 } // detail
 
+/** TimeSeriesAxis holds the times at which the values of a TimeSeries are reported. It cannot be changed once
+ *  constructed, TimeSeries reported at the same times can be constructed from one TimeSeriesAxis and then share its
+ *  storage instead of each holding their own copy of the reporting times. */
+class UTILITIES_API TimeSeriesAxis
+{
+public:
+  /** @name Constructors */
+  //@{
+
+  /// Default constructor with no reports.
+  TimeSeriesAxis();
+
+  /** Constructor from first report date and time, interval length, and number of reports.
+   *  First reporting interval starts at firstReportDateTime - intervalLength and ends at firstReportDateTime. */
+  TimeSeriesAxis(const DateTime& firstReportDateTime, const Time& intervalLength, unsigned numReports);
+
+  /** Constructor from first report date and time and time in seconds, with the same treatment of the time vector and
+   *  the same exceptions as the TimeSeries constructor from time in seconds. */
+  TimeSeriesAxis(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /// Returns the interval length if any
+  openstudio::OptionalTime intervalLength() const;
+
+  /// Returns the date and time of first report value
+  openstudio::DateTime firstReportDateTime() const;
+
+  /// Returns the time in seconds from end of the first reporting interval
+  std::vector<long> secondsFromFirstReport() const;
+
+  /// Returns the number of reports
+  unsigned size() const;
+
+  //@}
+
+  /// Returns true if both share the same underlying reporting times
+  bool operator==(const TimeSeriesAxis& other) const;
+
+  /// Returns true if the underlying reporting times are not shared
+  bool operator!=(const TimeSeriesAxis& other) const;
+
+private:
+
+  friend class TimeSeries;
+
+  TimeSeriesAxis(std::shared_ptr<const detail::TimeSeriesAxis_Impl> impl);
+
+  std::shared_ptr<const detail::TimeSeriesAxis_Impl> m_impl;
+};
+
 /** TimeSeries is a series of values each reported at a single time.  We follow the EnergyPlus
  *   convention that the time reported for each value is at the end of the reporting interval.  For example, if a value
  *   is measured over the interval from hour 1 (non-inclusive) to hour 2 (inclusive), that is 1 < t <= 2, and the reported
@@ -214,6 +323,26 @@ public:
    *   - start date and time of first reporting interval cannot be determined */
   TimeSeries(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units);
 
+  /** Constructor from start date, interval length, values, and units that takes over the storage of values instead
+   *  of copying it. */
+  TimeSeries(const Date& startDate, const Time& intervalLength, Vector&& values, const std::string& units);
+
+  /** Constructor from first report date and time, interval length, values, and units that takes over the storage of
+   *  values instead of copying it. */
+  TimeSeries(const DateTime& firstReportDateTime, const Time& intervalLength, Vector&& values, const std::string& units);
+
+  /** Constructor from first report date and time, time in seconds, values, and units that takes over the storage of
+   *  values instead of copying it. */
+  TimeSeries(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, Vector&& values, const std::string& units);
+
+  /** Constructor from reporting times, values, and units. The reporting times are shared with axis and any other
+   *  TimeSeries constructed from it. An exception is thrown if axis.size != values.size */
+  TimeSeries(const TimeSeriesAxis& axis, const Vector& values, const std::string& units);
+
+  /** Constructor from reporting times, values, and units that takes over the storage of values instead of copying it.
+   *  An exception is thrown if axis.size != values.size */
+  TimeSeries(const TimeSeriesAxis& axis, Vector&& values, const std::string& units);
+
   /// Virtual destructor
   ~TimeSeries() {}
 
@@ -221,6 +350,9 @@ public:
   /** @name Getters */
   //@{
 
+  /// Returns the reporting times, which can be used to construct other TimeSeries reported at the same times
+  TimeSeriesAxis axis() const;
+
   /// Returns the interval length if any
   openstudio::OptionalTime intervalLength() const;
 
@@ -11,6 +11,12 @@
 
 %ignore openstudio::detail;
 
+// constructors that take over the storage of values are not useful from the bindings
+%ignore openstudio::TimeSeries::TimeSeries(const openstudio::Date&, const openstudio::Time&, openstudio::Vector&&, const std::string&);
+%ignore openstudio::TimeSeries::TimeSeries(const openstudio::DateTime&, const openstudio::Time&, openstudio::Vector&&, const std::string&);
+%ignore openstudio::TimeSeries::TimeSeries(const openstudio::DateTime&, const std::vector<long>&, openstudio::Vector&&, const std::string&);
+%ignore openstudio::TimeSeries::TimeSeries(const openstudio::TimeSeriesAxis&, openstudio::Vector&&, const std::string&);
+
 %template(TimeSeriesPtr) std::shared_ptr<openstudio::TimeSeries>;
 
 // create an instantiation of the optional class
@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "EpwFile.hpp"
+#include "EpwFile_Impl.hpp"
 #include "../idf/IdfObject.hpp"
 #include "../idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
@@ -39,6 +40,11 @@
 
 #include <fmt/format.h>
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
 namespace openstudio{
 
   static double psat(double T)
@@ -1639,6 +1645,43 @@ namespace openstudio{
     return value;
   }
 
+  // Counterparts of stringToInteger and stringToDouble for fields that are views into a line
+  static const char* terminatedField(std::string_view field, char (&buffer)[64], std::string& longField)
+  {
+    if (field.size() < sizeof(buffer)) {
+      std::memcpy(buffer, field.data(), field.size());
+      buffer[field.size()] = '\0';
+      return buffer;
+    }
+    longField.assign(field.data(), field.size());
+    return longField.c_str();
+  }
+
+  static int fieldToInteger(std::string_view field, bool *ok)
+  {
+    char buffer[64];
+    std::string longField;
+    const char* str = terminatedField(field, buffer, longField);
+    char* end = nullptr;
+    errno = 0;
+    long value = std::strtol(str, &end, 10);
+    *ok = (end != str) && (errno != ERANGE)
+      && (value >= std::numeric_limits<int>::min()) && (value <= std::numeric_limits<int>::max());
+    return *ok ? static_cast<int>(value) : 0;
+  }
+
+  static double fieldToDouble(std::string_view field, bool *ok)
+  {
+    char buffer[64];
+    std::string longField;
+    const char* str = terminatedField(field, buffer, longField);
+    char* end = nullptr;
+    errno = 0;
+    double value = std::strtod(str, &end);
+    *ok = (end != str) && (errno != ERANGE);
+    return *ok ? value : 0;
+  }
+
   Date EpwDataPoint::date() const
   {
     return Date(MonthOfYear(m_month), m_day); // , m_year);
@@ -2621,47 +2664,46 @@ namespace openstudio{
     return true;
   }
 
-  boost::optional<AirState> EpwDataPoint::airState() const
+  static boost::optional<AirState> airStateFromFields(const boost::optional<double>& drybulb, const boost::optional<double>& pressure,
+    const boost::optional<double>& relativeHumidity, const boost::optional<double>& dewpoint)
   {
-    boost::optional<double> value = dryBulbTemperature();
-    if (!value) {
+    if (!drybulb) {
       return boost::none; // Have to have dry bulb
     }
-    double drybulb = value.get();
-
-    value = atmosphericStationPressure();
-    if (!value) {
+    if (!pressure) {
       return boost::none; // Have to have pressure
     }
-    double pressure = value.get();
-
-    value = relativeHumidity();
-    if (!value) { // Don't have relative humidity
-      value = dewPointTemperature();
-      if (value) {
-        double dewpoint = value.get();
-        return AirState::fromDryBulbDewPointPressure(drybulb, dewpoint, pressure);
+    if (!relativeHumidity) { // Don't have relative humidity
+      if (dewpoint) {
+        return AirState::fromDryBulbDewPointPressure(drybulb.get(), dewpoint.get(), pressure.get());
       }
     } else { // Have relative humidity
-      double RH = value.get();
-      return AirState::fromDryBulbRelativeHumidityPressure(drybulb, RH, pressure);
+      return AirState::fromDryBulbRelativeHumidityPressure(drybulb.get(), relativeHumidity.get(), pressure.get());
     }
 
     return boost::none;
   }
 
-  boost::optional<double> EpwDataPoint::saturationPressure() const
+  boost::optional<AirState> EpwDataPoint::airState() const
+  {
+    return airStateFromFields(dryBulbTemperature(), atmosphericStationPressure(), relativeHumidity(), dewPointTemperature());
+  }
+
+  static boost::optional<double> saturationPressureFromDryBulb(const boost::optional<double>& drybulb)
   {
-    boost::optional<double> optdrybulb = dryBulbTemperature();
-    if (optdrybulb) {
-      double drybulb = optdrybulb.get();
-      if (drybulb >= -100.0 && drybulb <= 200.0) {
-        return boost::optional<double>(openstudio::psat(drybulb));
+    if (drybulb) {
+      if (drybulb.get() >= -100.0 && drybulb.get() <= 200.0) {
+        return boost::optional<double>(openstudio::psat(drybulb.get()));
       }
     }
     return boost::none;
   }
 
+  boost::optional<double> EpwDataPoint::saturationPressure() const
+  {
+    return saturationPressureFromDryBulb(dryBulbTemperature());
+  }
+
   boost::optional<double> EpwDataPoint::enthalpy() const
   {
     boost::optional<AirState> state = airState();
@@ -2707,6 +2749,470 @@ namespace openstudio{
     return boost::none;
   }
 
+  // Scaled decimal format used by the EPW data columns. The low four bits hold the number of decimal places,
+  // the next three the number of trailing zeros dropped from the mantissa, and the high bit is set when there
+  // are no digits before the decimal point (as in ".999"). Anything else is stored verbatim.
+  static const std::uint8_t verbatimDecimal = 0xFF;
+
+  static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14};
+
+  static bool encodeDecimal(std::string_view text, std::int32_t& mantissa, std::uint8_t& format)
+  {
+    std::size_t pos = 0;
+    bool negative = false;
+    if (pos < text.size() && text[pos] == '-') {
+      negative = true;
+      ++pos;
+    }
+    std::uint64_t digits = 0;
+    unsigned nDigits = 0;
+    auto readDigits = [&]() {
+      std::size_t begin = pos;
+      while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+        digits = 10 * digits + (text[pos] - '0');
+        ++nDigits;
+        ++pos;
+      }
+      return pos - begin;
+    };
+    std::size_t intBegin = pos;
+    std::size_t intDigits = readDigits();
+    if (intDigits > 1 && text[intBegin] == '0') {
+      return false; // Leading zeros
+    }
+    std::size_t decimals = 0;
+    if (pos < text.size() && text[pos] == '.') {
+      ++pos;
+      decimals = readDigits();
+      if (decimals == 0) {
+        return false; // Trailing decimal point
+      }
+    }
+    if (pos != text.size() || nDigits == 0 || nDigits > 18 || decimals > 14 || (negative && digits == 0)) {
+      return false;
+    }
+    unsigned zeros = 0;
+    while (digits != 0 && zeros < decimals && zeros < 7 && digits % 10 == 0) {
+      digits /= 10;
+      ++zeros;
+    }
+    if (digits > static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max())) {
+      return false;
+    }
+    mantissa = negative ? -static_cast<std::int32_t>(digits) : static_cast<std::int32_t>(digits);
+    format = static_cast<std::uint8_t>(decimals | (zeros << 4) | ((intDigits == 0) << 7));
+    return true;
+  }
+
+namespace detail {
+
+  void EpwDataColumns::DecimalColumn::push_back(std::string_view text, bool missing)
+  {
+    std::int32_t mantissa = 0;
+    std::uint8_t format = verbatimDecimal;
+    if (!encodeDecimal(text, mantissa, format)) {
+      mantissa = 0;
+      format = verbatimDecimal;
+      m_verbatim.emplace(m_formats.size(), std::string(text));
+    }
+    m_mantissas.push_back(mantissa);
+    m_formats.push_back(format);
+    m_missing.push_back(missing);
+  }
+
+  void EpwDataColumns::DecimalColumn::shrinkToFit()
+  {
+    m_mantissas.shrink_to_fit();
+    m_formats.shrink_to_fit();
+    m_missing.shrink_to_fit();
+  }
+
+  std::size_t EpwDataColumns::DecimalColumn::size() const
+  {
+    return m_formats.size();
+  }
+
+  bool EpwDataColumns::DecimalColumn::missing(std::size_t row) const
+  {
+    return m_missing[row];
+  }
+
+  double EpwDataColumns::DecimalColumn::value(std::size_t row) const
+  {
+    std::uint8_t format = m_formats[row];
+    if (format == verbatimDecimal) {
+      return std::stod(m_verbatim.at(row));
+    }
+    unsigned decimals = format & 0x0F;
+    unsigned zeros = (format >> 4) & 0x07;
+    // Both operands are exact, so the quotient is rounded exactly as std::stod would round the text
+    return m_mantissas[row] / powersOfTen[decimals - zeros];
+  }
+
+  std::string EpwDataColumns::DecimalColumn::text(std::size_t row) const
+  {
+    std::uint8_t format = m_formats[row];
+    if (format == verbatimDecimal) {
+      return m_verbatim.at(row);
+    }
+    unsigned decimals = format & 0x0F;
+    unsigned zeros = (format >> 4) & 0x07;
+    bool leadingDigit = (format & 0x80) == 0;
+    std::int64_t mantissa = m_mantissas[row];
+    std::string digits = std::to_string(mantissa < 0 ? -mantissa : mantissa) + std::string(zeros, '0');
+    std::size_t width = decimals + (leadingDigit ? 1 : 0);
+    if (digits.size() < width) {
+      digits.insert(0, width - digits.size(), '0');
+    }
+    std::string result = mantissa < 0 ? "-" : "";
+    result += digits.substr(0, digits.size() - decimals);
+    if (decimals > 0) {
+      result += '.';
+      result += digits.substr(digits.size() - decimals);
+    }
+    return result;
+  }
+
+  std::size_t EpwDataColumns::DecimalColumn::memoryUsage() const
+  {
+    std::size_t result = sizeof(DecimalColumn);
+    result += m_mantissas.capacity() * sizeof(std::int32_t);
+    result += m_formats.capacity() * sizeof(std::uint8_t);
+    result += m_missing.capacity() / 8;
+    for (const auto& verbatim : m_verbatim) {
+      // Tree node overhead plus any text that does not fit in the small string buffer
+      result += sizeof(verbatim) + 4 * sizeof(void*);
+      if (verbatim.second.capacity() >= sizeof(std::string)) {
+        result += verbatim.second.capacity() + 1;
+      }
+    }
+    return result;
+  }
+
+  // How each numeric field is checked, in column order. This mirrors the string setters of EpwDataPoint.
+  struct EpwDecimalField
+  {
+    EpwDataField::domain id;
+    const char* missing;           // The text stored for missing values
+    bool (*reject)(double value);  // Values that are stored as missing
+    bool (*warn)(double value);    // Values that are accepted but are not within the expected limits
+    bool reformat;                 // Values are stored using std::to_string rather than as given
+  };
+
+  static bool neverRejected(double) { return false; }
+  static bool outsideTemperatureLimits(double value) { return -70 >= value || 70 <= value; }
+  static bool negativeOr9999(double value) { return 0 > value || value == 9999; }
+  static bool negativeOrOver999900(double value) { return 0 > value || 999900 < value; }
+
+  static const EpwDecimalField epwDecimalFields[] = {
+    {EpwDataField::DryBulbTemperature, "99.9", neverRejected, outsideTemperatureLimits, false},
+    {EpwDataField::DewPointTemperature, "99.9", neverRejected, outsideTemperatureLimits, false},
+    {EpwDataField::RelativeHumidity, "999", [](double value) { return 0 > value; }, [](double value) { return 110 < value; }, false},
+    {EpwDataField::AtmosphericStationPressure, "999999", neverRejected, [](double value) { return 31000 >= value || 120000 <= value; }, false},
+    {EpwDataField::ExtraterrestrialHorizontalRadiation, "9999", negativeOr9999, nullptr, false},
+    {EpwDataField::ExtraterrestrialDirectNormalRadiation, "9999", negativeOr9999, nullptr, false},
+    {EpwDataField::HorizontalInfraredRadiationIntensity, "9999", negativeOr9999, nullptr, false},
+    {EpwDataField::GlobalHorizontalRadiation, "9999", negativeOr9999, nullptr, true},
+    {EpwDataField::DirectNormalRadiation, "9999", negativeOr9999, nullptr, false},
+    {EpwDataField::DiffuseHorizontalRadiation, "9999", negativeOr9999, nullptr, false},
+    {EpwDataField::GlobalHorizontalIlluminance, "999999", negativeOrOver999900, nullptr, false},
+    {EpwDataField::DirectNormalIlluminance, "999999", negativeOrOver999900, nullptr, false},
+    {EpwDataField::DiffuseHorizontalIlluminance, "999999", negativeOrOver999900, nullptr, false},
+    {EpwDataField::ZenithLuminance, "9999", [](double value) { return 0 > value || 9999 <= value; }, nullptr, false},
+    {EpwDataField::WindDirection, "999", [](double value) { return 0 > value || 360 < value; }, nullptr, false},
+    {EpwDataField::WindSpeed, "999", [](double value) { return 0 > value; }, [](double value) { return 40 < value; }, true},
+    {EpwDataField::Visibility, "9999", [](double value) { return value == 9999; }, nullptr, false},
+    {EpwDataField::CeilingHeight, "99999", [](double value) { return value == 99999; }, nullptr, false},
+    {EpwDataField::PrecipitableWater, "999", [](double value) { return value == 999; }, nullptr, false},
+    {EpwDataField::AerosolOpticalDepth, ".999", [](double value) { return value == 0.999; }, nullptr, false},
+    {EpwDataField::SnowDepth, "999", [](double value) { return value == 999; }, nullptr, false},
+    {EpwDataField::DaysSinceLastSnowfall, "99", [](double value) { return value == 99; }, nullptr, false},
+    {EpwDataField::Albedo, "999", [](double value) { return value == 999; }, nullptr, false},
+    {EpwDataField::LiquidPrecipitationDepth, "999", [](double value) { return value == 999; }, nullptr, false},
+    {EpwDataField::LiquidPrecipitationQuantity, "99", [](double value) { return value == 99; }, nullptr, false}
+  };
+
+  static const std::size_t numEpwDecimalFields = sizeof(epwDecimalFields) / sizeof(epwDecimalFields[0]);
+
+  EpwDataColumns::EpwDataColumns()
+    : m_decimals(numEpwDecimalFields)
+  {
+    for (std::size_t i = 0; i < numEpwDecimalFields; ++i) {
+      OS_ASSERT(decimalIndex(epwDecimalFields[i].id) == static_cast<int>(i));
+    }
+  }
+
+  int EpwDataColumns::decimalIndex(EpwDataField id)
+  {
+    int value = id.value();
+    if (value >= EpwDataField::DryBulbTemperature && value <= EpwDataField::WindSpeed) {
+      return value - EpwDataField::DryBulbTemperature;
+    } else if (value >= EpwDataField::Visibility && value <= EpwDataField::CeilingHeight) {
+      return value - EpwDataField::Visibility + 16;
+    } else if (value >= EpwDataField::PrecipitableWater && value <= EpwDataField::LiquidPrecipitationQuantity) {
+      return value - EpwDataField::PrecipitableWater + 18;
+    }
+    return -1;
+  }
+
+  const EpwDataColumns::DecimalColumn& EpwDataColumns::decimal(EpwDataField id) const
+  {
+    int index = decimalIndex(id);
+    OS_ASSERT(index >= 0);
+    return m_decimals[index];
+  }
+
+  bool EpwDataColumns::append(int year, int month, int day, int hour, int minute, const std::vector<std::string_view>& fields)
+  {
+    if (fields.size() < 35) {
+      LOG(Error, "Expected 35 fields in EPW data instead of the " << fields.size() << " received");
+      return false;
+    } else if (fields.size() > 35) {
+      LOG(Warn, "Expected 35 fields in EPW data instead of the " << fields.size() << " received. The additional data will be ignored");
+    }
+    if (1 > month || 12 < month) {
+      LOG(Error, "Month value " << month << " out of range");
+      return false;
+    }
+    if (1 > day || 31 < day) {
+      LOG(Error, "Day value " << day << " out of range");
+      return false;
+    }
+    if (1 > hour || 24 < hour) {
+      LOG(Error, "Hour value " << hour << " out of range");
+      return false;
+    }
+    if (0 > minute || 59 < minute) {
+      LOG(Error, "Minute value " << minute << " out of range");
+      return false;
+    }
+    m_years.push_back(year);
+    m_months.push_back(static_cast<std::uint8_t>(month));
+    m_days.push_back(static_cast<std::uint8_t>(day));
+    m_hours.push_back(static_cast<std::uint8_t>(hour));
+    m_minutes.push_back(static_cast<std::uint8_t>(minute));
+
+    // The flags are nearly always drawn from a handful of distinct strings
+    std::string flags(fields[EpwDataField::DataSourceandUncertaintyFlags]);
+    auto flagIt = m_flagIndices.find(flags);
+    if (flagIt == m_flagIndices.end()) {
+      flagIt = m_flagIndices.emplace(flags, static_cast<std::uint32_t>(m_flagStrings.size())).first;
+      m_flagStrings.push_back(flags);
+    }
+    m_flags.push_back(flagIt->second);
+
+    for (std::size_t i = 0; i < numEpwDecimalFields; ++i) {
+      const EpwDecimalField& spec = epwDecimalFields[i];
+      std::string_view field = fields[spec.id];
+      bool ok;
+      double value = fieldToDouble(field, &ok);
+      if (!ok || spec.reject(value)) {
+        m_decimals[i].push_back(spec.missing, true);
+        continue;
+      }
+      if (spec.warn && spec.warn(value)) {
+        LOG(Warn, EpwDataField(spec.id).valueName() << " value '" << value << "' not within the expected limits");
+      }
+      if (spec.reformat) {
+        std::string text = std::to_string(value);
+        m_decimals[i].push_back(text, text == spec.missing);
+      } else {
+        m_decimals[i].push_back(field, field == spec.missing);
+      }
+    }
+
+    auto skyCover = [&](EpwDataField::domain id) {
+      bool ok;
+      int value = fieldToInteger(fields[id], &ok);
+      if (!ok || 0 > value || 10 < value) {
+        return static_cast<std::int8_t>(99);
+      }
+      return static_cast<std::int8_t>(value);
+    };
+    m_totalSkyCover.push_back(skyCover(EpwDataField::TotalSkyCover));
+    m_opaqueSkyCover.push_back(skyCover(EpwDataField::OpaqueSkyCover));
+
+    bool ok;
+    int value = fieldToInteger(fields[EpwDataField::PresentWeatherObservation], &ok);
+    m_presentWeatherObservation.push_back(ok ? value : 0);
+    value = fieldToInteger(fields[EpwDataField::PresentWeatherCodes], &ok);
+    m_presentWeatherCodes.push_back(ok ? value : 0);
+
+    return true;
+  }
+
+  void EpwDataColumns::shrinkToFit()
+  {
+    m_years.shrink_to_fit();
+    m_months.shrink_to_fit();
+    m_days.shrink_to_fit();
+    m_hours.shrink_to_fit();
+    m_minutes.shrink_to_fit();
+    m_flags.shrink_to_fit();
+    for (DecimalColumn& column : m_decimals) {
+      column.shrinkToFit();
+    }
+    m_totalSkyCover.shrink_to_fit();
+    m_opaqueSkyCover.shrink_to_fit();
+    m_presentWeatherObservation.shrink_to_fit();
+    m_presentWeatherCodes.shrink_to_fit();
+  }
+
+  std::size_t EpwDataColumns::size() const
+  {
+    return m_years.size();
+  }
+
+  int EpwDataColumns::year(std::size_t row) const
+  {
+    return m_years[row];
+  }
+
+  int EpwDataColumns::month(std::size_t row) const
+  {
+    return m_months[row];
+  }
+
+  int EpwDataColumns::day(std::size_t row) const
+  {
+    return m_days[row];
+  }
+
+  int EpwDataColumns::hour(std::size_t row) const
+  {
+    return m_hours[row];
+  }
+
+  int EpwDataColumns::minute(std::size_t row) const
+  {
+    return m_minutes[row];
+  }
+
+  DateTime EpwDataColumns::dateTime(std::size_t row) const
+  {
+    return DateTime(Date(MonthOfYear(m_months[row]), m_days[row]), Time(0, m_hours[row], m_minutes[row]));
+  }
+
+  boost::optional<double> EpwDataColumns::getField(std::size_t row, EpwDataField id) const
+  {
+    switch (id.value()) {
+      case EpwDataField::TotalSkyCover:
+        return boost::optional<double>(m_totalSkyCover[row]);
+      case EpwDataField::OpaqueSkyCover:
+        return boost::optional<double>(m_opaqueSkyCover[row]);
+      case EpwDataField::PresentWeatherObservation:
+        return boost::optional<double>(m_presentWeatherObservation[row]);
+      case EpwDataField::PresentWeatherCodes:
+        return boost::optional<double>(m_presentWeatherCodes[row]);
+      default:
+        break;
+    }
+    int index = decimalIndex(id);
+    if (index < 0 || m_decimals[index].missing(row)) {
+      return boost::none;
+    }
+    return boost::optional<double>(m_decimals[index].value(row));
+  }
+
+  boost::optional<double> EpwDataColumns::getComputedField(std::size_t row, EpwComputedField id) const
+  {
+    boost::optional<double> drybulb = getField(row, EpwDataField::DryBulbTemperature);
+    if (id == EpwComputedField::SaturationPressure) {
+      return saturationPressureFromDryBulb(drybulb);
+    }
+    boost::optional<AirState> state = airStateFromFields(drybulb, getField(row, EpwDataField::AtmosphericStationPressure),
+      getField(row, EpwDataField::RelativeHumidity), getField(row, EpwDataField::DewPointTemperature));
+    if (!state) {
+      return boost::none;
+    }
+    switch (id.value()) {
+      case EpwComputedField::Enthalpy:
+        return boost::optional<double>(state->enthalpy());
+      case EpwComputedField::HumidityRatio:
+        return boost::optional<double>(state->humidityRatio());
+      case EpwComputedField::WetBulbTemperature:
+        return boost::optional<double>(state->wetbulb());
+      case EpwComputedField::Density:
+        return boost::optional<double>(state->density());
+      case EpwComputedField::SpecificVolume:
+        return boost::optional<double>(state->specificVolume());
+      default:
+        break;
+    }
+    return boost::none;
+  }
+
+  EpwDataPoint EpwDataColumns::dataPoint(std::size_t row) const
+  {
+    EpwDataPoint pt;
+    pt.m_year = m_years[row];
+    pt.m_month = m_months[row];
+    pt.m_day = m_days[row];
+    pt.m_hour = m_hours[row];
+    pt.m_minute = m_minutes[row];
+    pt.m_dataSourceandUncertaintyFlags = m_flagStrings[m_flags[row]];
+    pt.m_dryBulbTemperature = decimal(EpwDataField::DryBulbTemperature).text(row);
+    pt.m_dewPointTemperature = decimal(EpwDataField::DewPointTemperature).text(row);
+    pt.m_relativeHumidity = decimal(EpwDataField::RelativeHumidity).text(row);
+    pt.m_atmosphericStationPressure = decimal(EpwDataField::AtmosphericStationPressure).text(row);
+    pt.m_extraterrestrialHorizontalRadiation = decimal(EpwDataField::ExtraterrestrialHorizontalRadiation).text(row);
+    pt.m_extraterrestrialDirectNormalRadiation = decimal(EpwDataField::ExtraterrestrialDirectNormalRadiation).text(row);
+    pt.m_horizontalInfraredRadiationIntensity = decimal(EpwDataField::HorizontalInfraredRadiationIntensity).text(row);
+    pt.m_globalHorizontalRadiation = decimal(EpwDataField::GlobalHorizontalRadiation).text(row);
+    pt.m_directNormalRadiation = decimal(EpwDataField::DirectNormalRadiation).text(row);
+    pt.m_diffuseHorizontalRadiation = decimal(EpwDataField::DiffuseHorizontalRadiation).text(row);
+    pt.m_globalHorizontalIlluminance = decimal(EpwDataField::GlobalHorizontalIlluminance).text(row);
+    pt.m_directNormalIlluminance = decimal(EpwDataField::DirectNormalIlluminance).text(row);
+    pt.m_diffuseHorizontalIlluminance = decimal(EpwDataField::DiffuseHorizontalIlluminance).text(row);
+    pt.m_zenithLuminance = decimal(EpwDataField::ZenithLuminance).text(row);
+    pt.m_windDirection = decimal(EpwDataField::WindDirection).text(row);
+    pt.m_windSpeed = decimal(EpwDataField::WindSpeed).text(row);
+    pt.m_totalSkyCover = m_totalSkyCover[row];
+    pt.m_opaqueSkyCover = m_opaqueSkyCover[row];
+    pt.m_visibility = decimal(EpwDataField::Visibility).text(row);
+    pt.m_ceilingHeight = decimal(EpwDataField::CeilingHeight).text(row);
+    pt.m_presentWeatherObservation = m_presentWeatherObservation[row];
+    pt.m_presentWeatherCodes = m_presentWeatherCodes[row];
+    pt.m_precipitableWater = decimal(EpwDataField::PrecipitableWater).text(row);
+    pt.m_aerosolOpticalDepth = decimal(EpwDataField::AerosolOpticalDepth).text(row);
+    pt.m_snowDepth = decimal(EpwDataField::SnowDepth).text(row);
+    pt.m_daysSinceLastSnowfall = decimal(EpwDataField::DaysSinceLastSnowfall).text(row);
+    pt.m_albedo = decimal(EpwDataField::Albedo).text(row);
+    pt.m_liquidPrecipitationDepth = decimal(EpwDataField::LiquidPrecipitationDepth).text(row);
+    pt.m_liquidPrecipitationQuantity = decimal(EpwDataField::LiquidPrecipitationQuantity).text(row);
+    return pt;
+  }
+
+  std::vector<EpwDataPoint> EpwDataColumns::dataPoints() const
+  {
+    std::vector<EpwDataPoint> result;
+    result.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+      result.push_back(dataPoint(i));
+    }
+    return result;
+  }
+
+  std::size_t EpwDataColumns::memoryUsage() const
+  {
+    std::size_t result = sizeof(EpwDataColumns);
+    result += m_years.capacity() * sizeof(std::int32_t);
+    result += (m_months.capacity() + m_days.capacity() + m_hours.capacity() + m_minutes.capacity()) * sizeof(std::uint8_t);
+    result += m_flags.capacity() * sizeof(std::uint32_t);
+    for (const std::string& flags : m_flagStrings) {
+      // Each distinct string is held twice, once in the list and once as a key of the index
+      result += 2 * (sizeof(std::string) + flags.capacity() + 1) + 2 * sizeof(void*);
+    }
+    for (const DecimalColumn& column : m_decimals) {
+      result += column.memoryUsage();
+    }
+    result += (m_totalSkyCover.capacity() + m_opaqueSkyCover.capacity()) * sizeof(std::int8_t);
+    result += (m_presentWeatherObservation.capacity() + m_presentWeatherCodes.capacity()) * sizeof(std::int32_t);
+    return result;
+  }
+
+} // detail
+
   EpwFile::EpwFile(const openstudio::path& p, bool storeData)
     : m_path(p), m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0), m_isActual(false), m_minutesMatch(true)
   {
@@ -2848,7 +3354,7 @@ namespace openstudio{
 
   std::vector<EpwDataPoint> EpwFile::data()
   {
-    if(m_data.size()==0){
+    if(!m_data || m_data->size()==0){
       if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
         LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
       }
@@ -2866,7 +3372,10 @@ namespace openstudio{
         ifs.close();
       }
     }
-    return m_data;
+    if (!m_data) {
+      return std::vector<EpwDataPoint>();
+    }
+    return m_data->dataPoints();
   }
 
   std::string EpwDesignCondition::titleOfDesignCondition() const
@@ -4038,7 +4547,7 @@ namespace openstudio{
 
   boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
   {
-    if(m_data.size()==0) {
+    if(!m_data || m_data->size()==0) {
       if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
         LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
       }
@@ -4063,17 +4572,17 @@ namespace openstudio{
       LOG(Warn, "Unrecognized EPW data field '" << name << "'");
       return boost::none;
     }
-    if(m_data.size() > 0) {
+    if(m_data && m_data->size() > 0) {
       std::string units = EpwDataPoint::getUnits(id);
       DateTimeVector dates;
+      dates.reserve(m_data->size() + 1);
       dates.push_back(DateTime()); // Use a placeholder to avoid an insert
       std::vector<double> values;
-      for(unsigned int i=0;i<m_data.size();i++) {
-        DateTime dateTime=m_data[i].dateTime();
-        // Time time=m_data[i].time();
-        boost::optional<double> value = m_data[i].getField(id);
+      values.reserve(m_data->size());
+      for(std::size_t i=0;i<m_data->size();i++) {
+        boost::optional<double> value = m_data->getField(i, id);
         if(value) {
-          dates.push_back(DateTime(dateTime));
+          dates.push_back(m_data->dateTime(i));
           values.push_back(value.get());
         }
       }
@@ -4088,7 +4597,7 @@ namespace openstudio{
 
   boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string &name)
   {
-    if (m_data.size() == 0) {
+    if (!m_data || m_data->size() == 0) {
       if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
         LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
       }
@@ -4116,39 +4625,18 @@ namespace openstudio{
     }
 
     std::string units = EpwDataPoint::getUnits(id);
-    boost::optional<double>(EpwDataPoint::*compute)() const;
-    switch (id.value()) {
-      case EpwComputedField::SaturationPressure:
-        compute = &EpwDataPoint::saturationPressure;
-        break;
-      case EpwComputedField::Enthalpy:
-        compute = &EpwDataPoint::enthalpy;
-        break;
-      case EpwComputedField::HumidityRatio:
-        compute = &EpwDataPoint::humidityRatio;
-        break;
-      case EpwComputedField::WetBulbTemperature:
-        compute = &EpwDataPoint::wetbulb;
-        break;
-      case EpwComputedField::Density:
-        compute = &EpwDataPoint::density;
-        break;
-      case EpwComputedField::SpecificVolume:
-        compute = &EpwDataPoint::specificVolume;
-        break;
-      default:
-        return boost::none;
-    }
     DateTimeVector dates;
     dates.push_back(DateTime()); // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i<m_data.size(); i++) {
-      Date date = m_data[i].date();
-      Time time = m_data[i].time();
-      boost::optional<double> value = (m_data[i].*compute)();
-      if (value) {
-        dates.push_back(DateTime(date, time));
-        values.push_back(value.get());
+    if (m_data) {
+      dates.reserve(m_data->size() + 1);
+      values.reserve(m_data->size());
+      for (std::size_t i = 0; i<m_data->size(); i++) {
+        boost::optional<double> value = m_data->getComputedField(i, id);
+        if (value) {
+          dates.push_back(m_data->dateTime(i));
+          values.push_back(value.get());
+        }
       }
     }
     if (values.size()) {
@@ -4161,7 +4649,7 @@ namespace openstudio{
 
   bool EpwFile::translateToWth(openstudio::path path, std::string description)
   {
-    if(m_data.size()==0) {
+    if(!m_data || m_data->size()==0) {
       if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
         LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
       }
@@ -4184,7 +4672,8 @@ namespace openstudio{
       description = "Translated from " + openstudio::toString(this->path());
     }
 
-    if(!data().size()) {
+    std::vector<EpwDataPoint> points = data();
+    if(!points.size()) {
       LOG(Error, "EPW file contains no data to translate");
       return false;
     }
@@ -4214,9 +4703,9 @@ namespace openstudio{
     }
 
     // Cheat to get data at the start time - this will need to change
-    openstudio::EpwDataPoint lastPt = data()[data().size()-1];
+    openstudio::EpwDataPoint lastPt = points[points.size()-1];
     std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-    openstudio::DateTime dateTime = data()[0].dateTime();
+    openstudio::DateTime dateTime = points[0].dateTime();
     openstudio::Time dt = timeStep();
     dateTime -= dt;
     epwstrings[0] = std::to_string(dateTime.date().year());
@@ -4238,8 +4727,8 @@ namespace openstudio{
       return false;
     }
     fp << output.get() << '\n';
-    for(unsigned int i=0;i<data().size();i++) {
-      output = data()[i].toWthString();
+    for(unsigned int i=0;i<points.size();i++) {
+      output = points[i].toWthString();
       if(!output) {
         LOG(Error, "Translation to WTH has failed on data point " << i);
         fp.close();
@@ -4306,14 +4795,37 @@ namespace openstudio{
     OS_ASSERT((60 % m_recordsPerHour) == 0);
     int minutesPerRecord = 60/m_recordsPerHour;
     int currentMinute = 0;
+    if (storeData) {
+      m_data = std::make_shared<detail::EpwDataColumns>();
+    }
+    // Fields are views into the current line, split the same way as splitString
+    std::vector<std::string_view> fields;
+    fields.reserve(35);
+    auto integerField = [&](std::size_t i) {
+      bool ok;
+      int value = fieldToInteger(fields[i], &ok);
+      if (!ok) {
+        throw std::invalid_argument("Invalid integer field");
+      }
+      return value;
+    };
     while(std::getline(ifs, line)) {
       lineNumber++;
-      std::vector<std::string> strings = splitString(line, ',');
-      if (strings.size() >= 5) {
+      fields.clear();
+      if (!line.empty()) {
+        std::size_t begin = 0;
+        std::size_t end;
+        while ((end = line.find(',', begin)) != std::string::npos) {
+          fields.emplace_back(line.data() + begin, end - begin);
+          begin = end + 1;
+        }
+        fields.emplace_back(line.data() + begin, line.size() - begin);
+      }
+      if (fields.size() >= 5) {
         try {
-          int year = std::stoi(strings[0]);
-          int month = std::stoi(strings[1]);
-          int day = std::stoi(strings[2]);
+          int year = integerField(0);
+          int month = integerField(1);
+          int day = integerField(2);
 
           Date date(month, day, year);
           if (!startDate) {
@@ -4340,8 +4852,8 @@ namespace openstudio{
 
           // Store the data if requested
           if (storeData) {
-            int hour = std::stoi(strings[3]);
-            int minutesInFile = std::stoi(strings[4]);
+            int hour = integerField(3);
+            int minutesInFile = integerField(4);
             // Due to issues with some EPW files, we need to check stuff here
             if (m_recordsPerHour != 1) {
               currentMinute += minutesPerRecord;
@@ -4357,10 +4869,7 @@ namespace openstudio{
                 m_minutesMatch = false;
               }
             }
-            boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
-            if (pt) {
-              m_data.push_back(pt.get());
-            } else {
+            if (!m_data->append(year, month, day, hour, currentMinute, fields)) {
               LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
               return false;
             }
@@ -4376,6 +4885,10 @@ namespace openstudio{
       }
     }
 
+    if (storeData) {
+      m_data->shrinkToFit();
+    }
+
     if (!startDate) {
       LOG(Error, "Could not find start date in data section of EPW file '" << m_path << "'");
       return false;
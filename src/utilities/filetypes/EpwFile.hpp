@@ -49,6 +49,10 @@ class Time;
 class DateTime;
 class TimeSeries;
 
+namespace detail {
+  class EpwDataColumns;
+}
+
 /** The AirState object represents a moist air state */
 class UTILITIES_API AirState
 {
@@ -364,6 +368,8 @@ public:
   boost::optional<double> wetbulb() const;
 
 private:
+  friend class detail::EpwDataColumns;
+
   // One billion setters
   void setDate(Date date);
   void setTime(Time time);
@@ -963,7 +969,7 @@ private:
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
-  std::vector<EpwDataPoint> m_data;
+  std::shared_ptr<detail::EpwDataColumns> m_data;
   std::vector<EpwDesignCondition> m_designs;
 
   bool m_isActual;
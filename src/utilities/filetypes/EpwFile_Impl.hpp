@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_FILETYPES_EPWFILE_IMPL_HPP
+#define UTILITIES_FILETYPES_EPWFILE_IMPL_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "EpwFile.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio{
+
+namespace detail {
+
+  /** EpwDataColumns stores the data section of an EPW file one field at a time. Each numeric field is kept
+   *  as a column of scaled decimals (an integer mantissa plus a one byte format) that reproduces the exact
+   *  text an EpwDataPoint would hold, together with a missing value bitmap. Values that cannot be written
+   *  as a short decimal (exponents, leading zeros, etc.) are kept verbatim on the side. */
+  class UTILITIES_API EpwDataColumns
+  {
+  public:
+
+    EpwDataColumns();
+
+    /** Append one line of EPW data split on commas, overriding the date and time with the specified
+        arguments. The fields are checked the same way EpwDataPoint::fromEpwStrings checks them, and
+        false is returned if the line is rejected. */
+    bool append(int year, int month, int day, int hour, int minute, const std::vector<std::string_view>& fields);
+
+    /** Release any capacity reserved while appending. */
+    void shrinkToFit();
+
+    /** Returns the number of data points. */
+    std::size_t size() const;
+
+    int year(std::size_t row) const;
+    int month(std::size_t row) const;
+    int day(std::size_t row) const;
+    int hour(std::size_t row) const;
+    int minute(std::size_t row) const;
+    /** Returns the date of a data point, matching EpwDataPoint::dateTime. */
+    DateTime dateTime(std::size_t row) const;
+
+    /** Returns the value of a field if it is available, matching EpwDataPoint::getField. */
+    boost::optional<double> getField(std::size_t row, EpwDataField id) const;
+
+    /** Returns a computed value if it is available, matching the corresponding EpwDataPoint method. */
+    boost::optional<double> getComputedField(std::size_t row, EpwComputedField id) const;
+
+    /** Returns a data point with exactly the contents the row would have had if parsed into an EpwDataPoint. */
+    EpwDataPoint dataPoint(std::size_t row) const;
+
+    /** Returns all of the data points. */
+    std::vector<EpwDataPoint> dataPoints() const;
+
+    /** Returns the number of bytes used to store the data. */
+    std::size_t memoryUsage() const;
+
+  private:
+
+    REGISTER_LOGGER("openstudio.EpwFile");
+
+    class DecimalColumn
+    {
+    public:
+
+      void push_back(std::string_view text, bool missing);
+      void shrinkToFit();
+      std::size_t size() const;
+      bool missing(std::size_t row) const;
+      double value(std::size_t row) const;
+      std::string text(std::size_t row) const;
+      std::size_t memoryUsage() const;
+
+    private:
+
+      std::vector<std::int32_t> m_mantissas;
+      std::vector<std::uint8_t> m_formats;
+      std::vector<bool> m_missing;
+      std::map<std::size_t, std::string> m_verbatim;
+    };
+
+    static int decimalIndex(EpwDataField id);
+
+    const DecimalColumn& decimal(EpwDataField id) const;
+
+    std::vector<std::int32_t> m_years;
+    std::vector<std::uint8_t> m_months;
+    std::vector<std::uint8_t> m_days;
+    std::vector<std::uint8_t> m_hours;
+    std::vector<std::uint8_t> m_minutes;
+    std::vector<std::uint32_t> m_flags;
+    std::vector<std::string> m_flagStrings;
+    std::unordered_map<std::string, std::uint32_t> m_flagIndices;
+    std::vector<DecimalColumn> m_decimals;
+    std::vector<std::int8_t> m_totalSkyCover;
+    std::vector<std::int8_t> m_opaqueSkyCover;
+    std::vector<std::int32_t> m_presentWeatherObservation;
+    std::vector<std::int32_t> m_presentWeatherCodes;
+  };
+
+} // detail
+} // openstudio
+
+#endif //UTILITIES_FILETYPES_EPWFILE_IMPL_HPP
@@ -29,9 +29,11 @@
 
 #include <gtest/gtest.h>
 #include "../EpwFile.hpp"
+#include "../EpwFile_Impl.hpp"
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
 #include "../../core/Checksum.hpp"
+#include "../../core/StringHelpers.hpp"
 
 #include <resources.hxx>
 
@@ -764,3 +766,128 @@ TEST(Filetypes, EpwFile_DataPoint)
     ASSERT_TRUE(false);
   }
 }
+
+// Check the columns against EpwDataPoint for every data line of a file, optionally replacing fields of the first line
+static void checkEpwDataColumns(const path& p, const std::map<unsigned, std::string>& firstLineFields, std::size_t& pointBytes,
+  std::size_t& columnBytes)
+{
+  std::ifstream ifs(toSystemFilename(p));
+  std::string line;
+  for (unsigned i = 0; i < 8; ++i) {
+    ASSERT_TRUE(std::getline(ifs, line));
+  }
+  detail::EpwDataColumns columns;
+  std::vector<EpwDataPoint> points;
+  while (std::getline(ifs, line)) {
+    std::vector<std::string> strings = splitString(line, ',');
+    ASSERT_EQ(35u, strings.size());
+    if (points.empty()) {
+      for (const auto& field : firstLineFields) {
+        strings[field.first] = field.second;
+      }
+    }
+    std::vector<std::string_view> fields(strings.begin(), strings.end());
+    int year = std::stoi(strings[0]);
+    int month = std::stoi(strings[1]);
+    int day = std::stoi(strings[2]);
+    int hour = std::stoi(strings[3]);
+    boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, 0, strings);
+    ASSERT_TRUE(pt);
+    points.push_back(pt.get());
+    ASSERT_TRUE(columns.append(year, month, day, hour, 0, fields));
+  }
+  columns.shrinkToFit();
+  ASSERT_EQ(points.size(), columns.size());
+
+  pointBytes = 0;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    EpwDataPoint& expected = points[i];
+    EpwDataPoint actual = columns.dataPoint(i);
+    std::vector<std::string> expectedStrings = expected.toEpwStrings();
+    EXPECT_EQ(expectedStrings, actual.toEpwStrings());
+    EXPECT_EQ(expected.dateTime(), columns.dateTime(i));
+    for (int field : EpwDataField::getValues()) {
+      EXPECT_EQ(expected.getField(field), columns.getField(i, field)) << EpwDataField(field).valueName() << " on row " << i;
+    }
+    EXPECT_EQ(expected.saturationPressure(), columns.getComputedField(i, EpwComputedField::SaturationPressure));
+    EXPECT_EQ(expected.enthalpy(), columns.getComputedField(i, EpwComputedField::Enthalpy));
+    EXPECT_EQ(expected.humidityRatio(), columns.getComputedField(i, EpwComputedField::HumidityRatio));
+    EXPECT_EQ(expected.wetbulb(), columns.getComputedField(i, EpwComputedField::WetBulbTemperature));
+    EXPECT_EQ(expected.density(), columns.getComputedField(i, EpwComputedField::Density));
+    EXPECT_EQ(expected.specificVolume(), columns.getComputedField(i, EpwComputedField::SpecificVolume));
+
+    // Strings too long for the small string buffer also use the heap
+    pointBytes += sizeof(EpwDataPoint);
+    for (const std::string& text : expectedStrings) {
+      if (text.size() >= sizeof(std::string)) {
+        pointBytes += text.size() + 1;
+      }
+    }
+  }
+  columnBytes = columns.memoryUsage();
+}
+
+TEST(Filetypes, EpwFile_DataColumns)
+{
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  std::size_t pointBytes = 0;
+  std::size_t columnBytes = 0;
+  checkEpwDataColumns(p, {}, pointBytes, columnBytes);
+  EXPECT_LE(5 * columnBytes, pointBytes) << columnBytes << " bytes for the columns, " << pointBytes << " bytes for the data points";
+
+  // Text that does not fit the scaled decimal format has to round trip too
+  std::map<unsigned, std::string> unusual{
+    {EpwDataField::DryBulbTemperature, "-0"},
+    {EpwDataField::DewPointTemperature, "-.5"},
+    {EpwDataField::RelativeHumidity, "0050"},
+    {EpwDataField::AtmosphericStationPressure, "8.1e4"},
+    {EpwDataField::ExtraterrestrialHorizontalRadiation, " 12"},
+    {EpwDataField::ExtraterrestrialDirectNormalRadiation, "12."},
+    {EpwDataField::HorizontalInfraredRadiationIntensity, "+300"},
+    {EpwDataField::GlobalHorizontalRadiation, "3000.5"},
+    {EpwDataField::DirectNormalRadiation, "abc"},
+    {EpwDataField::DiffuseHorizontalRadiation, "-1"},
+    {EpwDataField::GlobalHorizontalIlluminance, "12345678901234567890"},
+    {EpwDataField::DirectNormalIlluminance, "0.000"},
+    {EpwDataField::DiffuseHorizontalIlluminance, "1.23456789012345678"},
+    {EpwDataField::ZenithLuminance, "1E2"},
+    {EpwDataField::WindDirection, ".000"},
+    {EpwDataField::WindSpeed, "45"},
+    {EpwDataField::TotalSkyCover, "11"},
+    {EpwDataField::OpaqueSkyCover, "x"},
+    {EpwDataField::Visibility, "1e999"},
+    {EpwDataField::CeilingHeight, ""},
+    {EpwDataField::PresentWeatherObservation, "99999999999"},
+    {EpwDataField::PrecipitableWater, "2147483648"},
+    {EpwDataField::AerosolOpticalDepth, "0.999"},
+    {EpwDataField::SnowDepth, "999.0"},
+    {EpwDataField::DaysSinceLastSnowfall, "5\r"},
+    {EpwDataField::Albedo, "0.50"},
+    {EpwDataField::LiquidPrecipitationDepth, "-0.25"}
+  };
+  checkEpwDataColumns(p, unusual, pointBytes, columnBytes);
+}
+
+TEST(Filetypes, EpwFile_DataColumns_TimeSeries)
+{
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p, true);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+  for (const std::string& name : {"Dry Bulb Temperature", "Wind Speed", "Total Sky Cover", "Aerosol Optical Depth"}) {
+    boost::optional<TimeSeries> series = epwFile.getTimeSeries(name);
+    ASSERT_TRUE(series) << name;
+    std::vector<double> values = toStandardVector(series->values());
+    ASSERT_EQ(data.size(), values.size()) << name;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      EXPECT_EQ(data[i].getFieldByName(name).get(), values[i]) << name << " on row " << i;
+    }
+  }
+  boost::optional<TimeSeries> series = epwFile.getComputedTimeSeries("Enthalpy");
+  ASSERT_TRUE(series);
+  std::vector<double> values = toStandardVector(series->values());
+  ASSERT_EQ(data.size(), values.size());
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    EXPECT_EQ(data[i].enthalpy().get(), values[i]);
+  }
+}
@@ -31,8 +31,59 @@
 
 #include "Point3d.hpp"
 
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <algorithm>
+
 namespace openstudio{
 
+  namespace {
+
+    typedef boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian> RTreePoint;
+    typedef boost::geometry::model::box<RTreePoint> RTreeBox;
+    typedef std::pair<RTreeBox, unsigned> RTreeValue;
+    typedef boost::geometry::index::rtree<RTreeValue, boost::geometry::index::rstar<16> > RTree;
+
+    // box grown by pad on every side, pad is larger than tol so that the rtree returns a superset
+    // of the boxes that BoundingBox::intersects accepts
+    RTreeBox rtreeBox(const BoundingBox& box, double pad) {
+      return RTreeBox(RTreePoint(*box.minX() - pad, *box.minY() - pad, *box.minZ() - pad),
+                      RTreePoint(*box.maxX() + pad, *box.maxY() + pad, *box.maxZ() + pad));
+    }
+
+    RTree buildRTree(const std::vector<BoundingBox>& boxes) {
+      std::vector<RTreeValue> values;
+      values.reserve(boxes.size());
+      for (unsigned i = 0, n = boxes.size(); i < n; ++i) {
+        if (!boxes[i].isEmpty()) {
+          values.push_back(std::make_pair(rtreeBox(boxes[i], 0.0), i));
+        }
+      }
+      // the range constructor bulk loads the tree
+      return RTree(values.begin(), values.end());
+    }
+
+    std::vector<unsigned> query(const RTree& rtree, const BoundingBox& box, const std::vector<BoundingBox>& boxes, double tol) {
+      std::vector<unsigned> result;
+      if (box.isEmpty()) {
+        return result;
+      }
+      std::vector<RTreeValue> candidates;
+      rtree.query(boost::geometry::index::intersects(rtreeBox(box, 2.0 * tol)), std::back_inserter(candidates));
+      for (const RTreeValue& candidate : candidates) {
+        if (box.intersects(boxes[candidate.second], tol)) {
+          result.push_back(candidate.second);
+        }
+      }
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+
+  }
+
   BoundingBox::BoundingBox()
   {}
 
@@ -70,7 +121,7 @@ namespace openstudio{
     }
   }
 
-  bool BoundingBox::intersects(const BoundingBox& other, double tol)
+  bool BoundingBox::intersects(const BoundingBox& other, double tol) const
   {
     if (isEmpty() || other.isEmpty()){
       return false;
@@ -142,4 +193,31 @@ namespace openstudio{
     return result;
   }
 
+  std::vector<std::pair<unsigned, unsigned> > intersectingBoundingBoxPairs(const std::vector<BoundingBox>& boxes, double tol)
+  {
+    std::vector<std::pair<unsigned, unsigned> > result;
+    RTree rtree = buildRTree(boxes);
+    for (unsigned i = 0, n = boxes.size(); i < n; ++i) {
+      for (unsigned j : query(rtree, boxes[i], boxes, tol)) {
+        if (j > i) {
+          result.push_back(std::make_pair(i, j));
+        }
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::vector<unsigned> > intersectingBoundingBoxes(const std::vector<BoundingBox>& queries,
+                                                                const std::vector<BoundingBox>& boxes,
+                                                                double tol)
+  {
+    std::vector<std::vector<unsigned> > result;
+    result.reserve(queries.size());
+    RTree rtree = buildRTree(boxes);
+    for (const BoundingBox& box : queries) {
+      result.push_back(query(rtree, box, boxes, tol));
+    }
+    return result;
+  }
+
 }
@@ -35,6 +35,7 @@
 
 #include <boost/optional.hpp>
 
+#include <utility>
 #include <vector>
 
 namespace openstudio{
@@ -61,7 +62,7 @@ namespace openstudio{
     void addPoints(const std::vector<Point3d>& points);
 
     /// test for intersection
-    bool intersects(const BoundingBox& other, double tol = 0.001);
+    bool intersects(const BoundingBox& other, double tol = 0.001) const;
 
     bool isEmpty() const;
 
@@ -94,6 +95,18 @@ namespace openstudio{
   // vector of BoundingBox
   typedef std::vector<BoundingBox> BoundingBoxVector;
 
+  /** Returns all pairs (i, j) with i < j such that boxes[i].intersects(boxes[j], tol), ordered by i
+   *  and then by j. Candidate pairs come from an R-tree, so large sets of mostly disjoint boxes
+   *  do not require testing every pair. */
+  UTILITIES_API std::vector<std::pair<unsigned, unsigned> > intersectingBoundingBoxPairs(const std::vector<BoundingBox>& boxes,
+                                                                                         double tol = 0.001);
+
+  /** Returns, for each query box, the indices of the boxes that it intersects within tol, in
+   *  ascending order. Candidates come from an R-tree built over boxes. */
+  UTILITIES_API std::vector<std::vector<unsigned> > intersectingBoundingBoxes(const std::vector<BoundingBox>& queries,
+                                                                              const std::vector<BoundingBox>& boxes,
+                                                                              double tol = 0.001);
+
 } // openstudio
 
 #endif //UTILITIES_GEOMETRY_BOUNDINGBOX_HPP
@@ -33,6 +33,9 @@
 #include "../BoundingBox.hpp"
 #include "../Point3d.hpp"
 
+#include <chrono>
+#include <cstdlib>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, BoundingBox)
@@ -149,3 +152,82 @@ TEST_F(GeometryFixture, BoundingBox_NoIntersection)
   EXPECT_FALSE(b1.intersects(b2));
   EXPECT_FALSE(b2.intersects(b1));
 }
+
+TEST_F(GeometryFixture, BoundingBox_IntersectingPairs)
+{
+  // random boxes of different sizes, including some empty ones and some that just touch
+  std::srand(1);
+  std::vector<BoundingBox> boxes;
+  for (unsigned i = 0; i < 500; ++i){
+    BoundingBox box;
+    if (i % 50 != 0){
+      double x = std::rand() % 100;
+      double y = std::rand() % 100;
+      double z = std::rand() % 10;
+      box.addPoint(Point3d(x, y, z));
+      box.addPoint(Point3d(x + 1 + std::rand() % 5, y + 1 + std::rand() % 5, z + 1 + std::rand() % 3));
+    }
+    boxes.push_back(box);
+  }
+
+  std::vector<std::pair<unsigned, unsigned> > expected;
+  for (unsigned i = 0; i < boxes.size(); ++i){
+    for (unsigned j = i + 1; j < boxes.size(); ++j){
+      if (boxes[i].intersects(boxes[j])){
+        expected.push_back(std::make_pair(i, j));
+      }
+    }
+  }
+  EXPECT_FALSE(expected.empty());
+  EXPECT_TRUE(expected == intersectingBoundingBoxPairs(boxes));
+
+  std::vector<std::vector<unsigned> > candidates = intersectingBoundingBoxes(boxes, boxes, 0.5);
+  ASSERT_EQ(boxes.size(), candidates.size());
+  for (unsigned i = 0; i < boxes.size(); ++i){
+    std::vector<unsigned> expectedCandidates;
+    for (unsigned j = 0; j < boxes.size(); ++j){
+      if (boxes[i].intersects(boxes[j], 0.5)){
+        expectedCandidates.push_back(j);
+      }
+    }
+    EXPECT_TRUE(expectedCandidates == candidates[i]) << i;
+  }
+}
+
+TEST_F(GeometryFixture, BoundingBox_IntersectingPairs_Scaling)
+{
+  // bounding boxes of a grid of 3 m x 3 m x 3 m spaces, from 100 to 10,000 spaces
+  for (unsigned n : {10u, 32u, 100u}){
+    std::vector<BoundingBox> boxes;
+    for (unsigned i = 0; i < n; ++i){
+      for (unsigned j = 0; j < n; ++j){
+        BoundingBox box;
+        box.addPoint(Point3d(3*i, 3*j, 0));
+        box.addPoint(Point3d(3*i + 3, 3*j + 3, 3));
+        boxes.push_back(box);
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::pair<unsigned, unsigned> > expected;
+    for (unsigned i = 0; i < boxes.size(); ++i){
+      for (unsigned j = i + 1; j < boxes.size(); ++j){
+        if (boxes[i].intersects(boxes[j])){
+          expected.push_back(std::make_pair(i, j));
+        }
+      }
+    }
+    std::chrono::duration<double, std::milli> pairwiseTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<std::pair<unsigned, unsigned> > pairs = intersectingBoundingBoxPairs(boxes);
+    std::chrono::duration<double, std::milli> indexTime = std::chrono::steady_clock::now() - start;
+
+    LOG(Info, boxes.size() << " spaces, " << pairs.size() << " intersecting pairs: " << pairwiseTime.count()
+        << " ms testing every pair, " << indexTime.count() << " ms with the R-tree.");
+
+    // each space touches its 8 neighbors
+    EXPECT_EQ(2*(n - 1)*(2*n - 1), pairs.size());
+    EXPECT_TRUE(expected == pairs);
+  }
+}
@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "CompiledIddObject.hpp"
+#include "IddRegex.hpp"
+#include "CommentRegex.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    void splitProperties(const std::string& objectName,
+                         std::string text,
+                         std::vector<std::string>& properties)
+    {
+      boost::smatch matches;
+      while (boost::regex_search(text,matches,iddRegex::metaDataComment())) {
+        std::string property(matches[1].first,matches[1].second);
+        boost::trim(property);
+        properties.push_back(property);
+
+        text = std::string(matches[2].first,matches[2].second);
+        boost::trim(text);
+      }
+
+      if (!(boost::regex_match(text,commentRegex::whitespaceOnlyBlock()) ||
+            boost::regex_match(text,iddRegex::commentOnlyLine())))
+      {
+        std::stringstream ss;
+        ss << "Could not process properties text '" << text << "' in object '" << objectName << "'.";
+        throw std::runtime_error(ss.str().c_str());
+      }
+    }
+
+  }
+
+  CompiledIddObject CompiledIddObject::compile(const std::string& name,
+                                               const std::string& group,
+                                               const std::string& text)
+  {
+    CompiledIddObject result;
+    result.name = name;
+    result.group = group;
+
+    // this mirrors the text parsing in IddObject_Impl and IddField_Impl
+    std::stringstream ss;
+    boost::smatch matches;
+    std::string objectPart;
+    std::string fieldsText;
+    if (boost::regex_search(text,matches,iddRegex::objectAndFields())) {
+      objectPart = std::string(matches[1].first,matches[1].second);
+      fieldsText = std::string(matches[2].first,matches[2].second);
+    }
+    else if (boost::regex_match(text,iddRegex::objectNoFields())) {
+      objectPart = text;
+    }
+    else {
+      ss << "Unexpected pattern '" << text << "' found in object '" << name << "'.";
+      throw std::runtime_error(ss.str().c_str());
+    }
+
+    // object name and properties
+    if (!boost::regex_search(objectPart,matches,iddRegex::line())) {
+      ss << "Could not determine object name from text '" << objectPart << "'.";
+      throw std::runtime_error(ss.str().c_str());
+    }
+    std::string objectName(matches[1].first,matches[1].second);
+    boost::trim(objectName);
+    if (objectName != name) {
+      ss << "Object name '" << objectName << "' does not match expected '" << name << "'.";
+      throw std::runtime_error(ss.str().c_str());
+    }
+    std::string propertiesText(matches[2].first,matches[2].second);
+    boost::trim(propertiesText);
+    splitProperties(name,propertiesText,result.properties);
+
+    // fields, which are found from the back
+    while (boost::regex_search(fieldsText,matches,iddRegex::lastField())) {
+      std::string fieldText(matches[2].first,matches[2].second);
+      std::string remainingText(matches[1].first,matches[1].second);
+
+      CompiledIddField field;
+      boost::smatch fieldMatches;
+      if (boost::regex_search(fieldText,fieldMatches,iddRegex::name())) {
+        field.name = std::string(fieldMatches[1].first,fieldMatches[1].second);
+        boost::trim(field.name);
+      }
+      else if (boost::regex_search(fieldText,fieldMatches,iddRegex::field())) {
+        std::string fieldTypeChar(fieldMatches[1].first,fieldMatches[1].second);
+        std::string fieldTypeNumber(fieldMatches[2].first,fieldMatches[2].second);
+        boost::trim(fieldTypeChar);
+        boost::trim(fieldTypeNumber);
+        field.name = fieldTypeChar + fieldTypeNumber;
+      }
+      else {
+        ss << "Cannot determine field name from text '" << fieldText << "' in object '" << name << "'.";
+        throw std::runtime_error(ss.str().c_str());
+      }
+
+      if (!boost::regex_search(fieldText,fieldMatches,iddRegex::field())) {
+        ss << "Field text does not match expected pattern: '" << fieldText << "' in object '" << name << "'.";
+        throw std::runtime_error(ss.str().c_str());
+      }
+      field.fieldId = std::string(fieldMatches[1].first,fieldMatches[1].second) +
+                      std::string(fieldMatches[2].first,fieldMatches[2].second);
+      std::string fieldProperties(fieldMatches[3].first,fieldMatches[3].second);
+      splitProperties(name,fieldProperties,field.properties);
+
+      result.fields.push_back(field);
+      fieldsText = remainingText;
+    }
+
+    if (!fieldsText.empty()) {
+      ss << "Could not process remaining field text '" << fieldsText << "' in object '" << name << "'.";
+      throw std::runtime_error(ss.str().c_str());
+    }
+
+    // fields were found in reverse order
+    std::reverse(result.fields.begin(),result.fields.end());
+
+    return result;
+  }
+
+} // detail
+} // openstudio
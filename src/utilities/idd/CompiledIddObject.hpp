@@ -0,0 +1,68 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDD_COMPILEDIDDOBJECT_HPP
+#define UTILITIES_IDD_COMPILEDIDDOBJECT_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** The compiled form of an IddField's text, see IddFieldTable. */
+  struct UTILITIES_API CompiledIddField {
+    std::string name;
+    std::string fieldId;
+    std::vector<std::string> properties;
+  };
+
+  /** CompiledIddObject holds the strings behind an IddObjectTable. compile splits object text into
+   *  object properties and fields exactly as the text parse in IddObject_Impl and IddField_Impl
+   *  does, so that loading the tables gives the IddObject the text would have. It is used by
+   *  GenerateIddFactory, and by IddFile to parse and to cache IDD text. */
+  struct UTILITIES_API CompiledIddObject {
+    std::string name;
+    std::string group;
+    std::vector<std::string> properties;
+    std::vector<CompiledIddField> fields;
+
+    /** Compiles the text of object name, throwing std::runtime_error if the text cannot be
+     *  parsed. */
+    static CompiledIddObject compile(const std::string& name,
+                                     const std::string& group,
+                                     const std::string& text);
+  };
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_IDD_COMPILEDIDDOBJECT_HPP
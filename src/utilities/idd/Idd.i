@@ -58,6 +58,12 @@
 // ignore ostream related functions
 %ignore print(std::ostream&, bool) const;
 
+// ignore the compiled forms of IDD text written out by GenerateIddFactory
+%ignore openstudio::IddFieldTable;
+%ignore openstudio::IddObjectTable;
+%ignore openstudio::IddField::load(const IddFieldTable&, const std::string&);
+%ignore openstudio::IddObject::load(const std::string&, const std::string&, const IddObjectTable&, IddObjectType);
+
 // include the headers into the swig interface directly
 %include <utilities/idd/IddEnums.hpp>
 
@@ -257,6 +257,19 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddField_Impl> IddField_Impl::load(const IddFieldTable& table,
+                                                       const std::string& objectName) {
+
+    std::shared_ptr<IddField_Impl> result;
+    IddField_Impl iddFieldImpl(table.name,objectName);
+
+    try { iddFieldImpl.parse(table); }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddField_Impl>(new IddField_Impl(iddFieldImpl));
+    return result;
+  }
+
   std::ostream& IddField_Impl::print(std::ostream& os, bool lastField) const
   {
     std::string separator = (lastField ? std::string(";") : std::string(","));
@@ -287,18 +300,7 @@ namespace detail {
       std::string fieldTypeNumber(matches[2].first, matches[2].second);
       std::string fieldProperties(matches[3].first, matches[3].second);
 
-      // keep track of field id
-      m_fieldId = fieldTypeChar + fieldTypeNumber;
-
-      // check for base content type
-      if (boost::iequals(fieldTypeChar, "A")){
-        m_properties.type = IddFieldType(IddFieldType::AlphaType);
-      }else if (boost::iequals(fieldTypeChar, "N")){
-        // default numerics to real, can be overwritten later
-        m_properties.type = IddFieldType(IddFieldType::RealType);
-      }else{
-        LOG_AND_THROW("Unknown field type identifier found: '" << fieldTypeChar << "'");
-      }
+      setFieldId(fieldTypeChar, fieldTypeNumber);
 
       // parse all the properties
       while (boost::regex_search(fieldProperties, matches, iddRegex::metaDataComment())){
@@ -316,6 +318,43 @@ namespace detail {
       LOG_AND_THROW("Field text does not match expected pattern: '" << text << "'");
     }
 
+    validateProperties();
+  }
+
+  void IddField_Impl::parse(const IddFieldTable& table)
+  {
+    // the generator has already split the text, so only the properties themselves are parsed
+    std::string fieldId(table.fieldId);
+    if (fieldId.empty()) {
+      LOG_AND_THROW("Compiled field '" << m_name << "' does not have a field id");
+    }
+    setFieldId(fieldId.substr(0,1), fieldId.substr(1));
+
+    for (unsigned i = 0; i < table.numProperties; ++i) {
+      parseProperty(table.properties[i]);
+    }
+
+    validateProperties();
+  }
+
+  void IddField_Impl::setFieldId(const std::string& fieldTypeChar, const std::string& fieldTypeNumber)
+  {
+    // keep track of field id
+    m_fieldId = fieldTypeChar + fieldTypeNumber;
+
+    // check for base content type
+    if (boost::iequals(fieldTypeChar, "A")){
+      m_properties.type = IddFieldType(IddFieldType::AlphaType);
+    }else if (boost::iequals(fieldTypeChar, "N")){
+      // default numerics to real, can be overwritten later
+      m_properties.type = IddFieldType(IddFieldType::RealType);
+    }else{
+      LOG_AND_THROW("Unknown field type identifier found: '" << fieldTypeChar << "'");
+    }
+  }
+
+  void IddField_Impl::validateProperties()
+  {
     if (m_properties.type == IddFieldType::ChoiceType){
       // if this is a choice, assert we have some keys
       if (m_keys.empty()){
@@ -729,6 +768,13 @@ OptionalIddField IddField::load(const std::string& name,
   else { return boost::none; }
 }
 
+OptionalIddField IddField::load(const IddFieldTable& table,
+                                const std::string& objectName) {
+  std::shared_ptr<detail::IddField_Impl> p = detail::IddField_Impl::load(table,objectName);
+  if (p) { return IddField(p); }
+  else { return boost::none; }
+}
+
 std::ostream& IddField::print(std::ostream& os, bool lastField) const
 {
   return m_impl->print(os, lastField);
@@ -51,6 +51,16 @@ namespace detail {
   class IddField_Impl;
 }
 
+/** IddFieldTable is the compiled form of an IddField's text, as written out by GenerateIddFactory.
+ *  The field text has already been split into its id (e.g. A1), its name, and its properties,
+ *  each property being the trimmed text that follows a slash code's backslash (e.g. "type alpha"). */
+struct IddFieldTable {
+  const char* name;
+  const char* fieldId;
+  const char* const* properties;
+  unsigned numProperties;
+};
+
 /** IddField represents a field in an IddObject, that is, the schema for a single piece of
  *  data (alpha or numeric) in an IDF. */
 class UTILITIES_API IddField {
@@ -138,6 +148,11 @@ class UTILITIES_API IddField {
                                         const std::string& text,
                                         const std::string& objectName);
 
+  /** Load the IddField from its compiled form. Equivalent to loading the text from which table was
+   *  generated, but no regular expressions are needed to split up the text. */
+  static boost::optional<IddField> load(const IddFieldTable& table,
+                                        const std::string& objectName);
+
   /** Print the IddField to an output stream. Field slash codes are indented to produce pretty
    *  output. If lastField, then the field id will be followed by a semi-colon; otherwise, a
    *  comma will be used (consistent with IDD formatting). */
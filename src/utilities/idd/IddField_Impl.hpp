@@ -131,6 +131,10 @@ namespace detail {
                                                  const std::string& text,
                                                  const std::string& objectName);
 
+    /** Load the IddField from its compiled form. */
+    static std::shared_ptr<IddField_Impl> load(const IddFieldTable& table,
+                                                 const std::string& objectName);
+
     /** Print the IddField to an output stream. Field slash codes are indented to produce pretty
      *  output. If lastField, then the field id will be followed by a semi-colon; otherwise, a
      *  comma will be used (consistent with IDD formatting). */
@@ -150,6 +154,15 @@ namespace detail {
     // parses the text
     void parse(const std::string& text);
 
+    // applies the properties in a compiled field
+    void parse(const IddFieldTable& table);
+
+    // sets the field id and the base content type
+    void setFieldId(const std::string& fieldTypeChar, const std::string& fieldTypeNumber);
+
+    // checks the properties after they have all been parsed
+    void validateProperties();
+
     // parse single field
     void parseField(const std::string& text);
 
@@ -36,9 +36,13 @@
 
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
+#include "../core/UUID.hpp"
 
 #include "../core/Containers.hpp"
 
+#include <cstdint>
+
 
 
 
@@ -46,6 +50,71 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // identifies the binary layout written by IddFile_Impl::saveCache
+    std::string cacheFormat() {
+      return "OpenStudio IDD cache 1\n";
+    }
+
+    void writeCacheCount(std::ostream& os, std::size_t count) {
+      std::uint32_t value = static_cast<std::uint32_t>(count);
+      unsigned char bytes[4] = { static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                                 static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 24) };
+      os.write(reinterpret_cast<const char*>(bytes), 4);
+    }
+
+    void writeCacheString(std::ostream& os, const std::string& text) {
+      writeCacheCount(os, text.size());
+      os.write(text.data(), text.size());
+    }
+
+    unsigned readCacheCount(std::istream& is) {
+      unsigned char bytes[4];
+      if (!is.read(reinterpret_cast<char*>(bytes), 4)) {
+        throw std::runtime_error("Unexpected end of IDD cache.");
+      }
+      return static_cast<unsigned>(bytes[0]) | (static_cast<unsigned>(bytes[1]) << 8) |
+             (static_cast<unsigned>(bytes[2]) << 16) | (static_cast<unsigned>(bytes[3]) << 24);
+    }
+
+    std::string readCacheString(std::istream& is) {
+      std::string result(readCacheCount(is), '\0');
+      if (!result.empty() && !is.read(&result[0], result.size())) {
+        throw std::runtime_error("Unexpected end of IDD cache.");
+      }
+      return result;
+    }
+
+    // loads compiled the way the IddFactory loads its generated tables
+    OptionalIddObject loadCompiled(const CompiledIddObject& compiled) {
+      std::vector<const char*> properties;
+      for (const std::string& property : compiled.properties) {
+        properties.push_back(property.c_str());
+      }
+      for (const CompiledIddField& field : compiled.fields) {
+        for (const std::string& property : field.properties) {
+          properties.push_back(property.c_str());
+        }
+      }
+
+      std::vector<IddFieldTable> fields;
+      unsigned begin = compiled.properties.size();
+      for (const CompiledIddField& field : compiled.fields) {
+        fields.push_back(IddFieldTable{field.name.c_str(), field.fieldId.c_str(), properties.data() + begin,
+                                       static_cast<unsigned>(field.properties.size())});
+        begin += field.properties.size();
+      }
+
+      return IddObject::load(compiled.name,
+                             compiled.group,
+                             IddObjectTable{properties.data(), static_cast<unsigned>(compiled.properties.size()),
+                                            fields.data(), static_cast<unsigned>(fields.size())},
+                             IddObjectType::UserCustom);
+    }
+
+  }
+
   // CONSTRUCTORS
 
   IddFile_Impl::IddFile_Impl()
@@ -202,6 +271,61 @@ namespace detail {
 
   }
 
+  std::shared_ptr<IddFile_Impl> IddFile_Impl::load(std::istream& is, std::vector<CompiledIddObject>& compiled) {
+    std::shared_ptr<IddFile_Impl> result;
+    IddFile_Impl iddFileImpl;
+
+    try {
+      iddFileImpl.parse(is, &compiled);
+    }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddFile_Impl>(new IddFile_Impl(iddFileImpl));
+    return result;
+  }
+
+  std::shared_ptr<IddFile_Impl> IddFile_Impl::loadCache(std::istream& is, const std::string& key) {
+    std::shared_ptr<IddFile_Impl> result;
+    IddFile_Impl iddFileImpl;
+
+    try {
+      iddFileImpl.parseCache(is, key);
+    }
+    catch (...) { return result; }
+
+    result = std::shared_ptr<IddFile_Impl>(new IddFile_Impl(iddFileImpl));
+    return result;
+  }
+
+  void IddFile_Impl::saveCache(std::ostream& os,
+                               const std::string& key,
+                               const std::vector<CompiledIddObject>& compiled) const
+  {
+    os << cacheFormat();
+    writeCacheString(os, key);
+    writeCacheString(os, m_version);
+    writeCacheString(os, m_build);
+    writeCacheString(os, m_header);
+    writeCacheCount(os, compiled.size());
+    for (const CompiledIddObject& object : compiled) {
+      writeCacheString(os, object.name);
+      writeCacheString(os, object.group);
+      writeCacheCount(os, object.properties.size());
+      for (const std::string& property : object.properties) {
+        writeCacheString(os, property);
+      }
+      writeCacheCount(os, object.fields.size());
+      for (const CompiledIddField& field : object.fields) {
+        writeCacheString(os, field.name);
+        writeCacheString(os, field.fieldId);
+        writeCacheCount(os, field.properties.size());
+        for (const std::string& property : field.properties) {
+          writeCacheString(os, property);
+        }
+      }
+    }
+  }
+
 
   std::ostream& IddFile_Impl::print(std::ostream& os) const
   {
@@ -220,7 +344,7 @@ namespace detail {
 
   // PRIVATE
 
-  void IddFile_Impl::parse(std::istream& is)
+  void IddFile_Impl::parse(std::istream& is, std::vector<CompiledIddObject>* compiled)
   {
 
     // keep track of line number in the idd
@@ -237,13 +361,7 @@ namespace detail {
 
     std::string currentGroup = "";
 
-    // fake a comment only object and put it in the object list and object map
-    OptionalIddObject commentOnlyObject = IddObject::load(iddRegex::commentOnlyObjectName(),
-                                                          currentGroup,
-                                                          iddRegex::commentOnlyObjectText(),
-                                                          IddObjectType::CommentOnly);
-    OS_ASSERT(commentOnlyObject);
-    m_objects.push_back(*commentOnlyObject);
+    addCommentOnlyObject();
 
     // temp string to read file
     std::string line;
@@ -361,8 +479,15 @@ namespace detail {
           }
         }
 
-        // construct the IddObject using default UserCustom type
-        OptionalIddObject object = IddObject::load(objectName, currentGroup, text);
+        // construct the IddObject using default UserCustom type, going through the same compiled
+        // tables as the IddFactory
+        OptionalIddObject object;
+        try {
+          CompiledIddObject compiledObject = CompiledIddObject::compile(objectName, currentGroup, text);
+          object = loadCompiled(compiledObject);
+          if (compiled) { compiled->push_back(compiledObject); }
+        }
+        catch (...) {}
 
         // construct a new object and put it in the object vector
         if (object) { m_objects.push_back(*object); }
@@ -377,6 +502,61 @@ namespace detail {
     m_header = header.str();
   }
 
+  void IddFile_Impl::parseCache(std::istream& is, const std::string& key)
+  {
+    std::string format = cacheFormat();
+    std::string formatText(format.size(), '\0');
+    if (!is.read(&formatText[0], format.size()) || (formatText != format)) {
+      LOG_AND_THROW("Not an IDD cache file.");
+    }
+    if (readCacheString(is) != key) {
+      LOG_AND_THROW("IDD cache file does not match its key.");
+    }
+    m_version = readCacheString(is);
+    m_build = readCacheString(is);
+    m_header = readCacheString(is);
+
+    addCommentOnlyObject();
+
+    unsigned numObjects = readCacheCount(is);
+    m_objects.reserve(numObjects + 1);
+    for (unsigned i = 0; i < numObjects; ++i) {
+      CompiledIddObject compiled;
+      compiled.name = readCacheString(is);
+      compiled.group = readCacheString(is);
+      compiled.properties.resize(readCacheCount(is));
+      for (std::string& property : compiled.properties) {
+        property = readCacheString(is);
+      }
+      compiled.fields.resize(readCacheCount(is));
+      for (CompiledIddField& field : compiled.fields) {
+        field.name = readCacheString(is);
+        field.fieldId = readCacheString(is);
+        field.properties.resize(readCacheCount(is));
+        for (std::string& property : field.properties) {
+          property = readCacheString(is);
+        }
+      }
+
+      OptionalIddObject object = loadCompiled(compiled);
+      if (!object) {
+        LOG_AND_THROW("Unable to construct IddObject '" << compiled.name << "' from IDD cache.");
+      }
+      m_objects.push_back(*object);
+    }
+  }
+
+  void IddFile_Impl::addCommentOnlyObject()
+  {
+    // fake a comment only object and put it in the object list and object map
+    OptionalIddObject commentOnlyObject = IddObject::load(iddRegex::commentOnlyObjectName(),
+                                                          "",
+                                                          iddRegex::commentOnlyObjectText(),
+                                                          IddObjectType::CommentOnly);
+    OS_ASSERT(commentOnlyObject);
+    m_objects.push_back(*commentOnlyObject);
+  }
+
 } // detail
 
 // CONSTRUCTORS
@@ -463,6 +643,50 @@ OptionalIddFile IddFile::load(std::istream& is)
   return boost::none;
 }
 
+OptionalIddFile IddFile::loadCached(const std::string& text, const openstudio::path& cacheDir)
+{
+  std::string key = checksum(text);
+  openstudio::path cachePath = cacheDir / toPath(key + ".iddcache");
+  if (openstudio::filesystem::exists(cachePath)) {
+    openstudio::filesystem::ifstream inFile(cachePath, std::ios_base::binary);
+    std::shared_ptr<detail::IddFile_Impl> p;
+    if (inFile) {
+      p = detail::IddFile_Impl::loadCache(inFile, key);
+    }
+    if (p) { return IddFile(p); }
+    LOG(Warn, "Unable to read IDD cache file '" << toString(cachePath) << "', parsing the IDD text instead.");
+  }
+
+  std::stringstream ss(text);
+  std::vector<detail::CompiledIddObject> compiled;
+  std::shared_ptr<detail::IddFile_Impl> p = detail::IddFile_Impl::load(ss, compiled);
+  if (!p) { return boost::none; }
+
+  // write to a file of our own and then move it into place, so that other threads and processes
+  // sharing cacheDir never read a partial cache file
+  openstudio::path tempPath = cacheDir / toPath(key + "." + removeBraces(createUUID()) + ".tmp");
+  try {
+    openstudio::filesystem::create_directories(cacheDir);
+    {
+      openstudio::filesystem::ofstream outFile(tempPath, std::ios_base::binary | std::ios_base::trunc);
+      if (outFile) {
+        p->saveCache(outFile, key, compiled);
+      }
+      if (!outFile) {
+        throw std::runtime_error("Unable to write '" + toString(tempPath) + "'.");
+      }
+    }
+    openstudio::filesystem::rename(tempPath, cachePath);
+  }
+  catch (const std::exception& e) {
+    LOG(Warn, "Unable to write IDD cache file '" << toString(cachePath) << "': " << e.what());
+    boost::system::error_code ec;
+    openstudio::filesystem::remove(tempPath, ec);
+  }
+
+  return IddFile(p);
+}
+
 OptionalIddFile IddFile::load(const openstudio::path& p) {
   openstudio::path wp = completePathToFile(p,path(),"idd",true);
   if (wp.empty()) { return boost::none; }
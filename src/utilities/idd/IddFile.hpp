@@ -124,6 +124,11 @@ class UTILITIES_API IddFile {
   /** Load an IddFile from path p, if possible. */
   static boost::optional<IddFile> load(const openstudio::path& p);
 
+  /** Load an IddFile from IDD text, if possible, going through an on-disk cache in cacheDir. The
+   *  cache file is named by the checksum of text. If it exists, the IddFile is read from it
+   *  without parsing text. Otherwise text is parsed and the cache file is written for next time. */
+  static boost::optional<IddFile> loadCached(const std::string& text, const openstudio::path& cacheDir);
+
   /** Prints this file to std::ostream os. */
   std::ostream& print(std::ostream& os) const;
 
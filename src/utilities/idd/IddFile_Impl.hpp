@@ -32,6 +32,7 @@
 
 #include "../UtilitiesAPI.hpp"
 #include "IddObject.hpp"
+#include "CompiledIddObject.hpp"
 #include "../core/Logger.hpp"
 
 #include <string>
@@ -113,6 +114,15 @@ namespace detail{
     /// parse text from input stream to construct an IddFile_Impl
     static std::shared_ptr<IddFile_Impl> load(std::istream& is);
 
+    /// parse text from input stream, also returning the compiled objects for saveCache
+    static std::shared_ptr<IddFile_Impl> load(std::istream& is, std::vector<CompiledIddObject>& compiled);
+
+    /// read an IddFile_Impl written by saveCache, checking that it was saved under key
+    static std::shared_ptr<IddFile_Impl> loadCache(std::istream& is, const std::string& key);
+
+    /// write this file's version and header, and its objects as compiled, to a binary cache
+    void saveCache(std::ostream& os, const std::string& key, const std::vector<CompiledIddObject>& compiled) const;
+
     /// print
     std::ostream& print(std::ostream& os) const;
 
@@ -120,8 +130,14 @@ namespace detail{
 
    private:
 
-    /// Parse file text to populate this IddFile.
-    void parse(std::istream& is);
+    /// Parse file text to populate this IddFile. Objects are compiled into compiled, if given.
+    void parse(std::istream& is, std::vector<CompiledIddObject>* compiled = nullptr);
+
+    /// Read a binary cache to populate this IddFile.
+    void parseCache(std::istream& is, const std::string& key);
+
+    /// Adds the CommentOnly object every IddFile starts with.
+    void addCommentOnlyObject();
 
     /// Version string required to be at top of any IddFile.
     std::string m_version;
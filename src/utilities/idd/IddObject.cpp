@@ -428,6 +428,22 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddObject_Impl> IddObject_Impl::load(const std::string& name,
+                                                         const std::string& group,
+                                                         const IddObjectTable& table,
+                                                         IddObjectType type)
+  {
+    std::shared_ptr<IddObject_Impl> result;
+    result = std::shared_ptr<IddObject_Impl>(new IddObject_Impl(name,group,type));
+
+    try {
+      result->parse(table);
+    }
+    catch (...) { return std::shared_ptr<IddObject_Impl>(); }
+
+    return result;
+  }
+
   /// print
   std::ostream& IddObject_Impl::print(std::ostream& os) const
   {
@@ -496,6 +512,29 @@ namespace detail {
 
   }
 
+  void IddObject_Impl::parse(const IddObjectTable& table)
+  {
+    // the generator has already split the text into object properties and fields
+    for (unsigned i = 0; i < table.numProperties; ++i) {
+      parseProperty(table.properties[i]);
+    }
+
+    m_fields.reserve(table.numFields);
+    for (unsigned i = 0; i < table.numFields; ++i) {
+      OptionalIddField oField = IddField::load(table.fields[i], m_name);
+      if (!oField) {
+        LOG_AND_THROW("Cannot load compiled IddField '" << table.fields[i].name << "' in object '"
+                      << m_name << "'.");
+      }
+      m_fields.push_back(*oField);
+    }
+
+    // remove existing extensible fields and add them the the extensible list
+    if (m_properties.extensible) {
+      makeExtensible();
+    }
+  }
+
   void IddObject_Impl::makeExtensible()
   {
     // number of fields in extensible group
@@ -831,6 +870,15 @@ boost::optional<IddObject> IddObject::load(const std::string& name,
   return load(name,group,text,IddObjectType(IddObjectType::UserCustom));
 }
 
+boost::optional<IddObject> IddObject::load(const std::string& name,
+                                           const std::string& group,
+                                           const IddObjectTable& table,
+                                           IddObjectType type) {
+  std::shared_ptr<detail::IddObject_Impl> p = detail::IddObject_Impl::load(name,group,table,type);
+  if (p) { return IddObject(p); }
+  else { return boost::none; }
+}
+
 std::ostream& IddObject::print(std::ostream& os) const
 {
   return m_impl->print(os);
@@ -51,6 +51,17 @@ namespace detail {
   class IddObject_Impl;
 } // detail
 
+/** IddObjectTable is the compiled form of an IddObject's text, as written out by GenerateIddFactory
+ *  so that the IddFactory does not have to parse IDD text at run time. properties holds the object's
+ *  own properties (the trimmed text following each slash code's backslash) and fields holds the
+ *  fields in order. */
+struct IddObjectTable {
+  const char* const* properties;
+  unsigned numProperties;
+  const IddFieldTable* fields;
+  unsigned numFields;
+};
+
 /** IddObject represents an object in the Idd.  IddObject is a shared object. */
 class UTILITIES_API IddObject {
  public:
@@ -205,6 +216,13 @@ class UTILITIES_API IddObject {
                                          const std::string& group,
                                          const std::string& text);
 
+  /** Load from name, group, type, and the compiled form of the object's text. Used by the
+   *  IddFactory, equivalent to loading the text from which table was generated. */
+  static boost::optional<IddObject> load(const std::string& name,
+                                         const std::string& group,
+                                         const IddObjectTable& table,
+                                         IddObjectType type);
+
   /** Print this object to os, in standard IDD format. */
   std::ostream& print(std::ostream& os) const;
 
@@ -179,6 +179,12 @@ namespace detail {
                                                   const std::string& text,
                                                   IddObjectType type);
 
+    /** Load from name, group, type, and compiled text. */
+    static std::shared_ptr<IddObject_Impl> load(const std::string& name,
+                                                  const std::string& group,
+                                                  const IddObjectTable& table,
+                                                  IddObjectType type);
+
     // print
     std::ostream& print(std::ostream& os) const;
 
@@ -202,6 +208,7 @@ namespace detail {
 
     // parse
     void parse(const std::string& text);
+    void parse(const IddObjectTable& table);
 
     void parseObject(const std::string& text);
     void parseProperty(const std::string& text);
@@ -43,6 +43,9 @@
 
 #include <OpenStudio.hxx>
 
+#include <chrono>
+#include <thread>
+
 using namespace openstudio;
 
 TEST_F(IddFixture,IddFactory_Version_Header) {
@@ -102,6 +105,53 @@ TEST_F(IddFixture,IddFactory_IddFile)
   EXPECT_TRUE(file.objects().size() == objects.size());
 }
 
+TEST_F(IddFixture,IddFactory_PreviousVersions_Threads)
+{
+  // threads asking for the same previous version all get the one IddFile
+  VersionString version("1.13.4");
+  std::vector<OptionalIddFile> files(4);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < files.size(); ++i) {
+    threads.emplace_back([&files, &version, i]() {
+      files[i] = IddFactory::instance().getIddFile(IddFileType::OpenStudio, version);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ASSERT_TRUE(files[0]);
+  EXPECT_EQ("1.13.4", files[0]->version());
+  for (const OptionalIddFile& file : files) {
+    ASSERT_TRUE(file);
+    ASSERT_EQ(files[0]->objects().size(), file->objects().size());
+    EXPECT_TRUE(files[0]->objects()[1] == file->objects()[1]);
+  }
+
+  IddFactory::instance().preloadIddFiles(IddFileType::OpenStudio, 4);
+  OptionalIddFile file = IddFactory::instance().getIddFile(IddFileType::OpenStudio, VersionString("1.0.0"));
+  ASSERT_TRUE(file);
+  EXPECT_EQ("1.0.0", file->version());
+  EXPECT_FALSE(IddFactory::instance().getIddFile(IddFileType::OpenStudio, VersionString("0.1.0")));
+}
+
+// Times the first use of every IddObject in the IddFactory, which is what a cold process pays to
+// load a model. Only meaningful when run on its own, e.g.
+// --gtest_also_run_disabled_tests --gtest_filter=IddFactory.DISABLED_ColdStart_Benchmark
+TEST(IddFactory,DISABLED_ColdStart_Benchmark)
+{
+  auto start = std::chrono::steady_clock::now();
+  IddObjectVector objects = IddFactory::instance().objects();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_FALSE(objects.empty());
+  std::cout << "Created " << objects.size() << " IddObjects in " << elapsed.count() << " s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  IddFile file = IddFactory::instance().getIddFile(IddFileType::OpenStudio);
+  elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_FALSE(file.objects().empty());
+  std::cout << "Assembled the OpenStudio IddFile in " << elapsed.count() << " s" << std::endl;
+}
+
 TEST_F(IddFixture,IddFactory_isInFile)
 {
   EXPECT_TRUE(IddFactory::instance().isInFile(IddObjectType::Building,IddFileType::EnergyPlus));
@@ -383,3 +383,52 @@ TEST_F(IddFixture, IddFile_EpGroups) {
       << " object groups, including the first, unnamed group: " << std::endl << ss.str());
 }
 
+TEST_F(IddFixture, IddFile_LoadCached)
+{
+  path iddPath = resourcesPath() / toPath("model/OpenStudio.idd");
+  openstudio::filesystem::ifstream inFile(iddPath); ASSERT_TRUE(inFile ? true : false);
+  std::stringstream text;
+  text << inFile.rdbuf();
+  inFile.close();
+
+  std::stringstream ss(text.str());
+  OptionalIddFile parsed = IddFile::load(ss);
+  ASSERT_TRUE(parsed);
+  std::stringstream expected;
+  parsed->print(expected);
+
+  path cacheDir = resourcesPath() / toPath("utilities/IddCache");
+  openstudio::filesystem::remove_all(cacheDir);
+
+  // first load parses the text and writes the cache
+  OptionalIddFile cached = IddFile::loadCached(text.str(), cacheDir);
+  ASSERT_TRUE(cached);
+  unsigned numCacheFiles = 0;
+  for (openstudio::filesystem::directory_iterator it(cacheDir); it != openstudio::filesystem::directory_iterator(); ++it) {
+    EXPECT_EQ(".iddcache", toString(it->path().extension()));
+    ++numCacheFiles;
+  }
+  EXPECT_EQ(1u, numCacheFiles);
+  std::stringstream printed;
+  cached->print(printed);
+  EXPECT_EQ(expected.str(), printed.str());
+
+  // second load reads the cache
+  cached = IddFile::loadCached(text.str(), cacheDir);
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(parsed->version(), cached->version());
+  EXPECT_EQ(parsed->header(), cached->header());
+  ASSERT_EQ(parsed->objects().size(), cached->objects().size());
+  printed.str("");
+  cached->print(printed);
+  EXPECT_EQ(expected.str(), printed.str());
+
+  // a damaged cache file is ignored
+  path cachePath = openstudio::filesystem::directory_iterator(cacheDir)->path();
+  openstudio::filesystem::ofstream outFile(cachePath, std::ios_base::binary | std::ios_base::trunc);
+  outFile << "OpenStudio IDD cache 1\n";
+  outFile.close();
+  cached = IddFile::loadCached(text.str(), cacheDir);
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(parsed->objects().size(), cached->objects().size());
+}
@@ -53,6 +53,71 @@ TEST_F(IddFixture,IddObject_URL)
   EXPECT_TRUE(vec[0] == 2);
 }
 
+TEST_F(IddFixture,IddObject_LoadFromTable)
+{
+  std::stringstream text;
+  text << "Test:Compiled," << std::endl
+       << "\\memo A compiled object" << std::endl
+       << "\\extensible:2" << std::endl
+       << "\\min-fields 5" << std::endl
+       << "A1, \\field Name" << std::endl
+       << "\\required-field" << std::endl
+       << "\\reference CompiledNames" << std::endl
+       << "A2, \\field Method" << std::endl
+       << "\\type choice" << std::endl
+       << "\\key One" << std::endl
+       << "\\key Two" << std::endl
+       << "\\default One" << std::endl
+       << "N1, \\field Vertex 1 X-coordinate" << std::endl
+       << "\\begin-extensible" << std::endl
+       << "\\units m" << std::endl
+       << "N2; \\field Vertex 1 Y-coordinate" << std::endl
+       << "\\units m" << std::endl;
+  OptionalIddObject fromText = IddObject::load("Test:Compiled","Compiled",text.str(),IddObjectType::UserCustom);
+  ASSERT_TRUE(fromText);
+
+  // the tables GenerateIddFactory would write for the text above
+  static constexpr const char* properties[] = {
+    "memo A compiled object",
+    "extensible:2",
+    "min-fields 5",
+    "field Name",
+    "required-field",
+    "reference CompiledNames",
+    "field Method",
+    "type choice",
+    "key One",
+    "key Two",
+    "default One",
+    "field Vertex 1 X-coordinate",
+    "begin-extensible",
+    "units m",
+    "field Vertex 1 Y-coordinate",
+    "units m",
+  };
+  static constexpr IddFieldTable fields[] = {
+    {"Name", "A1", properties + 3, 3},
+    {"Method", "A2", properties + 6, 5},
+    {"Vertex 1 X-coordinate", "N1", properties + 11, 3},
+    {"Vertex 1 Y-coordinate", "N2", properties + 14, 2},
+  };
+  OptionalIddObject fromTable = IddObject::load("Test:Compiled","Compiled",IddObjectTable{properties, 3, fields, 4},
+                                                IddObjectType::UserCustom);
+  ASSERT_TRUE(fromTable);
+  EXPECT_TRUE(*fromText == *fromTable);
+  EXPECT_EQ(2u,fromTable->numFields());
+  EXPECT_EQ(2u,fromTable->properties().numExtensibleGroupsRequired);
+  ASSERT_EQ(2u,fromTable->extensibleGroup().size());
+  EXPECT_EQ("Vertex X-coordinate",fromTable->extensibleGroup()[0].name());
+
+  // bad tables fail to load, as bad text does
+  static constexpr IddFieldTable badFields[] = {
+    {"Name", "X1", properties + 3, 3},
+  };
+  EXPECT_FALSE(IddObject::load("Test:Compiled","Compiled",IddObjectTable{properties, 3, badFields, 1},
+                               IddObjectType::UserCustom));
+}
+
 TEST_F(IddFixture,IddObject_EqualityOperators) {
   // IddObjectProperties
   // == because same
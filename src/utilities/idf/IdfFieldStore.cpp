@@ -0,0 +1,191 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "IdfFieldStore.hpp"
+
+#include "../core/Assert.hpp"
+#include <atomic>
+
+namespace openstudio {
+namespace detail {
+
+  IdfFieldStore::IdfFieldStore()
+  {}
+
+  IdfFieldStore::IdfFieldStore(const std::vector<std::string>& fields)
+  {
+    std::size_t numChars = 0;
+    for (const std::string& field : fields) {
+      numChars += field.size();
+    }
+    reserve(fields.size(), numChars);
+    for (const std::string& field : fields) {
+      push_back(field);
+    }
+  }
+
+  std::size_t IdfFieldStore::size() const {
+    return m_data ? m_data->ends.size() : 0;
+  }
+
+  bool IdfFieldStore::empty() const {
+    return (size() == 0);
+  }
+
+  std::string_view IdfFieldStore::operator[](std::size_t index) const {
+    OS_ASSERT(index < size());
+    std::size_t first = begin(index);
+    return std::string_view(m_data->buffer.data() + first, m_data->ends[index] - first);
+  }
+
+  std::string_view IdfFieldStore::back() const {
+    return (*this)[size() - 1];
+  }
+
+  void IdfFieldStore::set(std::size_t index, std::string_view value) {
+    OS_ASSERT(index < size());
+    Data& data = mutableData();
+
+    // value may be a view of this store
+    if ((value.data() >= data.buffer.data()) && (value.data() < data.buffer.data() + data.buffer.size())) {
+      std::string copy(value);
+      set(index, copy);
+      return;
+    }
+
+    std::size_t first = begin(index);
+    std::size_t oldSize = data.ends[index] - first;
+    data.buffer.replace(first, oldSize, value.data(), value.size());
+    if (value.size() != oldSize) {
+      std::uint32_t newEnd = static_cast<std::uint32_t>(first + value.size());
+      std::int64_t delta = static_cast<std::int64_t>(value.size()) - static_cast<std::int64_t>(oldSize);
+      data.ends[index] = newEnd;
+      for (std::size_t i = index + 1; i < data.ends.size(); ++i) {
+        data.ends[i] = static_cast<std::uint32_t>(data.ends[i] + delta);
+      }
+    }
+  }
+
+  void IdfFieldStore::push_back(std::string_view value) {
+    Data& data = mutableData();
+    if ((value.data() >= data.buffer.data()) && (value.data() < data.buffer.data() + data.buffer.size())) {
+      std::string copy(value);
+      push_back(copy);
+      return;
+    }
+    data.buffer.append(value.data(), value.size());
+    data.ends.push_back(static_cast<std::uint32_t>(data.buffer.size()));
+  }
+
+  void IdfFieldStore::pop_back() {
+    OS_ASSERT(!empty());
+    Data& data = mutableData();
+    data.ends.pop_back();
+    data.buffer.resize(data.ends.empty() ? 0 : data.ends.back());
+  }
+
+  void IdfFieldStore::resize(std::size_t n) {
+    if (n == size()) {
+      return;
+    }
+    Data& data = mutableData();
+    if (n < data.ends.size()) {
+      data.ends.resize(n);
+      data.buffer.resize(data.ends.empty() ? 0 : data.ends.back());
+    } else {
+      data.ends.resize(n, static_cast<std::uint32_t>(data.buffer.size()));
+    }
+  }
+
+  void IdfFieldStore::reserve(std::size_t numFields, std::size_t numChars) {
+    if ((numFields == 0) && (numChars == 0)) {
+      return;
+    }
+    Data& data = mutableData();
+    data.ends.reserve(numFields);
+    data.buffer.reserve(numChars);
+  }
+
+  void IdfFieldStore::shrinkToFit() {
+    // a shared buffer is not copied just to shrink it
+    if (m_data && (m_data.use_count() == 1)) {
+      m_data->ends.shrink_to_fit();
+      m_data->buffer.shrink_to_fit();
+    }
+  }
+
+  void IdfFieldStore::clear() {
+    m_data.reset();
+  }
+
+  std::vector<std::string> IdfFieldStore::strings() const {
+    std::vector<std::string> result;
+    result.reserve(size());
+    for (std::size_t i = 0, n = size(); i < n; ++i) {
+      result.emplace_back((*this)[i]);
+    }
+    return result;
+  }
+
+  std::size_t IdfFieldStore::memoryUsage() const {
+    if (!m_data) {
+      return 0;
+    }
+    std::size_t result = m_data->ends.capacity() * sizeof(std::uint32_t);
+    // short buffers are stored inside the string itself
+    if (m_data->buffer.capacity() > std::string().capacity()) {
+      result += m_data->buffer.capacity() + 1;
+    }
+    return result;
+  }
+
+  bool IdfFieldStore::sharesStorageWith(const IdfFieldStore& other) const {
+    return m_data && (m_data == other.m_data);
+  }
+
+  std::size_t IdfFieldStore::begin(std::size_t index) const {
+    return (index == 0) ? 0 : m_data->ends[index - 1];
+  }
+
+  IdfFieldStore::Data& IdfFieldStore::mutableData() {
+    if (!m_data) {
+      m_data = std::make_shared<Data>();
+    } else if (m_data.use_count() > 1) {
+      m_data = std::make_shared<Data>(*m_data);
+    } else {
+      // use_count() is a relaxed load, the fence orders the writes that follow after the reads of
+      // the buffer by stores that shared it and have since been modified or destroyed on other threads
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *m_data;
+  }
+
+} // detail
+} // openstudio
@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_IDF_IDFFIELDSTORE_HPP
+#define UTILITIES_IDF_IDFFIELDSTORE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Compact storage for the fields (or field comments) of an IdfObject. All of the text is kept
+   *  in a single buffer with the end offset of each field alongside, so an object costs a fixed
+   *  number of heap allocations no matter how many fields it has, rather than one std::string per
+   *  field. Fields are read as views into the buffer, which are invalidated by any modification.
+   *
+   *  Copies share the buffer until one of them is modified, so cloning an object (or a whole
+   *  Workspace) does not copy its text. A store that has never held fields allocates nothing.
+   *
+   *  Stores that share a buffer may be modified on different threads, e.g. a Workspace and its
+   *  clone. As for any other object, a single store must not be copied or read on one thread while
+   *  it is modified on another. */
+  class UTILITIES_API IdfFieldStore {
+   public:
+    IdfFieldStore();
+
+    explicit IdfFieldStore(const std::vector<std::string>& fields);
+
+    /** Returns the number of fields. */
+    std::size_t size() const;
+
+    bool empty() const;
+
+    /** Returns the text of field index, which must be less than size(). */
+    std::string_view operator[](std::size_t index) const;
+
+    /** Returns the text of the last field, there must be at least one field. */
+    std::string_view back() const;
+
+    /** Sets the text of field index, which must be less than size(). */
+    void set(std::size_t index, std::string_view value);
+
+    void push_back(std::string_view value);
+
+    void pop_back();
+
+    /** Removes fields from the end, or appends empty fields, so that there are n fields. */
+    void resize(std::size_t n);
+
+    /** Reserves space for numFields fields holding numChars characters in total. */
+    void reserve(std::size_t numFields, std::size_t numChars);
+
+    /** Releases any reserved space that is not used. */
+    void shrinkToFit();
+
+    void clear();
+
+    /** Returns a copy of the fields as strings. */
+    std::vector<std::string> strings() const;
+
+    /** Returns the number of heap bytes used to store the fields, including any shared with copies. */
+    std::size_t memoryUsage() const;
+
+    /** Returns true if this store and other share their text, and so are equal. */
+    bool sharesStorageWith(const IdfFieldStore& other) const;
+
+   private:
+    struct Data {
+      std::string buffer;
+      std::vector<std::uint32_t> ends;
+    };
+
+    std::size_t begin(std::size_t index) const;
+
+    // returns m_data for modification, copying it first if it is shared
+    Data& mutableData();
+
+    // null if there are no fields
+    std::shared_ptr<Data> m_data;
+  };
+
+} // detail
+} // openstudio
+
+#endif //UTILITIES_IDF_IDFFIELDSTORE_HPP
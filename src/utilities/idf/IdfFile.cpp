@@ -29,7 +29,7 @@
 
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp> // needed for serialization
-#include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
@@ -41,11 +41,16 @@
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/System.hpp"
 
 
 
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+
+#include <atomic>
+#include <future>
+#include <thread>
 
 
 namespace openstudio {
@@ -324,14 +329,15 @@ ValidityReport IdfFile::validityReport(StrictnessLevel level) const {
 
 boost::optional<IdfFile> IdfFile::load(std::istream& is,
                                        const IddFileType& iddFileType,
-                                       ProgressBar* progressBar)
+                                       ProgressBar* progressBar,
+                                       unsigned numThreads)
 {
   IdfFile result(iddFileType);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
     result.removeObject(*vo);
   }
-  if (result.m_load(is, progressBar)) {
+  if (result.m_load(is, progressBar, false, numThreads)) {
     // check for it again here
     result.addVersionObject();
     return result;
@@ -341,14 +347,15 @@ boost::optional<IdfFile> IdfFile::load(std::istream& is,
 
 OptionalIdfFile IdfFile::load(std::istream& is,
                               const IddFile& iddFile,
-                              ProgressBar* progressBar)
+                              ProgressBar* progressBar,
+                              unsigned numThreads)
 {
   IdfFile result(iddFile);
   // remove initial version object
   if (OptionalIdfObject vo = result.versionObject()) {
     result.removeObject(*vo);
   }
-  if (result.m_load(is, progressBar)) {
+  if (result.m_load(is, progressBar, false, numThreads)) {
     // check for it again here
     result.addVersionObject();
     return result;
@@ -356,7 +363,7 @@ OptionalIdfFile IdfFile::load(std::istream& is,
   return boost::none;
 }
 
-OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar, unsigned numThreads) {
   // determine IddFileType
   IddFileType iddType(IddFileType::EnergyPlus); // default
 
@@ -370,12 +377,13 @@ OptionalIdfFile IdfFile::load(const path& p, ProgressBar* progressBar) {
     iddType = IddFileType(IddFileType::OpenStudio);
   }
 
-  return load(p, iddType, progressBar);
+  return load(p, iddType, progressBar, numThreads);
 }
 
 OptionalIdfFile IdfFile::load(const path& p,
                               const IddFileType& iddFileType,
-                              ProgressBar* progressBar)
+                              ProgressBar* progressBar,
+                              unsigned numThreads)
 {
   // complete path
   path wp(p);
@@ -405,7 +413,7 @@ OptionalIdfFile IdfFile::load(const path& p,
   openstudio::filesystem::ifstream inFile(wp);
   if (inFile) {
     try {
-      return load(inFile, iddFileType, progressBar);
+      return load(inFile, iddFileType, progressBar, numThreads);
     }
     catch (...) { return boost::none; }
   }
@@ -413,7 +421,7 @@ OptionalIdfFile IdfFile::load(const path& p,
   return boost::none;
 }
 
-OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar* progressBar) {
+OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar* progressBar, unsigned numThreads) {
   // complete path
   path wp = completePathToFile(p,path(),"idf",false);
 
@@ -421,7 +429,7 @@ OptionalIdfFile IdfFile::load(const path& p, const IddFile& iddFile, ProgressBar
   openstudio::filesystem::ifstream inFile(wp);
   if (inFile) {
     try {
-      return load(inFile, iddFile, progressBar);
+      return load(inFile, iddFile, progressBar, numThreads);
     }
     catch (...) { return boost::none; }
   }
@@ -462,21 +470,43 @@ boost::optional<VersionString> IdfFile::loadVersionOnly(const path& p) {
 
 std::ostream& IdfFile::print(std::ostream& os) const {
   if (!m_header.empty()) {
-    os << m_header << std::endl;
+    os << m_header << '\n';
   }
-  os << std::endl;
+  os << '\n';
   for (const IdfObject& object : m_objects){
     object.print(os);
   }
   return os;
 }
 
-bool IdfFile::save(const openstudio::path& p, bool overwrite) {
+bool IdfFile::save(const openstudio::path& p, bool overwrite, bool atomic) {
+  path wp = savePath(p,m_iddFileAndFactoryWrapper,overwrite);
+  if (wp.empty()) {
+    return false;
+  }
+
+  std::string text;
+  if (!m_header.empty()) {
+    text += m_header;
+    text += '\n';
+  }
+  text += '\n';
+  for (const IdfObject& object : m_objects){
+    object.getImpl<detail::IdfObject_Impl>()->appendText(text);
+  }
+  return writeFile(wp,text,atomic);
+}
+
+// PROTECTED
 
+openstudio::path IdfFile::savePath(const openstudio::path& p,
+                                   const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                                   bool overwrite)
+{
   // default extension
   std::string expectedExtension;
   bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  OptionalIddFileType iddType = iddFileAndFactoryWrapper.iddFileType();
   if (iddType) {
     if (*iddType == IddFileType::EnergyPlus) {
       expectedExtension = "idf";
@@ -507,93 +537,137 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
     if (!temp.empty()) {
       LOG(Info,"Save method failed because instructed not to overwrite path '"
         << toString(wp) << "'.");
+      return path();
+    }
+  }
+
+  return wp;
+}
+
+bool IdfFile::writeFile(const openstudio::path& p, const std::string& text, bool atomic) {
+  if (!makeParentFolder(p)) {
+    LOG(Error,"Unable to write file to path '" << toString(p) << "', because parent directory "
+        << "could not be created.");
+    return false;
+  }
+
+  // an atomic write goes next to p under a name no other save will pick, and replaces p once
+  // complete, so that a failed save does not truncate an existing file
+  boost::system::error_code ec;
+  path wp(p);
+  if (atomic) {
+    wp = openstudio::filesystem::unique_path(p.parent_path() / toPath(toString(p.filename()) + ".%%%%-%%%%-%%%%.tmp"),ec);
+    if (ec) {
+      LOG(Error,"Unable to write file to path '" << toString(p) << "', because a temporary file "
+          << "name could not be created.");
       return false;
     }
   }
 
-  if (makeParentFolder(wp)) {
+  bool ok = false;
+  try {
     openstudio::filesystem::ofstream outFile(wp);
     if (outFile) {
-      try {
-        print(outFile);
-        outFile.close();
-        return true;
-      }
-      catch (...) {
-        LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
-        return false;
-      }
+      outFile.write(text.data(),text.size());
+      outFile.close();
+      ok = !outFile.fail();
     }
   }
+  catch (...) {
+    ok = false;
+  }
 
-  LOG(Error,"Unable to write file to path '" << toString(wp) << "', because parent directory "
-      << "could not be created.");
-  return false;
+  if (ok && atomic) {
+    openstudio::filesystem::rename(wp,p,ec);
+    ok = !ec;
+  }
+  if (!ok) {
+    if (atomic) {
+      openstudio::filesystem::remove(wp,ec);
+    }
+    LOG(Error,"Unable to write file to path '" << toString(p) << "'.");
+  }
+  return ok;
 }
 
 // PRIVATE
 
 // SERIALIZATION
 
-bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
+namespace {
+
+  // object text found by the first pass of IdfFile::m_load, to be turned into an IdfObject
+  struct IdfLoadJob {
+    std::string_view text;
+    IddObject iddObject;
+    bool commentOnly;
+    std::size_t progressEnd; // number of progress values reported before this object is added
+  };
+
+  std::shared_ptr<detail::IdfObject_Impl> buildObject(const IdfLoadJob& job, detail::IdfObjectTokens& tokens) {
+    if (job.commentOnly) {
+      detail::IdfTokenizer::tokenizeComment(job.text, tokens);
+    }
+    else if (!detail::IdfTokenizer::tokenizeObject(job.text, tokens)) {
+      return std::shared_ptr<detail::IdfObject_Impl>();
+    }
+    return detail::IdfObject_Impl::load(tokens, job.iddObject);
+  }
+
+}
+
+bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly, unsigned numThreads) {
 
-  int lineNum = 0;        // Idf line number
   int objectNum = 0;      // number of objects, first is #1
-  std::string line;       // temp string to help with reading
-  boost::smatch matches;  // matches to regular expressions
-  std::string comment;    // keep running comment
   bool firstBlock = true; // to capture first comment block as the header
 
+  // read the whole file up front, making sure that no matter what line endings come in, they
+  // are converted to '\n'. everything below works on views into this buffer.
+  std::string buffer;
+  detail::IdfTokenizer::readAll(is, buffer);
+  detail::IdfTokenizer tokenizer(buffer);
+
   if (progressBar){
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>(buffer.size()));
   }
 
+  // first pass: find object boundaries and idd objects. progress values are recorded so that
+  // they can be reported in step with the objects being added below.
+  std::vector<IdfLoadJob> jobs;
+  std::vector<int> progressValues;
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-//#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-//#else
-//  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-//#endif
-  filt.push(is);
-
-  // read the file line by line using regexes
-  while(std::getline(filt, line)){
-
-    if (line == "\r")
-    {
-      // This is not a real line at all, just the vestiges from the
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
-    }
+  std::string_view line;                           // current line
+  std::size_t commentBegin = std::string::npos;   // start of running comment, if any
+  std::size_t commentEnd = 0;                      // end of running comment
 
-    ++lineNum;
+  // read the file line by line
+  while (tokenizer.nextLine(line)) {
 
     if (progressBar){
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
+      progressValues.push_back(static_cast<int>(tokenizer.position()));
     }
 
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())){
+    std::size_t lineBegin = line.data() - buffer.data();
+    detail::IdfTokenizer::LineType lineType = detail::IdfTokenizer::lineType(line);
+
+    if (lineType == detail::IdfTokenizer::CommentLine){
       // continue comment
-      comment += (line + idfRegex::newLinestring());
+      if (commentBegin == std::string::npos) {
+        commentBegin = lineBegin;
+      }
+      commentEnd = lineBegin + line.size();
     }
-    else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())){
+    else if (lineType == detail::IdfTokenizer::WhitespaceLine){
       // end comment
-      boost::trim(comment);
+      if (commentBegin != std::string::npos) {
+        std::string_view comment(buffer.data() + commentBegin, commentEnd - commentBegin);
 
-      if (!comment.empty()) {
         if (firstBlock) {
           // set this comment as the header
-          setHeader(comment);
+          std::string header(comment);
+          boost::trim(header);
+          setHeader(header);
           firstBlock = false;
         }
         else {
@@ -606,40 +680,34 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
               continue;
             }
 
-            OptionalIdfObject commentOnlyObject;
-            commentOnlyObject = IdfObject::load(commentOnlyIddObject->name() + ";" + comment,
-                                                *commentOnlyIddObject);
-            OS_ASSERT(commentOnlyObject);
-
-            // put it in the object list
-            addObject(*commentOnlyObject);
+            jobs.push_back(IdfLoadJob{comment, *commentOnlyIddObject, true, progressValues.size()});
           }
         }
       }
 
       //clear out comment
-      comment = "";
+      commentBegin = std::string::npos;
 
     }
     else{
 
-      bool foundEndLine(false);
       firstBlock = false;
       bool isVersion = false;
 
-      // peek at the object type and name for indexing in map
+      // peek at the object type for idd lookup
       std::string objectType;
 
-      if (boost::regex_search(line, matches, idfRegex::line())){
-        objectType = std::string(matches[1].first, matches[1].second); boost::trim(objectType);
+      std::string_view lineObjectType;
+      if (detail::IdfTokenizer::objectType(line, lineObjectType)){
+        objectType = std::string(lineObjectType);
       }else{
         // can't figure out the object's type
         if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+          LOG(Warn, "Unrecognizable object type '" << line << "'. Defaulting to 'Catchall'.");
         }
         objectType = "Catchall";
       }
-      if (boost::regex_match(objectType,iddRegex::versionObjectName())) {
+      if (boost::contains(objectType, "version") || boost::contains(objectType, "Version")) {
         isVersion = true;
       }
 
@@ -655,54 +723,118 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       }
       else { OS_ASSERT(iddObject->type() != IddObjectType::Catchall); }
 
-      // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
-      comment = "";
-
-        // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())){
-        foundEndLine = true;
-      }
+      // the text for this object starts with its comment
+      std::size_t objectBegin = (commentBegin == std::string::npos) ? lineBegin : commentBegin;
+      commentBegin = std::string::npos;
 
       // continue reading until we have seen the entire object
-      // last line will be thrown away, requires empty line between objects in Idf
-      while((!foundEndLine) && (std::getline(filt, line))){
-        ++lineNum;
+      std::string_view lastLine;
+      bool foundEndLine = tokenizer.readObject(line, lastLine);
 
-        // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
+      // queue the object for construction
+      if (foundEndLine && (!versionOnly || isVersion)) {
+        std::string_view text(buffer.data() + objectBegin,
+                              (lastLine.data() + lastLine.size()) - (buffer.data() + objectBegin));
+        jobs.push_back(IdfLoadJob{text, *iddObject, false, progressValues.size()});
+      }
 
-        // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())){
-            foundEndLine = true;
-        }
+      if (versionOnly && isVersion) {
+        // Increment objectNum to avoid triggering the warning below and return false
+        ++objectNum;
+        break;
       }
 
-      // construct the object
-      if (foundEndLine && (!versionOnly || isVersion)) {
-        OptionalIdfObject object = IdfObject::load(text,*iddObject);
-        if (!object) {
-          LOG(Error,"Unable to construct IdfObject from text: " << std::endl << text
-              << std::endl << "Throwing this object out and parsing the remainder of the file.");
-          continue;
-        } else {
-          // a valid Idf object to parse
-          if (object->iddObject().type() != IddObjectType::Catchall) {
-            ++objectNum;
-          }
+    }
+  }
 
-          // put it in the object list
-          addObject(*object);
+  // second pass: construct the objects. with more than one thread, contiguous chunks of jobs are
+  // handed out to workers, and each chunk is added as soon as it (and every chunk before it) is
+  // done, so that object order and progress reporting are the same as in the serial case.
+  if (numThreads == 0) {
+    numThreads = System::numberOfProcessors();
+  }
+  const std::size_t chunkSize = 256;
+  std::size_t numChunks = (jobs.size() + chunkSize - 1) / chunkSize;
+  numThreads = static_cast<unsigned>(std::min<std::size_t>(numThreads, numChunks));
+
+  std::vector<std::shared_ptr<detail::IdfObject_Impl> > objects(jobs.size());
+  std::vector<std::promise<void> > chunksDone;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> nextChunk(0);
+  if (numThreads > 1) {
+    chunksDone.resize(numChunks);
+    for (unsigned i = 0; i < numThreads; ++i) {
+      workers.emplace_back([&]() {
+        detail::IdfObjectTokens tokens;
+        std::size_t chunk;
+        while ((chunk = nextChunk++) < numChunks) {
+          try {
+            for (std::size_t j = chunk * chunkSize, n = std::min(jobs.size(), j + chunkSize); j < n; ++j) {
+              objects[j] = buildObject(jobs[j], tokens);
+            }
+            chunksDone[chunk].set_value();
+          }
+          catch (...) {
+            chunksDone[chunk].set_exception(std::current_exception());
+          }
         }
+      });
+    }
+  }
+
+  // stops the workers if anything goes wrong while adding objects
+  auto joinWorkers = [&]() {
+    nextChunk = numChunks;
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  };
 
+  detail::IdfObjectTokens tokens;
+  std::size_t progressIndex = 0;
+  try {
+    for (std::size_t i = 0, n = jobs.size(); i < n; ++i) {
+
+      if (workers.empty()) {
+        objects[i] = buildObject(jobs[i], tokens);
+      }
+      else if (i % chunkSize == 0) {
+        chunksDone[i / chunkSize].get_future().get();
       }
 
-      if (versionOnly && isVersion) {
-        // Increment objectNum to avoid triggering the warning below and return false
+      if (progressBar) {
+        for (; progressIndex < jobs[i].progressEnd; ++progressIndex) {
+          progressBar->setValue(progressValues[progressIndex]);
+        }
+      }
+
+      const std::shared_ptr<detail::IdfObject_Impl>& object = objects[i];
+      if (jobs[i].commentOnly) {
+        OS_ASSERT(object);
+      }
+      else if (!object) {
+        LOG(Error,"Unable to construct IdfObject from text: " << std::endl << jobs[i].text
+            << std::endl << "Throwing this object out and parsing the remainder of the file.");
+        continue;
+      }
+      else if (object->iddObject().type() != IddObjectType::Catchall) {
+        // a valid Idf object to parse
         ++objectNum;
-        break;
       }
 
+      // put it in the object list
+      addObject(object->getObject<IdfObject>());
+    }
+  }
+  catch (...) {
+    joinWorkers();
+    throw;
+  }
+  joinWorkers();
+
+  if (progressBar) {
+    for (; progressIndex < progressValues.size(); ++progressIndex) {
+      progressBar->setValue(progressValues[progressIndex]);
     }
   }
 
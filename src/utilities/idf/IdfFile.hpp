@@ -174,33 +174,41 @@ class UTILITIES_API IdfFile {
   //@{
 
   /** Load an IdfFile from std::istream using the IDD defined by IddFactory and iddFileType, if
-   *  possible. */
+   *  possible. If numThreads is greater than one, the IdfObjects are constructed on that many
+   *  threads (0 uses one thread per processor). Objects, handles and progressBar updates are the
+   *  same as for a serial load, but messages logged while constructing objects may come from the
+   *  worker threads. */
   static boost::optional<IdfFile> load(std::istream& is,
                                        const IddFileType& iddFileType,
-                                       ProgressBar* progressBar=nullptr);
+                                       ProgressBar* progressBar=nullptr,
+                                       unsigned numThreads=1);
 
-  /** Load an IdfFile from std::istream using iddFile, if possible. */
+  /** Load an IdfFile from std::istream using iddFile, if possible. See above for numThreads. */
   static boost::optional<IdfFile> load(std::istream& is,
                                        const IddFile& iddFile,
-                                       ProgressBar* progressBar=nullptr);
+                                       ProgressBar* progressBar=nullptr,
+                                       unsigned numThreads=1);
 
   /** Load an IdfFile from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
   static boost::optional<IdfFile> load(const path& p,
-                                       ProgressBar* progressBar=nullptr);
+                                       ProgressBar* progressBar=nullptr,
+                                       unsigned numThreads=1);
 
   /** Load an IdfFile from path using the IddFactory and iddFileType, if possible. Will attempt to
    *  complete the path by tacking on .osm or .idf as appropriate. */
   static boost::optional<IdfFile> load(const path& p,
                                        const IddFileType& iddFileType,
-                                       ProgressBar* progressBar=nullptr);
+                                       ProgressBar* progressBar=nullptr,
+                                       unsigned numThreads=1);
 
   /** Load an IdfFile from path using iddFile, if possible. If no file extension is provided, will
    *  try "idf". */
   static boost::optional<IdfFile> load(const path& p,
                                        const IddFile& iddFile,
-                                       ProgressBar* progressBar=nullptr);
+                                       ProgressBar* progressBar=nullptr,
+                                       unsigned numThreads=1);
 
   /** Quick load method that uses the IddFile::catchallIddFile and stops parsing once a version
    *  identifier is found. Used to determine the appropriate IddFile to use for a full load. */
@@ -216,8 +224,10 @@ class UTILITIES_API IdfFile {
   /** Save this file to path p. Will construct the parent folder if necessary and if its parent
    *  folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use modelFileExtension() for files using IddFileType::OpenStudio,
-   *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
-  bool save(const openstudio::path& p, bool overwrite=false);
+   *  and 'idf' otherwise. If atomic==true, the text is written to a uniquely named temporary file
+   *  beside p that then replaces p, so a failed save leaves any existing file untouched. Returns
+   *  true if the save operation is successful; false otherwise. */
+  bool save(const openstudio::path& p, bool overwrite=false, bool atomic=false);
 
   //@}
 
@@ -226,6 +236,16 @@ class UTILITIES_API IdfFile {
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
+  /** Returns p with the file extension save uses for iddFileAndFactoryWrapper's IddFileType, or
+   *  an empty path if overwrite is false and that file already exists. */
+  static openstudio::path savePath(const openstudio::path& p,
+                                   const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                                   bool overwrite);
+
+  /** Writes text to p, constructing the parent folder if necessary. If atomic==true, the text
+   *  goes to a uniquely named temporary file beside p that then replaces p. */
+  static bool writeFile(const openstudio::path& p, const std::string& text, bool atomic);
  private:
 
   std::string m_header;
@@ -245,7 +265,7 @@ class UTILITIES_API IdfFile {
   // SERIALIZATION
 
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
-  bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
+  bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false, unsigned numThreads=1);
 
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
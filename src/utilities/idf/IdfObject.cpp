@@ -32,6 +32,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
@@ -51,7 +52,6 @@
 
 #include <boost/lexical_cast.hpp>
 
-#include <iomanip>
 
 using std::cout;
 using std::endl;
@@ -65,8 +65,8 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()),
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()),
-      m_fieldComments(other.fieldComments())
+      m_fields(other.m_fields),
+      m_fieldComments(other.m_fieldComments)
   {
     if (keepHandle){
       OS_ASSERT(!other.handle().isNull());
@@ -132,8 +132,8 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const Handle& handle,
                                  const std::string& comment,
                                  const IddObject& iddObject,
-                                 const StringVector& fields,
-                                 const StringVector& fieldComments)
+                                 const IdfFieldStore& fields,
+                                 const IdfFieldStore& fieldComments)
     : m_handle(handle),
       m_comment(comment),
       m_iddObject(iddObject),
@@ -166,7 +166,7 @@ namespace detail {
 
     std::string result;
     if (index < m_fieldComments.size()) {
-      result = m_fieldComments[index];
+      result = std::string(m_fieldComments[index]);
     }
 
     if (returnDefault && result.empty()) {
@@ -201,10 +201,10 @@ namespace detail {
             return boost::none;
           }
         }
-        return decodeString(m_fields[index]);
+        return decodeString(std::string(m_fields[index]));
       }
       else if (validIndex) {
-        return decodeString(m_fields[index]);
+        return decodeString(std::string(m_fields[index]));
       }
     }
     return boost::none;
@@ -245,7 +245,7 @@ namespace detail {
   {
     OptionalString result;
     if (index < m_fields.size()) {
-      result = m_fields[index];
+      result = std::string(m_fields[index]);
     }
     if (returnDefault && ((result && result->empty()) || (!result))) {
       OptionalIddField iddField = m_iddObject.getField(index);
@@ -381,9 +381,10 @@ namespace detail {
         m_fieldComments.resize(index+1);
       }
 
-      m_fieldComments[index] = makeComment(cmnt);
+      m_fieldComments.set(index, makeComment(cmnt));
 
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
+      std::string value(m_fields[index]);
+      m_diffs.push_back(IdfObjectDiff(index, value, value));
 
       return true;
     }
@@ -441,19 +442,21 @@ namespace detail {
       OS_ASSERT(i < 2u);
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
-        m_fields.push_back(toString(m_handle));
-        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back()));
+        std::string handle = toString(m_handle);
+        m_fields.push_back(handle);
+        m_diffs.push_back(IdfObjectDiff(0u,boost::none,handle));
       }
       n = numFields();
       if (i < n) {
-        std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        std::string oldName(m_fields[i]);
+        m_fields.set(i, newName);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       }
       else {
         m_fields.push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
       }
+      this->nameFieldChanged();
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
       return newName; // success!
@@ -514,7 +517,7 @@ namespace detail {
         }
       }
       else {
-        oldValue = m_fields[index];
+        oldValue = std::string(m_fields[index]);
       }
 
       if (!result) {
@@ -532,7 +535,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.set(index, value);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -1270,50 +1273,120 @@ namespace detail {
     return result;
   }
 
-  std::ostream& IdfObject_Impl::print(std::ostream& os) const {
-    unsigned n = numFields();
-    if (n == 0) {
-      printName(os,false);
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const IdfObjectTokens& tokens,
+                                                       const IddObject& iddObject)
+  {
+    // parse straight into the result, there is no text to keep around
+    std::shared_ptr<IdfObject_Impl> result(new IdfObject_Impl(iddObject,false,true));
+
+    try {
+      result->parse(tokens);
+      result->resizeToMinFields();
+    }
+    catch (...) { return std::shared_ptr<IdfObject_Impl>(); }
+
+    if (result->m_iddObject.hasHandleField()) {
+      OS_ASSERT(!result->m_handle.isNull());
     }
     else {
-      printName(os,true);
+      result->m_handle = openstudio::createUUID();
     }
+    return result;
+  }
 
-    for (unsigned i = 0; i < n; ++i) {
-      if (i < n-1) {
-        printField(os,i);
-      }
-      else {
-        printField(os,i,true);
+  namespace {
+
+    std::string_view trimWhitespace(std::string_view text) {
+      const char* whitespace = " \t\n\v\f\r";
+      std::size_t begin = text.find_first_not_of(whitespace);
+      if (begin == std::string_view::npos) {
+        return std::string_view();
       }
+      return text.substr(begin, text.find_last_not_of(whitespace) - begin + 1);
     }
 
-    os << std::endl;
+    // splits a printed comment into the lines IdfTokenizer would read back. returns false if some
+    // line is not a comment, or is blank and so would end the comment block.
+    bool commentLines(std::string_view comment, bool keepFirst, std::vector<std::string_view>& lines) {
+      std::size_t pos = 0;
+      while (pos < comment.size()) {
+        std::size_t end = comment.find('\n', pos);
+        if (end == std::string_view::npos) {
+          end = comment.size();
+        }
+        std::string_view line = comment.substr(pos, end - pos);
+        std::size_t begin = line.find_first_not_of(" \t\v\f\r");
+        if ((begin == std::string_view::npos) || (line[begin] != '!')) {
+          return false;
+        }
+        line = line.substr(begin);
+        if ((line.size() > 1) || (keepFirst && lines.empty())) {
+          lines.push_back(line);
+        }
+        pos = end + 1;
+      }
+      return true;
+    }
 
-    return os;
   }
 
-  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
-    // print comment, if any
-    if (!m_comment.empty()){
-      os << m_comment << std::endl;
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const IdfObject_Impl& other,
+                                                       const IddObject& iddObject)
+  {
+    // build the tokens IdfTokenizer would find in other's printed text
+    IdfObjectTokens tokens;
+    std::string objectType = other.m_iddObject.name();
+    tokens.objectType = objectType;
+
+    bool commentOnly = boost::iequals(objectType, iddRegex::commentOnlyObjectName());
+    if (commentOnly) {
+      // a comment only object is printed as just its comment
+      std::string_view comment = trimWhitespace(other.m_comment);
+      if (comment.empty() || !commentLines(comment, true, tokens.comments)) {
+        return std::shared_ptr<IdfObject_Impl>();
+      }
+      return load(tokens, iddObject);
     }
 
-    // if this is a comment only object, return
-    // todo, tighten up handling of comments with comment only object type
-    if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName()) ){
-      return os;
+    if (!commentLines(other.m_comment, false, tokens.comments)) {
+      return std::shared_ptr<IdfObject_Impl>();
     }
 
-    os << m_iddObject.name();
+    // vertices are printed several to a line, with only the default comment
+    bool vertices = (other.m_iddObject.properties().format == "vertices");
+    for (unsigned i = 0, n = other.m_fields.size(); i < n; ++i) {
+      std::string_view value = trimWhitespace(other.m_fields[i]);
+      if (value.find_first_of(",;!\n\r") != std::string_view::npos) {
+        return std::shared_ptr<IdfObject_Impl>();
+      }
+      tokens.fields.push_back(value);
 
-    if (hasFields) {
-      os << "," << std::endl;
-    }
-    else {
-      os << ";" << std::endl;
+      std::string_view fieldComment;
+      if ((i < other.m_fieldComments.size()) && !(vertices && other.m_iddObject.isExtensibleField(i))) {
+        fieldComment = trimWhitespace(other.m_fieldComments[i]);
+        if (!fieldComment.empty() &&
+            ((fieldComment[0] != '!') || (fieldComment.find('\n') != std::string_view::npos)))
+        {
+          return std::shared_ptr<IdfObject_Impl>();
+        }
+      }
+      tokens.fieldComments.push_back(fieldComment);
     }
 
+    return load(tokens, iddObject);
+  }
+
+  std::ostream& IdfObject_Impl::print(std::ostream& os) const {
+    std::string text;
+    appendText(text);
+    os << text;
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+    std::string text;
+    appendName(text,hasFields);
+    os << text;
     return os;
   }
 
@@ -1321,61 +1394,110 @@ namespace detail {
                                            unsigned index,
                                            bool isLastField) const
   {
+    // vertex comments are aligned over all the fields of a group, which may be printed one call at a time
+    static int textWidth(0);
     if (index < numFields()) {
-      // different formatting for vertices
-      if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
-        ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        static int textWidth(0);
-        if (eIndex.field == 0) {
-          os << "  ";
-          textWidth = 0;
-        }
-        else {
-          os << " ";
-        }
-        // field value
-        os << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        }
-        else {
-          os << ",";
-        }
-        textWidth += m_fields[index].size();
-        // comment
-        if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
-          int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
-          if (numSpaces > 0) {
-            os << std::setw(numSpaces) << " ";
-          }
-          os << " !- X,Y,Z Vertex " << eIndex.group + 1;
-          IddField iddField = m_iddObject.getField(index).get();
-          if (OptionalString units = iddField.properties().units) {
-            os << " {" << *units << "}";
-          }
-          os << std::endl;
-        }
+      std::string text;
+      appendField(text,index,m_fields[index],isLastField,textWidth);
+      os << text;
+    }
+    return os;
+  }
+
+  void IdfObject_Impl::appendText(std::string& text) const {
+    unsigned n = numFields();
+    appendName(text,n > 0);
+    int textWidth(0);
+    for (unsigned i = 0; i < n; ++i) {
+      appendField(text,i,m_fields[i],i == n-1,textWidth);
+    }
+    text += '\n';
+  }
+
+  void IdfObject_Impl::appendText(
+      std::string& text,
+      const std::function<std::string_view (unsigned, std::string&)>& fieldValue) const
+  {
+    unsigned n = numFields();
+    appendName(text,n > 0);
+    int textWidth(0);
+    std::string scratch;
+    for (unsigned i = 0; i < n; ++i) {
+      appendField(text,i,fieldValue(i,scratch),i == n-1,textWidth);
+    }
+    text += '\n';
+  }
+
+  void IdfObject_Impl::appendName(std::string& text, bool hasFields) const {
+    // print comment, if any
+    if (!m_comment.empty()){
+      text += m_comment;
+      text += '\n';
+    }
+
+    // if this is a comment only object, return
+    // todo, tighten up handling of comments with comment only object type
+    if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName()) ){
+      return;
+    }
+
+    text += m_iddObject.name();
+    text += (hasFields ? ",\n" : ";\n");
+  }
+
+  void IdfObject_Impl::appendField(std::string& text,
+                                   unsigned index,
+                                   std::string_view value,
+                                   bool isLastField,
+                                   int& textWidth) const
+  {
+    // different formatting for vertices
+    if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
+      ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
+      if (eIndex.field == 0) {
+        text += "  ";
+        textWidth = 0;
       }
       else {
-        // field value
-        os << "  " << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        }
-        else {
-          os << ",";
-        }
-        // field comment
-        int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
+        text += ' ';
+      }
+      // field value and delimiter
+      text += value;
+      text += (isLastField ? ';' : ',');
+      textWidth += value.size();
+      // comment
+      if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+        int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
         if (numSpaces > 0) {
-          os << std::setw(numSpaces) << " ";
+          text.append(numSpaces,' ');
         }
-        os << " " << fieldComment(index,true) << std::endl;
+        text += " !- X,Y,Z Vertex ";
+        text += std::to_string(eIndex.group + 1);
+        IddField iddField = m_iddObject.getField(index).get();
+        if (OptionalString units = iddField.properties().units) {
+          text += " {";
+          text += *units;
+          text += '}';
+        }
+        text += '\n';
       }
-    } // if index < numFields()
-    return os;
+    }
+    else {
+      // field value and delimiter
+      text += "  ";
+      text += value;
+      text += (isLastField ? ';' : ',');
+      // field comment
+      int numSpaces = IdfObject::printedFieldSpace() - int(value.size());
+      if (numSpaces > 0) {
+        text.append(numSpaces,' ');
+      }
+      text += ' ';
+      if (OptionalString comment = fieldComment(index,true)) {
+        text += *comment;
+      }
+      text += '\n';
+    }
   }
 
   void IdfObject_Impl::emitChangeSignals()
@@ -1581,7 +1703,7 @@ namespace detail {
                                   commentRegex::editorCommentWhitespaceOnlyLine()))
           {
             m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
+            m_fieldComments.set(m_fields.size() - 1, commentOrOtherText);
           }
         }
 
@@ -1615,6 +1737,70 @@ namespace detail {
 
   }
 
+  void IdfObject_Impl::parse(const IdfObjectTokens& tokens)
+  {
+    std::string objectType(tokens.objectType);
+    if (!boost::iequals(objectType, m_iddObject.name())){
+      if (m_iddObject.type() != IddObjectType::Catchall) {
+        LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '"
+            << m_iddObject.name() << "'. Reverting to default Catchall IddObject.");
+      }
+      m_iddObject = IddObject();
+      m_fields.push_back(objectType);
+    }
+
+    for (const std::string_view& comment : tokens.comments) {
+      m_comment.append(comment);
+      m_comment += idfRegex::newLinestring();
+    }
+
+    // remove trailing whitespace and new lines
+    boost::trim_right(m_comment);
+
+    // parse the fields
+    std::size_t numChars = 0;
+    for (const std::string_view& fieldText : tokens.fields) {
+      numChars += fieldText.size();
+    }
+    m_fields.reserve(m_fields.size() + tokens.fields.size(), numChars);
+    for (unsigned iddFieldIndex = 0, n = tokens.fields.size(); iddFieldIndex < n; ++iddFieldIndex) {
+      const std::string_view& fieldText = tokens.fields[iddFieldIndex];
+
+      // get the idd field
+      OptionalIddField iddField = m_iddObject.getField(iddFieldIndex);
+      if (!iddField) {
+        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " <<
+          "cannot have field index of " << iddFieldIndex << ". " <<
+          "Cutting off IdfObject field parsing here, dropping field '" << fieldText << "' and the " <<
+          n - iddFieldIndex - 1 << " fields after it.");
+        return;
+      }
+
+      // add this to our fields
+      m_fields.push_back(fieldText);
+
+      // drop default comments
+      const std::string_view& fieldComment = tokens.fieldComments[iddFieldIndex];
+      if (!fieldComment.empty() && (fieldComment.compare(0, 2, "!-") != 0)) {
+        m_fieldComments.resize(m_fields.size());
+        m_fieldComments.set(m_fields.size() - 1, fieldComment);
+      }
+
+      // keep handle if this is a handle field
+      if (iddField->properties().type == IddFieldType::HandleType) {
+        Handle candidate = toUUID(std::string(m_fields.back()));
+        if (!candidate.isNull()) {
+          m_handle = candidate;
+        }
+      }
+    }
+
+    if (!tokens.unparsedText.empty()) {
+      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: "
+        << std::endl << tokens.unparsedText);
+    }
+  }
+
   // GETTER AND SETTER HELPERS
 
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject)
@@ -1773,25 +1959,26 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
     IddField iddField = *oIddField;
     IddFieldType fieldType = iddField.properties().type;
     OS_ASSERT(m_fields.size() > index);
+    std::string field(m_fields[index]);
 
-    if ((fieldType == IddFieldType::IntegerType) && (!m_fields[index].empty())) {
+    if ((fieldType == IddFieldType::IntegerType) && (!field.empty())) {
       OptionalInt value = getInt(index);
       if (!value) {
         // ok if autosize or autocalculate
-        if (iddField.properties().autosizable && istringEqual(m_fields[index],"autosize")) {
+        if (iddField.properties().autosizable && istringEqual(field,"autosize")) {
         }
         else if (iddField.properties().autocalculatable &&
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(field,"autocalculate"))
         {
         }
         else if (iddField.properties().autosizable &&
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(field,"autocalculate"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type "
               << m_iddObject.name() << " has 'autocalculate' as its value even though it is autosizable.");
         }
         else if (iddField.properties().autocalculatable &&
-                 istringEqual(m_fields[index],"autosize"))
+                 istringEqual(field,"autosize"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type "
               << m_iddObject.name() << " has 'autosize' as its value even though it is autocalculable.");
@@ -1804,24 +1991,24 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
       }
     }
 
-    if ((fieldType == IddFieldType::RealType) && (!m_fields[index].empty())) {
+    if ((fieldType == IddFieldType::RealType) && (!field.empty())) {
       OptionalDouble value = getDouble(index);
       if (!value) {
         // ok if autosize or autocalculate
-        if (iddField.properties().autosizable && istringEqual(m_fields[index],"autosize")) {
+        if (iddField.properties().autosizable && istringEqual(field,"autosize")) {
         }
         else if (iddField.properties().autocalculatable &&
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(field,"autocalculate"))
         {
         }
         else if (iddField.properties().autosizable &&
-                 istringEqual(m_fields[index],"autocalculate"))
+                 istringEqual(field,"autocalculate"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type "
               << m_iddObject.name() << " has 'autocalculate' as its value even though it is autosizable.");
         }
         else if (iddField.properties().autocalculatable &&
-                 istringEqual(m_fields[index],"autosize"))
+                 istringEqual(field,"autosize"))
         {
           LOG(Info, "Field " << index << ", '" << iddField.name() << "', of an object of type "
               << m_iddObject.name() << " has 'autosize' as its value even though it is autocalculable.");
@@ -1842,10 +2029,10 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
       }
     }
 
-    if ((fieldType == IddFieldType::ChoiceType) && (!m_fields[index].empty())) {
+    if ((fieldType == IddFieldType::ChoiceType) && (!field.empty())) {
       // value should iequal one of the keys
       IddKeyVector keys = iddField.keys();
-      NameFinder<IddKey> finder(m_fields[index]);
+      NameFinder<IddKey> finder(field);
       IddKeyVector::const_iterator loc = std::find_if(keys.begin(),keys.end(),finder);
       if (loc == keys.end()) {
         return false;
@@ -1894,6 +2081,8 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
     return true;
   }
 
+  void IdfObject_Impl::nameFieldChanged() {}
+
   bool IdfObject_Impl::withinBounds(double fieldValue,const IddField& iddField) const {
 
     // minimum bounds
@@ -1997,12 +2186,12 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    return m_fields.strings();
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
   {
-    return m_fieldComments;
+    return m_fieldComments.strings();
   }
 
   std::string IdfObject_Impl::encodeString(const std::string& value) const
@@ -2351,6 +2540,12 @@ OptionalIdfObject IdfObject::load(const std::string& text,const IddObject& iddOb
   return boost::none;
 }
 
+OptionalIdfObject IdfObject::load(const IdfObject& other,const IddObject& iddObject) {
+  std::shared_ptr<detail::IdfObject_Impl> p = detail::IdfObject_Impl::load(*other.m_impl,iddObject);
+  if (p) { return IdfObject(p); }
+  return boost::none;
+}
+
 int IdfObject::printedFieldSpace() {
   return 38;
 }
@@ -351,6 +351,12 @@ class UTILITIES_API IdfObject {
   /** Constructor from text and an explicit iddObject. */
   static boost::optional<IdfObject> load(const std::string& text,const IddObject& iddObject);
 
+  /** Constructor from another object and an explicit iddObject. Produces the same object as
+   *  loading the printed text of other with iddObject, without the text. Returns none if other
+   *  cannot be carried over that way (e.g. a field value contains a ','), in which case the text
+   *  should be used instead. */
+  static boost::optional<IdfObject> load(const IdfObject& other,const IddObject& iddObject);
+
   /** Returns the width, in characters, of the default amount of space given to field data
    *  during printing. */
   static int printedFieldSpace();
@@ -33,6 +33,7 @@
 #include <utilities/UtilitiesAPI.hpp>
 #include <utilities/idf/Handle.hpp>
 #include <utilities/idf/IdfObjectDiff.hpp>
+#include <utilities/idf/IdfFieldStore.hpp>
 #include <utilities/idd/IddObject.hpp>
 
 #include <utilities/core/Logger.hpp>
@@ -41,7 +42,9 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -60,6 +63,8 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail {
 
+  struct IdfObjectTokens;
+
   /** Implementation of IdfObject. */
   class UTILITIES_API IdfObject_Impl : public std::enable_shared_from_this<IdfObject_Impl>,
                                        public Nano::Observer {
@@ -81,8 +86,8 @@ namespace detail {
     IdfObject_Impl(const Handle& handle,
                    const std::string& comment,
                    const IddObject& iddObject,
-                   const StringVector& fields,
-                   const StringVector& fieldComments);
+                   const IdfFieldStore& fields,
+                   const IdfFieldStore& fieldComments);
 
     virtual ~IdfObject_Impl() {}
 
@@ -336,6 +341,16 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text,const IddObject& iddObject);
 
+    /** Constructor from the tokens found by IdfTokenizer and an explicit iddObject. Equivalent
+     *  to load(text,iddObject) on the tokenized text, but without any regex parsing. */
+    static std::shared_ptr<IdfObject_Impl> load(const IdfObjectTokens& tokens,const IddObject& iddObject);
+
+    /** Constructor from another object and an explicit iddObject. Equivalent to load(text,iddObject)
+     *  on the printed text of other, but without printing. Returns a null pointer if other's data
+     *  would not survive being printed and read back (e.g. a field value contains a ',' or a
+     *  multi-line field comment), in which case the caller should go through the text. */
+    static std::shared_ptr<IdfObject_Impl> load(const IdfObject_Impl& other,const IddObject& iddObject);
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -348,6 +363,10 @@ namespace detail {
      *  field value is followed by a ','. Otherwise, the object is ended by using a ';'. */
     std::ostream& printField(std::ostream& os, unsigned index, bool isLastField=false) const;
 
+    /** Append the Idf text that print would write to text. Lets callers serializing many objects
+     *  reuse one buffer rather than going through a stream. */
+    void appendText(std::string& text) const;
+
     //@}
     /** @name Type Casting */
     //@{
@@ -397,8 +416,8 @@ namespace detail {
     IddObject m_iddObject;
 
     // idf fields
-    std::vector<std::string> m_fields;
-    std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
+    IdfFieldStore m_fields;
+    IdfFieldStore m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
@@ -424,6 +443,18 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SERIALIZATION HELPERS
+
+    /** Append the Idf text of this object to text, writing fieldValue(index,scratch) in place of
+     *  each field value. fieldValue returns a view of either the stored value or scratch. */
+    void appendText(std::string& text,
+                    const std::function<std::string_view (unsigned, std::string&)>& fieldValue) const;
+
+    // SETTER HELPERS
+
+    /** Called whenever setName changes the name field. Does nothing in Idf mode. */
+    virtual void nameFieldChanged();
+
    private:
 
     IdfObject_Impl(){}
@@ -437,6 +468,17 @@ namespace detail {
     // IdfObject satisfies Strictness::None.
     void resizeToMinFields();
 
+    // SERIALIZATION HELPERS
+
+    void appendName(std::string& text, bool hasFields) const;
+
+    // textWidth carries the width of the vertex group printed so far, so the comment lines up.
+    void appendField(std::string& text,
+                     unsigned index,
+                     std::string_view value,
+                     bool isLastField,
+                     int& textWidth) const;
+
     /* Parse IdfObject text. If getIddFromFactory, will first search for the IddObject using the
      * IddFactory, otherwise, assumes that m_iddObject was provided and is correct. (Will log
      * warning if the names do not match.) */
@@ -445,6 +487,9 @@ namespace detail {
     // parse fields
     void parseFields(const std::string& text);
 
+    /* Equivalent of parse(text,false) for text already split up by IdfTokenizer. */
+    void parse(const IdfObjectTokens& tokens);
+
     // GETTER AND SETTER HELPERS
 
     /** Set this object's IddObject to iddObject. */
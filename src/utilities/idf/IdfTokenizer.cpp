@@ -0,0 +1,268 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include "../idd/IddRegex.hpp"
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    const std::size_t npos = std::string_view::npos;
+
+    // same character set as std::isspace in the classic locale, used by boost::trim
+    inline bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    std::size_t skipSpace(std::string_view text, std::size_t pos) {
+      while ((pos < text.size()) && isSpace(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    std::string_view trim(std::string_view text) {
+      std::size_t begin = skipSpace(text, 0);
+      std::size_t end = text.size();
+      while ((end > begin) && isSpace(text[end - 1])) {
+        --end;
+      }
+      return text.substr(begin, end - begin);
+    }
+
+    // returns the offset of the '\n' ending the line that contains pos, or text.size()
+    std::size_t lineEnd(std::string_view text, std::size_t pos) {
+      std::size_t result = text.find('\n', pos);
+      return (result == npos) ? text.size() : result;
+    }
+
+    // reads consecutive comment lines starting at pos, appending all non-empty comments, and
+    // returns the offset of the first character that is not part of a comment line
+    std::size_t readComments(std::string_view text, std::size_t pos, std::vector<std::string_view>& comments) {
+      while (true) {
+        std::size_t begin = skipSpace(text, pos);
+        if ((begin == text.size()) || (text[begin] != '!')) {
+          return pos;
+        }
+        std::size_t end = lineEnd(text, begin);
+        if (end - begin > 1) {
+          comments.push_back(text.substr(begin, end - begin));
+        }
+        pos = (end == text.size()) ? end : end + 1;
+      }
+    }
+
+    // finds the next ',' or ';' at or after pos, skipping to the next line whenever a '!' comes
+    // first. on success, sets fieldBegin to the start of the line the separator was found on
+    // (or pos) and returns the separator's offset. returns npos if there is none.
+    std::size_t findSeparator(std::string_view text, std::size_t pos, std::size_t& fieldBegin) {
+      fieldBegin = pos;
+      while (true) {
+        std::size_t result = text.find_first_of(",;!", fieldBegin);
+        if ((result == npos) || (text[result] != '!')) {
+          return result;
+        }
+        std::size_t end = text.find('\n', result);
+        if (end == npos) {
+          return npos;
+        }
+        fieldBegin = end + 1;
+      }
+    }
+
+  }
+
+  void IdfObjectTokens::clear() {
+    objectType = std::string_view();
+    comments.clear();
+    fields.clear();
+    fieldComments.clear();
+    unparsedText = std::string_view();
+  }
+
+  IdfTokenizer::IdfTokenizer(std::string_view text)
+    : m_text(text), m_pos(0)
+  {}
+
+  bool IdfTokenizer::nextLine(std::string_view& line) {
+    if (m_pos >= m_text.size()) {
+      return false;
+    }
+    std::size_t end = lineEnd(m_text, m_pos);
+    line = m_text.substr(m_pos, end - m_pos);
+    m_pos = (end == m_text.size()) ? end : end + 1;
+    return true;
+  }
+
+  std::size_t IdfTokenizer::position() const {
+    return m_pos;
+  }
+
+  bool IdfTokenizer::readObject(std::string_view firstLine, std::string_view& lastLine) {
+    lastLine = firstLine;
+    if (isObjectEnd(lastLine)) {
+      return true;
+    }
+    while (nextLine(lastLine)) {
+      if (isObjectEnd(lastLine)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  IdfTokenizer::LineType IdfTokenizer::lineType(std::string_view line) {
+    std::size_t pos = skipSpace(line, 0);
+    if ((pos < line.size()) && (line[pos] == '!')) {
+      return CommentLine;
+    }
+    if (line.find_first_not_of(" \t") == npos) {
+      return WhitespaceLine;
+    }
+    return ContentLine;
+  }
+
+  bool IdfTokenizer::objectType(std::string_view line, std::string_view& objectType) {
+    std::size_t pos = line.find_first_of(",;!");
+    if ((pos == npos) || (line[pos] == '!')) {
+      return false;
+    }
+    objectType = trim(line.substr(0, pos));
+    return true;
+  }
+
+  bool IdfTokenizer::isObjectEnd(std::string_view line) {
+    std::size_t pos = line.find_first_of(";!");
+    return (pos != npos) && (line[pos] == ';');
+  }
+
+  bool IdfTokenizer::tokenizeObject(std::string_view text, IdfObjectTokens& tokens) {
+    tokens.clear();
+
+    // comment lines before the object type
+    std::size_t pos = readComments(text, 0, tokens.comments);
+
+    // object type
+    std::size_t begin = pos;
+    std::size_t separator = findSeparator(text, pos, begin);
+    if (separator == npos) {
+      return false;
+    }
+    tokens.objectType = trim(text.substr(begin, separator - begin));
+
+    // rest of the object type's line is either a comment, empty, or the first field(s)
+    std::size_t end = lineEnd(text, separator);
+    std::size_t restBegin = skipSpace(text, separator + 1);
+    if (restBegin >= end) {
+      pos = (end == text.size()) ? end : end + 1;
+    }
+    else if (text[restBegin] == '!') {
+      // kept as is, even if empty
+      tokens.comments.push_back(text.substr(restBegin, end - restBegin));
+      pos = (end == text.size()) ? end : end + 1;
+    }
+    else {
+      pos = separator + 1;
+    }
+
+    // comment lines after the object type
+    pos = readComments(text, pos, tokens.comments);
+
+    // fields
+    while (true) {
+      separator = findSeparator(text, pos, begin);
+      if (separator == npos) {
+        break;
+      }
+      tokens.fields.push_back(trim(text.substr(begin, separator - begin)));
+
+      end = lineEnd(text, separator);
+      std::string_view comment = trim(text.substr(separator + 1, end - separator - 1));
+      if (comment.empty() || (comment[0] == '!')) {
+        tokens.fieldComments.push_back(comment);
+        pos = (end == text.size()) ? end : end + 1;
+      }
+      else {
+        // more fields on this line
+        tokens.fieldComments.push_back(std::string_view());
+        pos = separator + 1;
+      }
+    }
+
+    tokens.unparsedText = trim(text.substr(pos));
+    return true;
+  }
+
+  void IdfTokenizer::tokenizeComment(std::string_view text, IdfObjectTokens& tokens) {
+    tokens.clear();
+    tokens.objectType = iddRegex::commentOnlyObjectName();
+
+    // first line is kept as is, even if empty
+    std::size_t pos = skipSpace(text, 0);
+    if (pos < text.size()) {
+      std::size_t end = lineEnd(text, pos);
+      tokens.comments.push_back(text.substr(pos, end - pos));
+      pos = (end == text.size()) ? end : end + 1;
+    }
+    pos = readComments(text, pos, tokens.comments);
+    tokens.unparsedText = trim(text.substr(pos));
+  }
+
+  void IdfTokenizer::readAll(std::istream& is, std::string& buffer) {
+    buffer.clear();
+    char chunk[65536];
+    while (is.read(chunk, sizeof(chunk)) || (is.gcount() > 0)) {
+      buffer.append(chunk, static_cast<std::size_t>(is.gcount()));
+    }
+
+    // convert line endings in place
+    std::size_t in = buffer.find('\r');
+    if (in == std::string::npos) {
+      return;
+    }
+    std::size_t out = in;
+    for (std::size_t n = buffer.size(); in < n; ++in) {
+      if (buffer[in] == '\r') {
+        buffer[out++] = '\n';
+        if ((in + 1 < n) && (buffer[in + 1] == '\n')) {
+          ++in;
+        }
+      }
+      else {
+        buffer[out++] = buffer[in];
+      }
+    }
+    buffer.resize(out);
+  }
+
+} // detail
+} // openstudio
@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** The pieces of a single IDF object, as found by IdfTokenizer. Every view points into the
+   *  text that was tokenized, which must outlive the tokens. */
+  struct UTILITIES_API IdfObjectTokens {
+    /** The object type as it appears in the text, e.g. 'OS:Space'. */
+    std::string_view objectType;
+
+    /** The object comment, one view per line. Each view starts at the line's '!'. */
+    std::vector<std::string_view> comments;
+
+    /** Field values, with surrounding whitespace removed. */
+    std::vector<std::string_view> fields;
+
+    /** Field comments, parallel to fields. Empty if the field's line has no comment. */
+    std::vector<std::string_view> fieldComments;
+
+    /** Any non-whitespace text that follows the last field. */
+    std::string_view unparsedText;
+
+    /** Clears all tokens, keeping allocated storage for reuse. */
+    void clear();
+  };
+
+  /** Single pass, regex-free tokenizer for IDF and OSM text. IdfTokenizer works on a fully
+   *  buffered file and hands out views into that buffer, so no intermediate strings are created
+   *  per line or per field. It reproduces the idfRegex-based parsing of IdfFile and IdfObject,
+   *  including which comments are attached to objects and fields. */
+  class UTILITIES_API IdfTokenizer {
+   public:
+    /** Kind of a single line of text. */
+    enum LineType {
+      CommentLine,    ///< first non-whitespace character is '!'
+      WhitespaceLine, ///< only spaces and tabs
+      ContentLine     ///< anything else
+    };
+
+    /** Tokenizer over text, which must use '\n' line endings (see readAll). */
+    explicit IdfTokenizer(std::string_view text);
+
+    /** Reads the next line, without its '\n'. Returns false at the end of the text. */
+    bool nextLine(std::string_view& line);
+
+    /** Returns the offset of the first character that has not been read yet. */
+    std::size_t position() const;
+
+    /** Having just read firstLine, reads through the end of the object that starts there, that
+     *  is, through the first line with a ';' that is not commented out. Sets lastLine to that
+     *  line and returns true, or returns false if the text ends first. */
+    bool readObject(std::string_view firstLine, std::string_view& lastLine);
+
+    /** Returns the LineType of line. */
+    static LineType lineType(std::string_view line);
+
+    /** Sets objectType to the text before the first ',' or ';' in line, provided no '!' comes
+     *  first, and returns true. Otherwise returns false. */
+    static bool objectType(std::string_view line, std::string_view& objectType);
+
+    /** Returns true if line contains a ';' that is not commented out. */
+    static bool isObjectEnd(std::string_view line);
+
+    /** Tokenizes the text of a single object, starting with any comment lines that precede the
+     *  object type. Returns false if no object type can be found. */
+    static bool tokenizeObject(std::string_view text, IdfObjectTokens& tokens);
+
+    /** Tokenizes a block of comment lines into a CommentOnly object. */
+    static void tokenizeComment(std::string_view text, IdfObjectTokens& tokens);
+
+    /** Reads the remainder of is into buffer, converting "\r\n" and "\r" line endings to '\n'. */
+    static void readAll(std::istream& is, std::string& buffer);
+
+   private:
+    std::string_view m_text;
+    std::size_t m_pos;
+  };
+
+} // detail
+} // openstudio
+
+#endif //UTILITIES_IDF_IDFTOKENIZER_HPP
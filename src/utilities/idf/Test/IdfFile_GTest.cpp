@@ -31,15 +31,23 @@
 #include "IdfFixture.hpp"
 
 #include "../IdfFile.hpp"
+#include "../IdfObject_Impl.hpp"
+#include "../IdfRegex.hpp"
+#include "../IdfTokenizer.hpp"
 #include "../ValidityReport.hpp"
 
+#include "../../idd/CommentRegex.hpp"
+#include "../../idd/IddRegex.hpp"
+#include "../../plot/ProgressBar.hpp"
 #include "../../time/Time.hpp"
 
 #include <resources.hxx>
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/IddFactory.hxx>
 
 
 
+#include <chrono>
 #include <iostream>
 #include <sstream>
 
@@ -47,6 +55,101 @@ using namespace std;
 using namespace boost;
 using namespace openstudio;
 
+namespace {
+
+  // The boost::regex based, line by line parsing that IdfFile::load used before IdfTokenizer.
+  // Kept as a reference to check the tokenizer against, and to time it.
+  IdfObjectVector regexLoad(std::istream& is, IddFileType iddFileType, std::string& header) {
+    IdfObjectVector result;
+    IddFileAndFactoryWrapper iddFile(iddFileType);
+    std::string line;
+    std::string comment;
+    bool firstBlock = true;
+    while (std::getline(is, line)) {
+      if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+        comment += (line + idfRegex::newLinestring());
+      }
+      else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+        boost::trim(comment);
+        if (!comment.empty()) {
+          if (firstBlock) {
+            header = comment;
+            firstBlock = false;
+          }
+          else {
+            OptionalIddObject commentOnlyIddObject = iddFile.getObject(IddObjectType::CommentOnly);
+            result.push_back(IdfObject::load(commentOnlyIddObject->name() + ";" + comment, *commentOnlyIddObject).get());
+          }
+        }
+        comment = "";
+      }
+      else {
+        firstBlock = false;
+        std::string objectType("Catchall");
+        boost::smatch matches;
+        if (boost::regex_search(line, matches, idfRegex::line())) {
+          objectType = std::string(matches[1].first, matches[1].second);
+          boost::trim(objectType);
+        }
+        OptionalIddObject iddObject = iddFile.getObject(objectType);
+        if (!iddObject) {
+          iddObject = IddObject();
+        }
+        std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
+        comment = "";
+        bool foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+        while (!foundEndLine && std::getline(is, line)) {
+          text += (line + idfRegex::newLinestring());
+          foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+        }
+        if (foundEndLine) {
+          if (OptionalIdfObject object = IdfObject::load(text, *iddObject)) {
+            result.push_back(*object);
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  // Records every value set, to compare progress reporting between loads.
+  class RecordingProgressBar : public ProgressBar {
+   public:
+    virtual int minimum() const override { return m_min; }
+    virtual void setMinimum(int min) override { m_min = min; }
+    virtual int maximum() const override { return m_max; }
+    virtual void setMaximum(int max) override { m_max = max; }
+    virtual int value() const override { return values.empty() ? m_min : values.back(); }
+    virtual std::string windowTitle() const override { return std::string(); }
+    virtual void setWindowTitle(const std::string& title) override {}
+    virtual std::string text() const override { return std::string(); }
+    virtual bool isVisible() const override { return false; }
+    virtual void setVisible(bool visible) override {}
+    virtual void setRange(int min, int max) override { m_min = min; m_max = max; }
+    virtual void setValue(int value) override { values.push_back(value); }
+
+    std::vector<int> values;
+
+   private:
+    int m_min = 0;
+    int m_max = 0;
+  };
+
+  void expectSameObjects(const IdfObjectVector& expected, const IdfObjectVector& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (unsigned i = 0, n = expected.size(); i < n; ++i) {
+      EXPECT_EQ(expected[i].iddObject().name(), actual[i].iddObject().name());
+      EXPECT_EQ(expected[i].comment(), actual[i].comment());
+      ASSERT_EQ(expected[i].numFields(), actual[i].numFields()) << "object " << i;
+      for (unsigned j = 0, nf = expected[i].numFields(); j < nf; ++j) {
+        EXPECT_EQ(expected[i].getString(j).get(), actual[i].getString(j).get());
+        EXPECT_EQ(expected[i].fieldComment(j).get(), actual[i].fieldComment(j).get());
+      }
+    }
+  }
+
+}
+
 TEST_F(IdfFixture, IdfFile_BasicTests_FromScratch) {
   IdfFile idfFile(IddFileType::EnergyPlus); // automatically adds version
   EXPECT_TRUE(idfFile.empty());
@@ -160,3 +263,181 @@ TEST_F(IdfFixture, IdfFile_ObjectComments) {
   oFile->print(outFile);
 }
 */
+
+TEST_F(IdfFixture, IdfTokenizer_Object) {
+  std::string text("! object comment\n"
+                   "  Zone,   ! on type line\n"
+                   "  ! after type line\n"
+                   "    Zone One,   !- Name\n"
+                   "    0, 0,       ! user comment\n"
+                   "  ! between fields\n"
+                   "    0,\n"
+                   "    ;           !- Type\n");
+  openstudio::detail::IdfObjectTokens tokens;
+  ASSERT_TRUE(openstudio::detail::IdfTokenizer::tokenizeObject(text, tokens));
+  EXPECT_EQ("Zone", tokens.objectType);
+  ASSERT_EQ(3u, tokens.comments.size());
+  EXPECT_EQ("! object comment", tokens.comments[0]);
+  EXPECT_EQ("! on type line", tokens.comments[1]);
+  EXPECT_EQ("! after type line", tokens.comments[2]);
+  ASSERT_EQ(5u, tokens.fields.size());
+  ASSERT_EQ(5u, tokens.fieldComments.size());
+  EXPECT_EQ("Zone One", tokens.fields[0]);
+  EXPECT_EQ("!- Name", tokens.fieldComments[0]);
+  EXPECT_EQ("0", tokens.fields[1]);
+  EXPECT_TRUE(tokens.fieldComments[1].empty());
+  EXPECT_EQ("0", tokens.fields[2]);
+  EXPECT_EQ("! user comment", tokens.fieldComments[2]);
+  EXPECT_EQ("0", tokens.fields[3]);
+  EXPECT_EQ("", tokens.fields[4]);
+  EXPECT_TRUE(tokens.unparsedText.empty());
+
+  // same object as the regex-based IdfObject::load
+  OptionalIdfObject expected = IdfObject::load(text);
+  ASSERT_TRUE(expected);
+  OptionalIddObject iddObject = IddFactory::instance().getObject(IddObjectType::Zone);
+  ASSERT_TRUE(iddObject);
+  std::shared_ptr<openstudio::detail::IdfObject_Impl> actual = openstudio::detail::IdfObject_Impl::load(tokens, *iddObject);
+  ASSERT_TRUE(actual);
+  expectSameObjects(IdfObjectVector(1u, *expected), IdfObjectVector(1u, actual->getObject<IdfObject>()));
+  EXPECT_EQ("! object comment\n! on type line\n! after type line", actual->comment());
+  EXPECT_EQ("! user comment", actual->getObject<IdfObject>().fieldComment(2).get());
+}
+
+TEST_F(IdfFixture, IdfTokenizer_MatchesRegexParsing) {
+  std::string text("! File Header\r\n"
+                   "! Second line\r\n"
+                   "\r\n"
+                   "! Comment only object\n"
+                   "!\n"
+                   "\n"
+                   "  Version,8.9;\n"
+                   "\n"
+                   "! Timestep comment\r"
+                   "  Timestep,4;  ! four per hour\r"
+                   "\r"
+                   "  NotAnIddObject,\n"
+                   "    a, b;\n"
+                   "\n"
+                   "  Building,\n"
+                   "    Building 1, 0, !- Name and North Axis\n"
+                   "    City,\n"
+                   "    0.04,0.4,\n"
+                   "    FullExterior,25,6;\n");
+
+  std::stringstream ss(text);
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ("! File Header\n! Second line", idfFile->header());
+
+  std::string header;
+  std::string normalized = boost::replace_all_copy(boost::replace_all_copy(text, "\r\n", "\n"), "\r", "\n");
+  std::stringstream regexSS(normalized);
+  IdfObjectVector expected = regexLoad(regexSS, IddFileType::EnergyPlus, header);
+  EXPECT_EQ(header, idfFile->header());
+
+  // IdfFile lists the version object last
+  IdfObjectVector actual = idfFile->objects();
+  actual.insert(actual.begin() + 1, idfFile->versionObject().get());
+  expectSameObjects(expected, actual);
+
+  ASSERT_EQ(5u, actual.size());
+  EXPECT_EQ(IddObjectType(IddObjectType::CommentOnly), actual[0].iddObject().type());
+  EXPECT_EQ("! Comment only object", actual[0].comment());
+  EXPECT_EQ("! Timestep comment", actual[2].comment());
+  EXPECT_EQ("! four per hour", actual[2].fieldComment(0).get());
+  EXPECT_EQ(IddObjectType(IddObjectType::Catchall), actual[3].iddObject().type());
+  EXPECT_EQ("NotAnIddObject", actual[3].getString(0).get());
+  EXPECT_EQ("FullExterior", actual[4].getString(5).get());
+  EXPECT_EQ("", actual[4].fieldComment(1).get());
+}
+
+TEST_F(IdfFixture, IdfFile_LoadBenchmark) {
+  std::vector<std::pair<openstudio::path, IddFileType> > files;
+  files.push_back(std::make_pair(resourcesPath()/toPath("energyplus/HospitalBaseline/in.idf"), IddFileType(IddFileType::EnergyPlus)));
+  files.push_back(std::make_pair(resourcesPath()/toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/tests/EnvelopeAndLoadTestModel_01.osm"),
+                                 IddFileType(IddFileType::OpenStudio)));
+
+  for (const auto& file : files) {
+    openstudio::filesystem::ifstream inFile(file.first);
+    ASSERT_TRUE(inFile.is_open());
+    std::stringstream ss;
+    ss << inFile.rdbuf();
+    std::string text = ss.str();
+
+    std::stringstream tokenizerSS(text);
+    auto start = std::chrono::steady_clock::now();
+    OptionalIdfFile idfFile = IdfFile::load(tokenizerSS, file.second);
+    std::chrono::duration<double, std::milli> tokenizerTime = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(idfFile);
+
+    std::string header;
+    std::stringstream regexSS(text);
+    start = std::chrono::steady_clock::now();
+    IdfObjectVector expected = regexLoad(regexSS, file.second, header);
+    std::chrono::duration<double, std::milli> regexTime = std::chrono::steady_clock::now() - start;
+
+    LOG(Info, "Loaded " << toString(file.first.filename()) << " (" << expected.size() << " objects) in "
+        << tokenizerTime.count() << " ms with IdfTokenizer and " << regexTime.count() << " ms with the regex parser.");
+
+    EXPECT_EQ(header, idfFile->header());
+    EXPECT_EQ(expected.size(), idfFile->objects().size() + (idfFile->versionObject() ? 1u : 0u));
+    for (const IdfObject& object : expected) {
+      if (object.iddObject().isVersionObject()) {
+        ASSERT_TRUE(idfFile->versionObject());
+        expectSameObjects(IdfObjectVector(1u, object), IdfObjectVector(1u, *idfFile->versionObject()));
+      }
+    }
+    IdfObjectVector actual = idfFile->objects();
+    expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                  [](const IdfObject& object) { return object.iddObject().isVersionObject(); }),
+                   expected.end());
+    expectSameObjects(expected, actual);
+  }
+}
+
+TEST_F(IdfFixture, IdfFile_ParallelLoad) {
+  std::vector<std::pair<openstudio::path, IddFileType> > files;
+  files.push_back(std::make_pair(resourcesPath()/toPath("energyplus/HospitalBaseline/in.idf"), IddFileType(IddFileType::EnergyPlus)));
+  files.push_back(std::make_pair(resourcesPath()/toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/tests/EnvelopeAndLoadTestModel_01.osm"),
+                                 IddFileType(IddFileType::OpenStudio)));
+
+  for (const auto& file : files) {
+    RecordingProgressBar serialProgress;
+    auto start = std::chrono::steady_clock::now();
+    OptionalIdfFile serial = IdfFile::load(file.first, file.second, &serialProgress);
+    std::chrono::duration<double, std::milli> serialTime = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(serial);
+
+    RecordingProgressBar parallelProgress;
+    start = std::chrono::steady_clock::now();
+    OptionalIdfFile parallel = IdfFile::load(file.first, file.second, &parallelProgress, 4);
+    std::chrono::duration<double, std::milli> parallelTime = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(parallel);
+
+    LOG(Info, "Loaded " << toString(file.first.filename()) << " in " << serialTime.count() << " ms on one thread and "
+        << parallelTime.count() << " ms on four threads.");
+
+    EXPECT_EQ(serial->header(), parallel->header());
+    IdfObjectVector expected = serial->objects();
+    IdfObjectVector actual = parallel->objects();
+    expectSameObjects(expected, actual);
+    if (file.second == IddFileType::OpenStudio) {
+      ASSERT_EQ(expected.size(), actual.size());
+      for (unsigned i = 0, n = expected.size(); i < n; ++i) {
+        EXPECT_EQ(expected[i].handle(), actual[i].handle());
+      }
+    }
+
+    EXPECT_FALSE(serialProgress.values.empty());
+    EXPECT_EQ(serialProgress.maximum(), parallelProgress.maximum());
+    EXPECT_TRUE(serialProgress.values == parallelProgress.values);
+  }
+
+  // a thread count of zero uses every processor
+  std::stringstream ss;
+  epIdfFile.print(ss);
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus, nullptr, 0);
+  ASSERT_TRUE(idfFile);
+  expectSameObjects(epIdfFile.objects(), idfFile->objects());
+}
@@ -31,6 +31,7 @@
 #include "IdfFixture.hpp"
 #include "../IdfObject.hpp"
 #include "../IdfObject_Impl.hpp"
+#include "../IdfFieldStore.hpp"
 #include "../IdfExtensibleGroup.hpp"
 #include "../IdfRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
@@ -51,6 +52,7 @@
 
 #include <sstream>
 #include <limits>
+#include <thread>
 
 using namespace std;
 using namespace boost;
@@ -784,3 +786,173 @@ TEST_F(IdfFixture, IdfObject_SetDouble_NaN_and_Inf) {
   EXPECT_EQ(4u, object2.numExtensibleGroups());
 }
 
+
+TEST_F(IdfFixture, IdfFieldStore) {
+  openstudio::detail::IdfFieldStore store;
+  EXPECT_TRUE(store.empty());
+
+  store.push_back("{12345678-1234-1234-1234-123456789012}");
+  store.push_back("");
+  store.push_back("Office");
+  ASSERT_EQ(3u, store.size());
+  EXPECT_EQ("{12345678-1234-1234-1234-123456789012}", store[0]);
+  EXPECT_EQ("", store[1]);
+  EXPECT_EQ("Office", store.back());
+
+  // growing and shrinking a field in the middle moves the fields after it
+  store.set(1, "Some Longer Value");
+  EXPECT_EQ("Some Longer Value", store[1]);
+  EXPECT_EQ("Office", store[2]);
+  store.set(1, "x");
+  EXPECT_EQ("x", store[1]);
+  EXPECT_EQ("Office", store[2]);
+  EXPECT_EQ("{12345678-1234-1234-1234-123456789012}", store[0]);
+
+  // values may come from the store itself
+  store.set(1, store[2]);
+  EXPECT_EQ("Office", store[1]);
+  store.push_back(store[0]);
+  EXPECT_EQ(store[0], store[3]);
+
+  store.resize(6);
+  ASSERT_EQ(6u, store.size());
+  EXPECT_EQ("", store[4]);
+  EXPECT_EQ("", store[5]);
+  store.set(5, "last");
+  store.pop_back();
+  store.resize(2);
+  std::vector<std::string> expected = {"{12345678-1234-1234-1234-123456789012}", "Office"};
+  EXPECT_EQ(expected, store.strings());
+
+  openstudio::detail::IdfFieldStore copy(expected);
+  EXPECT_EQ(expected, copy.strings());
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+
+  // copies share the text until one of them is modified
+  openstudio::detail::IdfFieldStore shared(store);
+  EXPECT_TRUE(shared.sharesStorageWith(store));
+  std::string_view name = store[1];
+  shared.set(1, "Warehouse");
+  EXPECT_FALSE(shared.sharesStorageWith(store));
+  EXPECT_EQ("Warehouse", shared[1]);
+  EXPECT_EQ("Office", store[1]);
+  EXPECT_EQ("Office", name);
+  shared = store;
+  EXPECT_TRUE(shared.sharesStorageWith(store));
+  store.push_back("appended");
+  EXPECT_EQ(2u, shared.size());
+  EXPECT_EQ(3u, store.size());
+  EXPECT_FALSE(openstudio::detail::IdfFieldStore().sharesStorageWith(openstudio::detail::IdfFieldStore()));
+}
+
+TEST_F(IdfFixture, IdfFieldStore_Threads) {
+  // copies sharing one buffer are each modified on their own thread
+  openstudio::detail::IdfFieldStore store(std::vector<std::string>{"{12345678-1234-1234-1234-123456789012}", "Office"});
+  std::vector<openstudio::detail::IdfFieldStore> copies(8, store);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < copies.size(); ++i) {
+    threads.emplace_back([&copies, i]() {
+      for (unsigned j = 0; j < 1000; ++j) {
+        openstudio::detail::IdfFieldStore copy(copies[i]);
+        copies[i].set(1, "Office " + std::to_string(i) + " " + std::to_string(j));
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ("Office", store[1]);
+  for (unsigned i = 0; i < copies.size(); ++i) {
+    EXPECT_EQ("Office " + std::to_string(i) + " 999", copies[i][1]);
+    EXPECT_EQ(store[0], copies[i][0]);
+  }
+}
+
+TEST_F(IdfFixture, IdfObject_FieldStorage) {
+  std::stringstream text;
+  text << "OS:Material," << std::endl
+       << "  {12345678-1234-1234-1234-123456789012}, !- Handle" << std::endl
+       << "  Concrete Block With A Long Name,          !- Name" << std::endl
+       << "  MediumRough,                              !- Roughness" << std::endl
+       << "  0.1014984,                                !- Thickness {m}" << std::endl
+       << "  0.3805070,                                !- Conductivity {W/m-K}" << std::endl
+       << "  720.8910,                                 !- Density {kg/m3}" << std::endl
+       << "  837.4000,                                 !- Specific Heat {J/kg-K}" << std::endl
+       << "  0.9,                                      !- Thermal Absorptance" << std::endl
+       << "  0.65,                                     !- Solar Absorptance" << std::endl
+       << "  0.65;                                     ! my comment" << std::endl;
+  OptionalIdfObject oObject = IdfObject::load(text.str());
+  ASSERT_TRUE(oObject);
+  IdfObject object = *oObject;
+
+  ASSERT_EQ(10u, object.numFields());
+  EXPECT_EQ("Concrete Block With A Long Name", object.getString(1).get());
+  EXPECT_NE(std::string::npos, object.fieldComment(9).get().find("my comment"));
+  EXPECT_TRUE(object.fieldComment(8).get().empty());
+
+  // the fields share a single buffer, which takes far less memory than one string per field
+  std::vector<std::string> fields;
+  for (unsigned i = 0; i < object.numFields(); ++i) {
+    fields.push_back(object.getString(i).get());
+  }
+  std::size_t stringMemory = fields.capacity() * sizeof(std::string);
+  for (const std::string& field : fields) {
+    if (field.capacity() > std::string().capacity()) {
+      stringMemory += field.capacity() + 1;
+    }
+  }
+  openstudio::detail::IdfFieldStore store(fields);
+  EXPECT_LT(2 * store.memoryUsage(), stringMemory);
+
+  EXPECT_TRUE(object.setString(2, "Smooth"));
+  EXPECT_EQ("Smooth", object.getString(2).get());
+  EXPECT_EQ("0.1014984", object.getString(3).get());
+  EXPECT_TRUE(object.setFieldComment(2, "rough"));
+  EXPECT_NE(std::string::npos, object.fieldComment(2).get().find("rough"));
+  EXPECT_NE(std::string::npos, object.fieldComment(9).get().find("my comment"));
+
+  IdfObject clone = object.clone();
+  EXPECT_EQ(object.getString(2).get(), clone.getString(2).get());
+  EXPECT_TRUE(clone.setString(1, "Other"));
+  EXPECT_EQ("Concrete Block With A Long Name", object.getString(1).get());
+}
+
+TEST_F(IdfFixture, IdfObject_LoadFromObject) {
+  // carrying an object over in memory gives the same object as printing it and loading the text
+  for (const IdfObject& object : epIdfFile.objects()) {
+    if (object.iddObject().type() == IddObjectType::CommentOnly) {
+      continue;
+    }
+    std::stringstream ss;
+    ss << object;
+    OptionalIdfObject fromText = IdfObject::load(ss.str(), object.iddObject());
+    OptionalIdfObject fromObject = IdfObject::load(object, object.iddObject());
+    ASSERT_TRUE(fromText);
+    ASSERT_TRUE(fromObject);
+    EXPECT_FALSE(fromObject->handle() == object.handle());
+    EXPECT_EQ(fromText->comment(), fromObject->comment());
+    ASSERT_EQ(fromText->numFields(), fromObject->numFields());
+    for (unsigned i = 0, n = fromText->numFields(); i < n; ++i) {
+      EXPECT_EQ(fromText->getString(i, false, false), fromObject->getString(i, false, false));
+      EXPECT_EQ(fromText->fieldComment(i, false), fromObject->fieldComment(i, false));
+    }
+  }
+
+  // values that would not read back are left to the text
+  IdfObject object(IddObjectType::Building);
+  EXPECT_TRUE(object.setName("Building"));
+  EXPECT_TRUE(object.setFieldComment(0, "two\nlines"));
+  EXPECT_FALSE(IdfObject::load(object, object.iddObject()));
+
+  // comments are trimmed the same way
+  object = IdfObject(IddObjectType::CommentOnly);
+  object.setComment("  ! first\n!\n! second  ");
+  std::stringstream ss;
+  ss << object << iddRegex::commentOnlyObjectName() << ";";
+  OptionalIdfObject fromText = IdfObject::load(ss.str(), object.iddObject());
+  OptionalIdfObject fromObject = IdfObject::load(object, object.iddObject());
+  ASSERT_TRUE(fromText);
+  ASSERT_TRUE(fromObject);
+  EXPECT_EQ(fromText->comment(), fromObject->comment());
+}
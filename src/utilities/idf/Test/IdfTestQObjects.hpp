@@ -64,6 +64,8 @@ class WorkspaceReciever  {
     //               this, SLOT(addWorkspaceObject(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)),
     //               Qt::QueuedConnection);
     //OS_ASSERT(test);
+
+    impl->Workspace_Impl::addWorkspaceObjects.connect<WorkspaceReciever, &WorkspaceReciever::addWorkspaceObjects>(this);
   }
 
   void clear()
@@ -71,6 +73,8 @@ class WorkspaceReciever  {
     m_objectImpl.reset();
     m_iddObjectType.reset();
     m_handle.reset();
+    m_addedObjects.clear();
+    m_numAddWorkspaceObjects = 0;
   }
 
   std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> m_objectImpl;
@@ -79,6 +83,10 @@ class WorkspaceReciever  {
 
   boost::optional<Handle> m_handle;
 
+  std::vector<WorkspaceObject> m_addedObjects;
+
+  unsigned m_numAddWorkspaceObjects = 0;
+
  public:
 
   void removeWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle)
@@ -95,6 +103,12 @@ class WorkspaceReciever  {
     m_handle = handle;
   }
 
+  void addWorkspaceObjects(const std::vector<WorkspaceObject>& objects)
+  {
+    m_addedObjects = objects;
+    ++m_numAddWorkspaceObjects;
+  }
+
 };
 
 #endif // UTILITIES_IDF_TEST_IDFTESTQOBJECTS_HPP
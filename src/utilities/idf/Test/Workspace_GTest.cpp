@@ -73,6 +73,9 @@
 using namespace openstudio;
 
 #include <iostream>
+#include <sstream>
+#include <iterator>
+#include <chrono>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor)
 {
@@ -108,6 +111,60 @@ TEST_F(IdfFixture, IdfFile_Workspace_Roundtrip)
   copyOfIdfFile.print(outFile); outFile.close();
 }
 
+namespace {
+  std::string readFile(const openstudio::path& p) {
+    openstudio::filesystem::ifstream inFile(p);
+    return std::string(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+  }
+}
+
+TEST_F(IdfFixture, Workspace_Save)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  // an unnamed target gets named on save, as it does by toIdfFile
+  OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  zone->setName("");
+  OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName,zone->handle()));
+
+  openstudio::path outPath = outDir/toPath("savedWorkspace.idf");
+  ASSERT_TRUE(workspace.save(outPath,true));
+  EXPECT_FALSE(workspace.save(outPath,false));
+  ASSERT_TRUE(zone->name());
+  EXPECT_FALSE(zone->name()->empty());
+
+  std::stringstream ss;
+  workspace.toIdfFile().print(ss);
+  EXPECT_EQ(ss.str(),readFile(outPath));
+
+  // an atomic save writes the same text, leaving other files beside it alone
+  openstudio::path otherPath = outDir/toPath("savedWorkspace.idf.tmp");
+  {
+    openstudio::filesystem::ofstream otherFile(otherPath);
+    otherFile << "not a temporary file";
+  }
+  ASSERT_TRUE(workspace.save(outPath,true,true));
+  EXPECT_EQ(ss.str(),readFile(outPath));
+  EXPECT_EQ("not a temporary file",readFile(otherPath));
+  unsigned numFiles = 0;
+  for (openstudio::filesystem::directory_iterator it(outDir); it != openstudio::filesystem::directory_iterator(); ++it) {
+    if (toString(it->path().filename()).find("savedWorkspace.idf") == 0) {
+      ++numFiles;
+    }
+  }
+  EXPECT_EQ(2u,numFiles);
+  openstudio::filesystem::remove(otherPath);
+
+  // IdfFile::save writes the same text as print
+  openstudio::path idfPath = outDir/toPath("savedIdfFile.idf");
+  ASSERT_TRUE(epIdfFile.save(idfPath,true));
+  ss.str("");
+  epIdfFile.print(ss);
+  EXPECT_EQ(ss.str(),readFile(idfPath));
+}
+
 TEST_F(IdfFixture, ObjectHasURL)
 {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
@@ -1959,6 +2016,272 @@ TEST_F(IdfFixture, Workspace_Signals)
   delete reciever;
 }
 
+TEST_F(IdfFixture, Workspace_AddObjectsBulk)
+{
+  IdfObjectVector idfObjects;
+  IdfObject zone(IddObjectType::Zone);
+  zone.setName("Zone");
+  idfObjects.push_back(zone);
+  IdfObject people(IddObjectType::People);
+  people.setName("People");
+  people.setString(1, "zone");
+  idfObjects.push_back(people);
+  IdfObject zone2(IddObjectType::Zone);
+  zone2.setName("ZONE");
+  idfObjects.push_back(zone2);
+  IdfObject lights(IddObjectType::Lights);
+  lights.setName("Lights");
+  lights.setString(1, "Zone");
+  idfObjects.push_back(lights);
+
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  workspace.removeObject(workspace.versionObject()->handle());
+  WorkspaceReciever reciever(workspace);
+
+  WorkspaceObjectVector objects = workspace.addObjectsBulk(idfObjects);
+  ASSERT_EQ(4u, objects.size());
+
+  // one aggregate signal instead of one per object
+  EXPECT_FALSE(reciever.m_objectImpl);
+  EXPECT_EQ(1u, reciever.m_numAddWorkspaceObjects);
+  ASSERT_EQ(4u, reciever.m_addedObjects.size());
+  EXPECT_TRUE(reciever.m_addedObjects == objects);
+
+  // the first zone keeps its name and pointers were resolved before the second was renamed
+  EXPECT_EQ("Zone", objects[0].nameString());
+  EXPECT_EQ("ZONE 1", objects[2].nameString());
+  ASSERT_TRUE(objects[1].getTarget(1));
+  ASSERT_TRUE(objects[3].getTarget(1));
+  EXPECT_TRUE(objects[1].getTarget(1)->handle() == objects[0].handle() ||
+              objects[1].getTarget(1)->handle() == objects[2].handle());
+  EXPECT_EQ(objects[1].getTarget(1)->nameString(), objects[1].getString(1).get());
+  EXPECT_EQ(objects[3].getTarget(1)->nameString(), objects[3].getString(1).get());
+
+  // not empty, same as addObjects
+  reciever.clear();
+  objects = workspace.addObjectsBulk(IdfObjectVector(1u, zone));
+  ASSERT_EQ(1u, objects.size());
+  EXPECT_EQ("Zone 2", objects[0].nameString());
+  EXPECT_TRUE(reciever.m_objectImpl);
+  EXPECT_EQ(0u, reciever.m_numAddWorkspaceObjects);
+  EXPECT_EQ(5u, workspace.objects().size());
+}
+
+// Benchmark of add time against the size of translator-like output, run with
+// --gtest_also_run_disabled_tests
+TEST_F(IdfFixture, DISABLED_Workspace_AddObjectsBulk_Benchmark)
+{
+  for (int nZones : {500, 1000, 2000, 4000}) {
+    // per zone: zone, 4 surfaces, schedule, people and lights
+    IdfObjectVector idfObjects;
+    IdfObject construction(IddObjectType::Construction);
+    construction.setName("Construction");
+    idfObjects.push_back(construction);
+    for (int i = 0; i < nZones; ++i) {
+      std::string zoneName = "Zone " + std::to_string(i);
+      IdfObject zone(IddObjectType::Zone);
+      zone.setName(zoneName);
+      idfObjects.push_back(zone);
+      for (int j = 0; j < 4; ++j) {
+        IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+        surface.setName(zoneName + " Wall " + std::to_string(j));
+        surface.setString(BuildingSurface_DetailedFields::SurfaceType, "Wall");
+        surface.setString(BuildingSurface_DetailedFields::ConstructionName, "Construction");
+        surface.setString(BuildingSurface_DetailedFields::ZoneName, zoneName);
+        idfObjects.push_back(surface);
+      }
+      IdfObject schedule(IddObjectType::Schedule_Constant);
+      schedule.setName(zoneName + " Schedule");
+      idfObjects.push_back(schedule);
+      IdfObject people(IddObjectType::People);
+      people.setName(zoneName + " People");
+      people.setString(1, zoneName);
+      people.setString(2, zoneName + " Schedule");
+      idfObjects.push_back(people);
+      IdfObject lights(IddObjectType::Lights);
+      lights.setName(zoneName + " Lights");
+      lights.setString(LightsFields::ZoneorZoneListName, zoneName);
+      lights.setString(LightsFields::ScheduleName, zoneName + " Schedule");
+      idfObjects.push_back(lights);
+    }
+
+    double seconds[2];
+    for (int bulk = 0; bulk < 2; ++bulk) {
+      Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+      workspace.removeObject(workspace.versionObject()->handle());
+      workspace.setFastNaming(true);
+      auto start = std::chrono::steady_clock::now();
+      WorkspaceObjectVector objects = bulk ? workspace.addObjectsBulk(idfObjects) : workspace.addObjects(idfObjects);
+      seconds[bulk] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      EXPECT_EQ(idfObjects.size(), objects.size());
+    }
+    std::cout << idfObjects.size() << " objects: addObjects " << seconds[0] << " s, addObjectsBulk "
+              << seconds[1] << " s" << std::endl;
+  }
+}
+
+// Benchmark of following relationships in a large workspace, run with
+// --gtest_also_run_disabled_tests
+TEST_F(IdfFixture, DISABLED_Workspace_Relationships_Benchmark)
+{
+  int nZones = 4000;
+  // per zone: zone, 4 surfaces, schedule, people and lights
+  IdfObjectVector idfObjects;
+  IdfObject construction(IddObjectType::Construction);
+  construction.setName("Construction");
+  idfObjects.push_back(construction);
+  for (int i = 0; i < nZones; ++i) {
+    std::string zoneName = "Zone " + std::to_string(i);
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName(zoneName);
+    idfObjects.push_back(zone);
+    for (int j = 0; j < 4; ++j) {
+      IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+      surface.setName(zoneName + " Wall " + std::to_string(j));
+      surface.setString(BuildingSurface_DetailedFields::SurfaceType, "Wall");
+      surface.setString(BuildingSurface_DetailedFields::ConstructionName, "Construction");
+      surface.setString(BuildingSurface_DetailedFields::ZoneName, zoneName);
+      idfObjects.push_back(surface);
+    }
+    IdfObject schedule(IddObjectType::Schedule_Constant);
+    schedule.setName(zoneName + " Schedule");
+    idfObjects.push_back(schedule);
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName(zoneName + " Lights");
+    lights.setString(LightsFields::ZoneorZoneListName, zoneName);
+    lights.setString(LightsFields::ScheduleName, zoneName + " Schedule");
+    idfObjects.push_back(lights);
+  }
+
+  // all surfaces are sources of the one construction
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  workspace.setFastNaming(true);
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(idfObjects.size(), workspace.addObjectsBulk(idfObjects).size());
+  double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  WorkspaceObjectVector surfaces = workspace.getObjectsByType(IddObjectType::BuildingSurface_Detailed);
+  OptionalWorkspaceObject sharedConstruction = workspace.getObjectByTypeAndName(IddObjectType::Construction, "Construction");
+  ASSERT_TRUE(sharedConstruction);
+  EXPECT_EQ(static_cast<unsigned>(nZones * 4), sharedConstruction->numSources());
+
+  int passes = 20;
+  std::size_t n = 0;
+  start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; ++pass) {
+    for (const WorkspaceObject& zone : zones) {
+      n += zone.getSources(IddObjectType::BuildingSurface_Detailed).size();
+      n += zone.getSources(IddObjectType::Lights).size();
+    }
+  }
+  double sourcesSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_EQ(static_cast<std::size_t>(passes * nZones * 5), n);
+
+  n = 0;
+  start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; ++pass) {
+    for (const WorkspaceObject& surface : surfaces) {
+      if (surface.getTarget(BuildingSurface_DetailedFields::ZoneName)) { ++n; }
+      if (surface.getTarget(BuildingSurface_DetailedFields::ConstructionName)) { ++n; }
+    }
+  }
+  double targetSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_EQ(static_cast<std::size_t>(passes * nZones * 8), n);
+
+  // add and remove more sources of the shared construction one at a time
+  int nExtra = nZones * 4;
+  std::vector<Handle> extraHandles;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nExtra; ++i) {
+    IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+    surface.setName("Extra Wall " + std::to_string(i));
+    surface.setString(BuildingSurface_DetailedFields::SurfaceType, "Wall");
+    surface.setString(BuildingSurface_DetailedFields::ConstructionName, "Construction");
+    OptionalWorkspaceObject added = workspace.addObject(surface);
+    ASSERT_TRUE(added);
+    extraHandles.push_back(added->handle());
+  }
+  double addSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_EQ(static_cast<unsigned>(nZones * 4 + nExtra), sharedConstruction->numSources());
+
+  // point them away from the shared construction and back
+  OptionalWorkspaceObject otherConstruction = workspace.addObject(IdfObject(IddObjectType::Construction));
+  ASSERT_TRUE(otherConstruction);
+  start = std::chrono::steady_clock::now();
+  for (const Handle& h : extraHandles) {
+    WorkspaceObject surface = workspace.getObject(h).get();
+    EXPECT_TRUE(surface.setPointer(BuildingSurface_DetailedFields::ConstructionName, otherConstruction->handle()));
+  }
+  for (const Handle& h : extraHandles) {
+    WorkspaceObject surface = workspace.getObject(h).get();
+    EXPECT_TRUE(surface.setPointer(BuildingSurface_DetailedFields::ConstructionName, sharedConstruction->handle()));
+  }
+  double repointSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_EQ(static_cast<unsigned>(nZones * 4 + nExtra), sharedConstruction->numSources());
+
+  start = std::chrono::steady_clock::now();
+  for (const Handle& h : extraHandles) {
+    EXPECT_TRUE(workspace.removeObject(h));
+  }
+  double removeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_EQ(static_cast<unsigned>(nZones * 4), sharedConstruction->numSources());
+
+  std::cout << workspace.numObjects() << " objects: load " << loadSeconds << " s, getSources " << sourcesSeconds
+            << " s, getTarget " << targetSeconds << " s (" << passes << " passes), add " << nExtra
+            << " sources of one target " << addSeconds << " s, point them away and back " << repointSeconds
+            << " s, remove them " << removeSeconds << " s" << std::endl;
+}
+
+// Benchmark of saving a large workspace, run with --gtest_also_run_disabled_tests
+TEST_F(IdfFixture, DISABLED_Workspace_Save_Benchmark)
+{
+  int nZones = 4000;
+  IdfObjectVector idfObjects;
+  IdfObject construction(IddObjectType::Construction);
+  construction.setName("Construction");
+  idfObjects.push_back(construction);
+  for (int i = 0; i < nZones; ++i) {
+    std::string zoneName = "Zone " + std::to_string(i);
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName(zoneName);
+    idfObjects.push_back(zone);
+    for (int j = 0; j < 4; ++j) {
+      IdfObject surface(IddObjectType::BuildingSurface_Detailed);
+      surface.setName(zoneName + " Wall " + std::to_string(j));
+      surface.setString(BuildingSurface_DetailedFields::SurfaceType, "Wall");
+      surface.setString(BuildingSurface_DetailedFields::ConstructionName, "Construction");
+      surface.setString(BuildingSurface_DetailedFields::ZoneName, zoneName);
+      for (int k = 0; k < 4; ++k) {
+        IdfExtensibleGroup eg = surface.pushExtensibleGroup();
+        eg.setDouble(0, i + (k % 2));
+        eg.setDouble(1, j + (k / 2));
+        eg.setDouble(2, 3.0);
+      }
+      idfObjects.push_back(surface);
+    }
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName(zoneName + " Lights");
+    lights.setString(LightsFields::ZoneorZoneListName, zoneName);
+    idfObjects.push_back(lights);
+  }
+
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  workspace.setFastNaming(true);
+  EXPECT_EQ(idfObjects.size(), workspace.addObjectsBulk(idfObjects).size());
+
+  openstudio::path outPath = outDir/toPath("benchmarkWorkspace.idf");
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(workspace.save(outPath,true));
+  double saveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(workspace.toIdfFile().save(outPath,true));
+  double idfFileSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << workspace.numObjects() << " objects: Workspace::save " << saveSeconds
+            << " s, toIdfFile().save " << idfFileSeconds << " s" << std::endl;
+}
+
 TEST_F(IdfFixture,Workspace_Swap) {
   Workspace ws1, ws2;
   ws1.addObject(IdfObject(IddObjectType::OS_Building));
@@ -2074,6 +2397,137 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID)
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
 
+TEST_F(IdfFixture, Workspace_NameIndex)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_TRUE(zone->setName("Office Zone"));
+  ASSERT_EQ(1u, ws.getObjectsByName("OFFICE ZONE").size());
+  EXPECT_EQ(zone->handle(), ws.getObjectsByName("office zone")[0].handle());
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "office Zone"));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::ZoneList, "Office Zone"));
+  EXPECT_TRUE(ws.getObjectByNameAndReference("OFFICE zone", StringVector(1u, "ZoneNames")));
+  EXPECT_FALSE(ws.getObjectByNameAndReference("Office Zone", StringVector(1u, "ZoneListNames")));
+
+  // renaming through the name field updates the index
+  EXPECT_TRUE(zone->setString(0, "Lobby Zone"));
+  EXPECT_EQ(0u, ws.getObjectsByName("Office Zone").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("LOBBY ZONE").size());
+  EXPECT_EQ(1u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "lobby zone 3").size());
+
+  // name conflicts are resolved against the index
+  boost::optional<WorkspaceObject> zone2 = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone2);
+  EXPECT_TRUE(zone2->setName("lobby zone"));
+  EXPECT_EQ("lobby zone 1", zone2->nameString());
+  EXPECT_EQ(2u, ws.getObjectsByName("Lobby Zone", false).size());
+  EXPECT_EQ("Lobby Zone 2", ws.nextName("Lobby Zone", false));
+
+  // schedule type limits may share a zone's name since their references do not overlap
+  boost::optional<WorkspaceObject> limits = ws.addObject(IdfObject(IddObjectType::ScheduleTypeLimits));
+  ASSERT_TRUE(limits);
+  EXPECT_TRUE(limits->setName("Lobby Zone"));
+  EXPECT_EQ("Lobby Zone", limits->nameString());
+  EXPECT_EQ(2u, ws.getObjectsByName("Lobby Zone").size());
+
+  Workspace clone = ws.clone();
+  EXPECT_EQ(2u, clone.getObjectsByName("lobby zone").size());
+
+  EXPECT_EQ(1u, limits->remove().size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Lobby Zone").size());
+  EXPECT_EQ(2u, clone.getObjectsByName("lobby zone").size());
+
+  // removed objects are no longer indexed
+  zone->remove();
+  EXPECT_EQ(0u, ws.getObjectsByName("Lobby Zone").size());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Lobby Zone"));
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Lobby Zone 1"));
+
+  ws.swap(clone);
+  EXPECT_EQ(2u, ws.getObjectsByName("lobby zone").size());
+  EXPECT_EQ(0u, clone.getObjectsByName("lobby zone").size());
+  EXPECT_EQ(1u, clone.getObjectsByName("lobby zone 1").size());
+}
+
+TEST_F(IdfFixture, Workspace_RelationshipRevision)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::shared_ptr<detail::Workspace_Impl> wsImpl = ws.getImpl<detail::Workspace_Impl>();
+
+  boost::optional<WorkspaceObject> lights = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+  boost::optional<WorkspaceObject> schedule = ws.addObject(IdfObject(IddObjectType::Schedule_Compact));
+  ASSERT_TRUE(schedule);
+
+  // data and name changes leave relationships alone
+  unsigned long long revision = wsImpl->relationshipRevision();
+  EXPECT_TRUE(lights->setString(LightsFields::LightingLevel, "100"));
+  EXPECT_TRUE(schedule->setName("Lights Schedule"));
+  EXPECT_EQ(revision, wsImpl->relationshipRevision());
+
+  EXPECT_TRUE(lights->setPointer(LightsFields::ScheduleName, schedule->handle()));
+  EXPECT_NE(revision, wsImpl->relationshipRevision());
+
+  revision = wsImpl->relationshipRevision();
+  schedule->remove();
+  EXPECT_NE(revision, wsImpl->relationshipRevision());
+  EXPECT_FALSE(lights->getTarget(LightsFields::ScheduleName));
+
+  revision = wsImpl->relationshipRevision();
+  EXPECT_TRUE(ws.addObject(IdfObject(IddObjectType::Zone)));
+  EXPECT_NE(revision, wsImpl->relationshipRevision());
+}
+
+TEST_F(IdfFixture, Workspace_ObjectIds)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  std::shared_ptr<detail::Workspace_Impl> wsImpl = ws.getImpl<detail::Workspace_Impl>();
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  boost::optional<WorkspaceObject> schedule = ws.addObject(IdfObject(IddObjectType::Schedule_Compact));
+  ASSERT_TRUE(schedule);
+  boost::optional<WorkspaceObject> lights = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName, zone->handle()));
+  EXPECT_TRUE(lights->setPointer(LightsFields::ScheduleName, schedule->handle()));
+
+  unsigned zoneId = zone->getImpl<detail::WorkspaceObject_Impl>()->objectId();
+  unsigned scheduleId = schedule->getImpl<detail::WorkspaceObject_Impl>()->objectId();
+  EXPECT_NE(detail::NullObjectId, zoneId);
+  EXPECT_NE(zoneId, scheduleId);
+  EXPECT_EQ(wsImpl->objectId(zone->handle()), zoneId);
+
+  // removing an object frees its id for the next object
+  Handle scheduleHandle = schedule->handle();
+  schedule->remove();
+  EXPECT_EQ(detail::NullObjectId, wsImpl->objectId(scheduleHandle));
+  EXPECT_FALSE(lights->getTarget(LightsFields::ScheduleName));
+  boost::optional<WorkspaceObject> otherZone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(otherZone);
+  EXPECT_EQ(scheduleId, otherZone->getImpl<detail::WorkspaceObject_Impl>()->objectId());
+  EXPECT_FALSE(lights->getTarget(LightsFields::ScheduleName));
+
+  ASSERT_TRUE(lights->getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zone->handle(), lights->getTarget(LightsFields::ZoneorZoneListName)->handle());
+  ASSERT_EQ(1u, zone->getSources(IddObjectType::Lights).size());
+  EXPECT_EQ(lights->handle(), zone->getSources(IddObjectType::Lights)[0].handle());
+  EXPECT_TRUE(otherZone->getSources(IddObjectType::Lights).empty());
+
+  // clones keep handles but not ids
+  Workspace clone = ws.clone(true);
+  boost::optional<WorkspaceObject> clonedLights = clone.getObject(lights->handle());
+  ASSERT_TRUE(clonedLights);
+  boost::optional<WorkspaceObject> clonedZone = clonedLights->getTarget(LightsFields::ZoneorZoneListName);
+  ASSERT_TRUE(clonedZone);
+  EXPECT_EQ(zone->handle(), clonedZone->handle());
+  EXPECT_TRUE(clonedZone->workspace() == clone);
+  ASSERT_EQ(1u, clonedZone->sources().size());
+  EXPECT_TRUE(clonedZone->sources()[0].workspace() == clone);
+}
+
 TEST_F(IdfFixture, Workspace_DuplicateObjectName) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
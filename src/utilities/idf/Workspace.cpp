@@ -169,6 +169,12 @@ namespace detail {
     m_fastNaming = otherImpl->m_fastNaming;
     otherImpl->m_fastNaming = tfn;
 
+    registerRelationshipChange();
+    otherImpl->registerRelationshipChange();
+
+    // objects change workspace, so neither may reuse a revision the other has seen
+    m_changeRevision = otherImpl->m_changeRevision = std::max(m_changeRevision,otherImpl->m_changeRevision) + 1;
+
     WorkspaceObjectMap twop = m_workspaceObjectMap;
     m_workspaceObjectMap = otherImpl->m_workspaceObjectMap;
     otherImpl->m_workspaceObjectMap = twop;
@@ -184,6 +190,15 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    // object ids are indices into the slots, so they stay valid
+    m_objectSlots.swap(otherImpl->m_objectSlots);
+    m_freeObjectIds.swap(otherImpl->m_freeObjectIds);
+
+    // swap rather than copy, m_indexedNames points into the index nodes
+    m_nameIndex.swap(otherImpl->m_nameIndex);
+    m_baseNameIndex.swap(otherImpl->m_baseNameIndex);
+    m_indexedNames.swap(otherImpl->m_indexedNames);
   }
 
   // GETTERS
@@ -232,6 +247,29 @@ namespace detail {
     return boost::none;
   }
 
+  std::shared_ptr<WorkspaceObject_Impl> Workspace_Impl::getObjectImpl(unsigned id, const Handle& handle) const {
+    if (id < m_objectSlots.size()) {
+      const std::shared_ptr<WorkspaceObject_Impl>& slot = m_objectSlots[id];
+      if (slot && (slot->handle() == handle)) {
+        return slot;
+      }
+    }
+    // stale or missing id
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt != m_workspaceObjectMap.end()) {
+      return womIt->second;
+    }
+    return nullptr;
+  }
+
+  unsigned Workspace_Impl::objectId(const Handle& handle) const {
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt != m_workspaceObjectMap.end()) {
+      return womIt->second->objectId();
+    }
+    return NullObjectId;
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::objects(bool sorted) const {
     OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
     if (!versionIdd) { return WorkspaceObjectVector(); }
@@ -345,7 +383,9 @@ namespace detail {
   {
     WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      auto loc = m_nameIndex.find(foldName(name));
+      if (loc == m_nameIndex.end()) { return result; }
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
         if (OptionalString candidate = p.second->name()) {
           if (istringEqual(*candidate,name)) {
             result.push_back(WorkspaceObject(p.second));
@@ -355,7 +395,9 @@ namespace detail {
     }
     else {
       std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      auto loc = m_baseNameIndex.find(foldName(baseName));
+      if (loc == m_baseNameIndex.end()) { return result; }
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
         if (OptionalString candidate = p.second->name()) {
           if (baseNamesMatch(baseName, *candidate)) {
             result.push_back(WorkspaceObject(p.second));
@@ -390,10 +432,13 @@ namespace detail {
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(
       IddObjectType objectType,const std::string& name) const
   {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
+    auto loc = m_nameIndex.find(foldName(name));
+    if (loc == m_nameIndex.end()) { return boost::none; }
+    for (const WorkspaceObjectMap::value_type& p : loc->second) {
+      if (p.second->iddObject().type() != objectType) { continue; }
+      OptionalString candidate = p.second->name();
       if (candidate && istringEqual(*candidate,name)) {
-        return object;
+        return WorkspaceObject(p.second);
       }
     }
     return boost::none;
@@ -405,10 +450,13 @@ namespace detail {
   {
     WorkspaceObjectVector result;
     std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
+    auto loc = m_baseNameIndex.find(foldName(baseName));
+    if (loc == m_baseNameIndex.end()) { return result; }
+    for (const WorkspaceObjectMap::value_type& p : loc->second) {
+      if (p.second->iddObject().type() != objectType) { continue; }
+      if (OptionalString candidate = p.second->name()) {
         if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
+          result.push_back(WorkspaceObject(p.second));
         }
       }
     }
@@ -450,13 +498,30 @@ namespace detail {
       std::string name,
       const std::vector<std::string>& referenceNames) const
   {
-    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate,name)) {
-        return object;
+    WorkspaceObjectVector candidates = getObjectsByNameAndReference(name,referenceNames);
+    if (candidates.empty()) { return boost::none; }
+    return candidates[0];
+  }
+
+  std::vector<WorkspaceObject> Workspace_Impl::getObjectsByNameAndReference(
+      const std::string& name,
+      const std::vector<std::string>& referenceNames) const
+  {
+    WorkspaceObjectVector result;
+    auto loc = m_nameIndex.find(foldName(name));
+    if (loc == m_nameIndex.end()) { return result; }
+    for (const WorkspaceObjectMap::value_type& p : loc->second) {
+      OptionalString candidate = p.second->name();
+      if (!candidate || !istringEqual(*candidate,name)) { continue; }
+      for (const std::string& referenceName : referenceNames) {
+        auto irmLoc = m_idfReferencesMap.find(referenceName);
+        if ((irmLoc != m_idfReferencesMap.end()) && (irmLoc->second.count(p.first) > 0)) {
+          result.push_back(WorkspaceObject(p.second));
+          break;
+        }
       }
     }
-    return boost::none;
+    return result;
   }
 
   bool Workspace_Impl::fastNaming() const
@@ -464,6 +529,16 @@ namespace detail {
     return m_fastNaming;
   }
 
+  unsigned long long Workspace_Impl::relationshipRevision() const
+  {
+    return m_relationshipRevision;
+  }
+
+  unsigned long long Workspace_Impl::changeRevision() const
+  {
+    return m_changeRevision;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
@@ -616,8 +691,10 @@ namespace detail {
     for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       newHandles.push_back(ptr->handle());
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(),ptr));
+      insertIntoObjectSlots(ptr);
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameIndex(ptr);
       this->progressValue.nano_emit(++i);
     }
 
@@ -628,6 +705,12 @@ namespace detail {
         this->progressValue.nano_emit(++i);
       }
     }
+    else {
+      // same handles, but pointers still hold the ids of the original workspace
+      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->updatePointerIds();
+      }
+    }
 
     // step 3: apply handle map to orderer
     if (!oldNewHandleMap.empty() && m_workspaceObjectOrder.isDirectOrder()) {
@@ -800,6 +883,102 @@ namespace detail {
     return result;
   }
 
+  std::vector<WorkspaceObject> Workspace_Impl::addObjectsBulk(const std::vector<IdfObject>& idfObjects, bool checkNames) {
+    if (idfObjects.empty()) {
+      return WorkspaceObjectVector();
+    }
+
+    if (numObjects() > 0) {
+      // conflicts with existing names have to be resolved before pointers are set
+      return addObjects(idfObjects,checkNames);
+    }
+
+    bool keepHandles = idfObjects[0].iddObject().hasHandleField();
+    WorkspaceObject_ImplPtrVector objectImplPtrs;
+    objectImplPtrs.reserve(idfObjects.size());
+    for (const IdfObject& idfObject : idfObjects) {
+      objectImplPtrs.push_back(this->createObject(idfObject,keepHandles));
+    }
+
+    int N = objectImplPtrs.size();
+    this->progressRange.nano_emit(0, 3*N);
+    this->progressValue.nano_emit(0);
+    this->progressCaption.nano_emit("Adding Objects");
+
+    // step 1: add to maps, sized for all objects up front
+    reserveForObjects(objectImplPtrs);
+    HandleVector newHandles;
+    newHandles.reserve(N);
+    bool ok = true;
+    for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      if (!nominallyAddObject(ptr)) {
+        LOG(Error,"Tried to add two objects with the same handle: " << ptr->handle());
+        ok = false;
+        break;
+      }
+      newHandles.push_back(ptr->handle());
+    }
+    this->progressValue.nano_emit(N);
+
+    // step 2: replace string pointers, looking names up in the name index
+    if (ok) {
+      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->initializeOnAdd(false);
+      }
+    }
+    this->progressValue.nano_emit(2*N);
+
+    // step 3: register initialization
+    WorkspaceObjectVector newObjects;
+    if (ok) {
+      newObjects.reserve(N);
+      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->setInitialized();
+        newObjects.push_back(WorkspaceObject(ptr));
+      }
+    }
+    this->progressValue.nano_emit(3*N);
+
+    // step 4: check validity
+    if (ok) {
+      StrictnessLevel level = strictnessLevel();
+      if ((objectImplPtrs.size() == numAllObjects()) || (level == StrictnessLevel::Final)) {
+        ok = isValid();
+      }
+      else {
+        for (const WorkspaceObject& newObject : newObjects) {
+          ok = newObject.isValid(level, checkNames);
+          if (!ok) {
+            break;
+          }
+        }
+      }
+    }
+
+    // step 5: rollback if necessary
+    if (!ok) {
+      LOG(Info,"Unable to add objects to Workspace. The validity report is: " <<
+          std::endl << validityReport());
+      nominallyRemoveObjects(newHandles); // no validity check
+      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->disconnect();
+      }
+      return WorkspaceObjectVector();
+    }
+
+    // step 6: connect objects, rename duplicates, and announce all objects at once
+    for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+      ptr.get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
+    }
+    resolveNameConflicts(newObjects);
+    registerRelationshipChange();
+    this->addWorkspaceObjects.nano_emit(newObjects);
+    ++m_changeRevision;
+    this->onChange.nano_emit();
+
+    return newObjects;
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::insertObjects(const IdfObjectVector& idfObjects) {
     return addAndInsertObjects(IdfObjectVector(),idfObjects);
   }
@@ -1512,6 +1691,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
+      ++m_changeRevision;
       this->onChange.nano_emit();
       return true;
     }
@@ -1544,6 +1724,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
+      ++m_changeRevision;
       this->onChange.nano_emit();
       return true;
     }
@@ -1666,6 +1847,17 @@ namespace detail {
     return getObjectsByType(objectType).size();
   }
 
+  std::vector<IddObjectType> Workspace_Impl::iddObjectTypes() const {
+    std::vector<IddObjectType> result;
+    result.reserve(m_iddObjectTypeMap.size());
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      if (!p.second.empty()) {
+        result.push_back(p.first);
+      }
+    }
+    return result;
+  }
+
   bool Workspace_Impl::isMember(const Handle& handle) const {
     auto womIt = m_workspaceObjectMap.find(handle);
     return (womIt != m_workspaceObjectMap.end());
@@ -1886,8 +2078,39 @@ namespace detail {
 
   // SERIALIZATION
 
-  bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+  bool Workspace_Impl::save(const openstudio::path& p, bool overwrite, bool atomic) {
+    path wp = IdfFile::savePath(p,m_iddFileAndFactoryWrapper,overwrite);
+    if (wp.empty()) {
+      return false;
+    }
+
+    // same text as toIdfFile().save(p,overwrite), written straight from the workspace objects
+    OptionalWorkspaceObject vo = versionObject();
+    WorkspaceObjectVector objs = objects(true); // sorted objects
+
+    // name every unnamed target before writing anything, since a target may come before the
+    // objects that point to it
+    if (vo) {
+      vo->getImpl<WorkspaceObject_Impl>()->nameTargets();
+    }
+    for (const WorkspaceObject& obj : objs) {
+      obj.getImpl<WorkspaceObject_Impl>()->nameTargets();
+    }
+
+    std::string text;
+    text.reserve(256 * (objs.size() + 1));
+    if (!m_header.empty()) {
+      text += m_header;
+      text += '\n';
+    }
+    text += '\n';
+    if (vo) {
+      vo->getImpl<WorkspaceObject_Impl>()->appendIdfText(text);
+    }
+    for (const WorkspaceObject& obj : objs) {
+      obj.getImpl<WorkspaceObject_Impl>()->appendIdfText(text);
+    }
+    return IdfFile::writeFile(wp,text,atomic);
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -1965,6 +2188,14 @@ namespace detail {
     return std::make_tuple(boost::none, " ");
   }
 
+  std::string Workspace_Impl::foldName(const std::string& name) {
+    std::string result(name);
+    for (char& c : result) {
+      c = static_cast<char>(toupper(static_cast<unsigned char>(c)));
+    }
+    return result;
+  }
+
   std::string Workspace_Impl::getBaseName(const std::string& objectName) const {
 
     std::size_t found1 = objectName.find_last_of(' ');
@@ -2062,6 +2293,9 @@ namespace detail {
     insertOK = m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(h,ptr));
     if (!insertOK.second) { return false; }
 
+    // object slots
+    insertIntoObjectSlots(ptr);
+
     // WorkspaceObjectOrder--push_back if ordered directly
     if (m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.push_back(h);
@@ -2073,6 +2307,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameIndex
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -2082,6 +2319,33 @@ namespace detail {
     m_workspaceObjectMap[handle] = objectImplPtr;
   }
 
+  void Workspace_Impl::insertIntoObjectSlots(
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    unsigned id;
+    if (m_freeObjectIds.empty()) {
+      id = m_objectSlots.size();
+      m_objectSlots.push_back(objectImplPtr);
+    }
+    else {
+      id = m_freeObjectIds.back();
+      m_freeObjectIds.pop_back();
+      m_objectSlots[id] = objectImplPtr;
+    }
+    objectImplPtr->setObjectId(id);
+  }
+
+  void Workspace_Impl::eraseFromObjectSlots(
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    unsigned id = objectImplPtr->objectId();
+    if ((id < m_objectSlots.size()) && (m_objectSlots[id] == objectImplPtr)) {
+      m_objectSlots[id].reset();
+      m_freeObjectIds.push_back(id);
+    }
+    objectImplPtr->setObjectId(NullObjectId);
+  }
+
   void Workspace_Impl::insertIntoIddObjectTypeMap(
       const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
   {
@@ -2096,6 +2360,78 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    OptionalString name = objectImplPtr->name();
+    if (!name) { return; }
+    Handle handle = objectImplPtr->handle();
+    auto nameLoc = m_nameIndex.try_emplace(foldName(*name)).first;
+    nameLoc->second.insert(std::make_pair(handle, objectImplPtr));
+    auto baseNameLoc = m_baseNameIndex.try_emplace(foldName(getBaseName(*name))).first;
+    baseNameLoc->second.insert(std::make_pair(handle, objectImplPtr));
+    m_indexedNames[handle] = std::make_pair(&nameLoc->first, &baseNameLoc->first);
+  }
+
+  void Workspace_Impl::reserveForObjects(
+      const std::vector< std::shared_ptr<WorkspaceObject_Impl> >& objectImplPtrs)
+  {
+    std::size_t n = m_workspaceObjectMap.size() + objectImplPtrs.size();
+    m_workspaceObjectMap.reserve(n);
+    if (objectImplPtrs.size() > m_freeObjectIds.size()) {
+      m_objectSlots.reserve(m_objectSlots.size() + objectImplPtrs.size() - m_freeObjectIds.size());
+    }
+    m_nameIndex.reserve(n);
+    m_baseNameIndex.reserve(n);
+    m_indexedNames.reserve(n);
+
+    // count new objects per type, and per type's references
+    std::map<IddObjectType,std::size_t> typeCounts;
+    for (const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr : objectImplPtrs) {
+      ++typeCounts[objectImplPtr->iddObject().type()];
+    }
+    std::unordered_map<std::string,std::size_t> referenceCounts;
+    for (const auto& p : typeCounts) {
+      WorkspaceObjectMap& typeMap = m_iddObjectTypeMap[p.first];
+      typeMap.reserve(typeMap.size() + p.second);
+      if (OptionalIddObject iddObject = getIddObject(p.first)) {
+        for (const std::string& referenceName : iddObject->references()) {
+          referenceCounts[referenceName] += p.second;
+        }
+      }
+    }
+    for (const auto& p : referenceCounts) {
+      WorkspaceObjectMap& referenceMap = m_idfReferencesMap[p.first];
+      referenceMap.reserve(referenceMap.size() + p.second);
+    }
+  }
+
+  void Workspace_Impl::eraseFromNameIndex(const Handle& handle) {
+    auto inLoc = m_indexedNames.find(handle);
+    if (inLoc == m_indexedNames.end()) { return; }
+    auto nameLoc = m_nameIndex.find(*(inLoc->second.first));
+    OS_ASSERT(nameLoc != m_nameIndex.end());
+    nameLoc->second.erase(handle);
+    // erase entry if set is empty
+    if (nameLoc->second.empty()) { m_nameIndex.erase(nameLoc); }
+    auto baseNameLoc = m_baseNameIndex.find(*(inLoc->second.second));
+    OS_ASSERT(baseNameLoc != m_baseNameIndex.end());
+    baseNameLoc->second.erase(handle);
+    if (baseNameLoc->second.empty()) { m_baseNameIndex.erase(baseNameLoc); }
+    m_indexedNames.erase(inLoc);
+  }
+
+  void Workspace_Impl::updateNameIndex(const Handle& handle) {
+    auto womLoc = m_workspaceObjectMap.find(handle);
+    if (womLoc == m_workspaceObjectMap.end()) { return; }
+    eraseFromNameIndex(handle);
+    insertIntoNameIndex(womLoc->second);
+  }
+
+  void Workspace_Impl::registerRelationshipChange() {
+    ++m_relationshipRevision;
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2163,6 +2499,44 @@ namespace detail {
     return changeMade;
   }
 
+  bool Workspace_Impl::resolveNameConflicts(const std::vector<WorkspaceObject>& objects) {
+    bool changeMade = false;
+
+    WorkspaceObjectVector objectsToRename;
+    std::unordered_map<std::string,WorkspaceObjectVector> sharedNameMap;
+    for (const WorkspaceObject& object : objects) {
+      OptionalString currentName = object.name();
+      if (!currentName || currentName->empty()) { continue; }
+      std::string key = foldName(*currentName);
+      auto loc = m_nameIndex.find(key);
+      if ((loc == m_nameIndex.end()) || (loc->second.size() < 2u)) { continue; }
+      WorkspaceObjectVector& sameName = sharedNameMap[key];
+      for (const WorkspaceObject& other : sameName) {
+        if (!intersectReferenceLists(object.iddObject().references(),
+                                     other.iddObject().references()).empty())
+        {
+          objectsToRename.push_back(object);
+          break;
+        }
+      }
+      sameName.push_back(object);
+    }
+
+    OptionalString newName;
+    std::string originalDescription;
+    for (WorkspaceObject& object : objectsToRename) {
+      originalDescription = object.briefDescription();
+      newName = nextName(object.name().get(),false);
+      newName = object.setName(*newName);
+      OS_ASSERT(newName);
+      LOG(Info,"Renamed " << originalDescription << " to '" << *newName
+          << "' to avoid a name conflict upon WorkspaceObject addition.");
+      changeMade = true;
+    }
+
+    return changeMade;
+  }
+
   void Workspace_Impl::mergeIdfObjectAfterPotentialNameConflictResolution(
       IdfObject& mergedObject,const IdfObject& originalObject) const
   {
@@ -2261,11 +2635,11 @@ namespace detail {
     WorkspaceObjectVector sources;
     ReversePointerSet pointers = objectImplPtr->getReversePointers();
     for (const ReversePointer& ptr : pointers) {
-      OptionalWorkspaceObject source = getObject(ptr.sourceHandle);
+      WorkspaceObject_ImplPtr sourceImplPtr = getObjectImpl(ptr.sourceId,ptr.sourceHandle);
       // OS_ASSERT(sourceImplPtr);
-      if (source) {
-        source->getImpl<WorkspaceObject_Impl>()->setPointer(ptr.fieldIndex,Handle(),false);
-        sources.push_back(*source);
+      if (sourceImplPtr) {
+        sourceImplPtr->setPointer(ptr.fieldIndex,Handle(),false);
+        sources.push_back(WorkspaceObject(sourceImplPtr));
       }
       else {
         OptionalString objectName = objectImplPtr->name();
@@ -2280,6 +2654,9 @@ namespace detail {
       }
     }
 
+    // NameIndex
+    eraseFromNameIndex(handle);
+
     // IdfReferencesMap
     StringVector references = objectImplPtr->iddObject().references();
     for (const std::string& reference : references) {
@@ -2310,6 +2687,9 @@ namespace detail {
     auto womIt = m_workspaceObjectMap.find(handle);
     m_workspaceObjectMap.erase(womIt);
 
+    // object slots
+    eraseFromObjectSlots(objectImplPtr);
+
     return sources;
   }
 
@@ -2335,6 +2715,7 @@ namespace detail {
     }
     ptr->disconnect();
     ptr.get()->onChange.disconnect<Workspace_Impl, &Workspace_Impl::change>(this);
+    registerRelationshipChange();
   }
 
   void Workspace_Impl::registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,
@@ -2348,9 +2729,11 @@ namespace detail {
 
   void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
+    registerRelationshipChange();
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
+    ++m_changeRevision;
     this->onChange.nano_emit();
   }
 
@@ -2358,6 +2741,9 @@ namespace detail {
     // WorkspaceObjectMap
     m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(savedObject.handle,savedObject.objectImplPtr));
 
+    // object slots, restorePointers updates the ids this object holds
+    insertIntoObjectSlots(savedObject.objectImplPtr);
+
     // WorkspaceObjectOrder
     if (savedObject.orderIndex) {
       m_workspaceObjectOrder.insert(savedObject.handle,*(savedObject.orderIndex));
@@ -2369,6 +2755,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameIndex
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2494,6 +2883,7 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    ++m_changeRevision;
     this->onChange.nano_emit();
   }
 
@@ -2744,6 +3134,10 @@ std::vector<WorkspaceObject> Workspace::addObjects(const std::vector<IdfObject>&
   return m_impl->addObjects(idfObjects, checkNames);
 }
 
+std::vector<WorkspaceObject> Workspace::addObjectsBulk(const std::vector<IdfObject>& idfObjects, bool checkNames) {
+  return m_impl->addObjectsBulk(idfObjects, checkNames);
+}
+
 std::vector <WorkspaceObject> Workspace::insertObjects(const std::vector<IdfObject>& idfObjects) {
   return m_impl->insertObjects(idfObjects);
 }
@@ -2896,8 +3290,8 @@ bool Workspace::disconnectProgressBar(openstudio::ProgressBar& progressBar)
 
 // SERIALIZATION
 
-bool Workspace::save(const openstudio::path& p, bool overwrite) {
-  return m_impl->save(p,overwrite);
+bool Workspace::save(const openstudio::path& p, bool overwrite, bool atomic) {
+  return m_impl->save(p,overwrite,atomic);
 }
 
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
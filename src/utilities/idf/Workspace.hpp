@@ -122,7 +122,7 @@ class UTILITIES_API Workspace {
   /** Copy constructor, shares data with other Workspace. */
   Workspace(const Workspace& other);
 
-  /** Create a deep copy (clone) of all data in this Workspace and return the result in a new
+  /** Create a copy (clone) of all data in this Workspace and return the result in a new
    *  Workspace object. Virtual implementation preserves original Workspace type. Example usage
    *  for derived class:
    *
@@ -134,7 +134,12 @@ class UTILITIES_API Workspace {
    *
    *  If keepHandles, then new handles will not be assigned to the cloned objects. This feature
    *  should be used with care, as reuse of unique object identifiers could lead to changing data
-   *  in the wrong Workspace. */
+   *  in the wrong Workspace.
+   *
+   *  The cloned objects share their field text with the originals until either one is modified,
+   *  so cloning does not copy the text. The clone is otherwise independent of this Workspace, and
+   *  the two may be modified on different threads. This Workspace must not be modified on another
+   *  thread while it is being cloned. */
   Workspace clone(bool keepHandles=false) const;
 
   /** Clone just the objects referenced by handles into a new Workspace. All non-object data is
@@ -267,6 +272,14 @@ class UTILITIES_API Workspace {
    *  return value will be .empty(). If IdfObjects have handles they will be preserved.*/
   std::vector<WorkspaceObject> addObjects(const std::vector<IdfObject>& idfObjects, bool checkNames = true);
 
+  /** Bulk version of addObjects(idfObjects, checkNames), for adding a large set of new objects
+   *  (e.g. translator output) to an empty Workspace. The maps are sized up front and pointers are
+   *  resolved through the name index in a single pass. Objects are renamed to resolve name
+   *  conflicts before anyone is notified, and a single addWorkspaceObjects signal replaces the
+   *  per-object addWorkspaceObject signals. If this Workspace already contains objects, this is
+   *  the same as addObjects. */
+  std::vector<WorkspaceObject> addObjectsBulk(const std::vector<IdfObject>& idfObjects, bool checkNames = true);
+
   /** Insert idfObjects into Workspace, if possible. Looks for equivalent objects first, then
    *  adds if necessary. If successful, new and equivalent objects will be returned in same order
    *  as idfObjects. Otherwise, return value will be .empty(). Equivalence is determined by
@@ -422,8 +435,10 @@ class UTILITIES_API Workspace {
   /** Save this Workspace to path p. Will construct the parent folder if necessary and if its
    *  parent folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use modelFileExtension() for files using IddFileType::OpenStudio,
-   *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
-  bool save(const openstudio::path& p, bool overwrite=false);
+   *  and 'idf' otherwise. If atomic==true, the text is written to a uniquely named temporary file
+   *  beside p that then replaces p, so a failed save leaves any existing file untouched. Returns
+   *  true if the save operation is successful; false otherwise. */
+  bool save(const openstudio::path& p, bool overwrite=false, bool atomic=false);
 
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
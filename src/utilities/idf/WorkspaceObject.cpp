@@ -59,7 +59,8 @@ namespace detail {
                                              bool keepHandle)
     : IdfObject_Impl(*(idfObject.getImpl<detail::IdfObject_Impl>()),keepHandle),  // clones idfObject data
       m_initialized(false),
-      m_workspace(workspace)
+      m_workspace(workspace),
+      m_objectId(NullObjectId)
   {
     if (!m_iddObject.objectLists().empty()) {
       // can nominally be source
@@ -77,6 +78,7 @@ namespace detail {
     IdfObject_Impl(other, keepHandle),
     m_initialized(false),
     m_workspace(workspace),
+    m_objectId(NullObjectId),
     m_sourceData(other.m_sourceData),
     m_targetData(other.m_targetData)
   {}
@@ -152,7 +154,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),m_objectId,fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -173,6 +175,7 @@ namespace detail {
       }
       m_targetData->reversePointers = mappedPointers;
     }
+    updatePointerIds();
   }
 
   // GETTERS
@@ -230,9 +233,11 @@ namespace detail {
       // find index and return target if handle not null
       auto fpIt = getConstIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index);
       if (fpIt != m_sourceData->pointers.end()) {
-        Handle th = fpIt->targetHandle;
-        if (!th.isNull()) {
-          return this->workspace().getObject(th);
+        if (!fpIt->targetHandle.isNull()) {
+          WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(fpIt->targetId,fpIt->targetHandle);
+          if (target) {
+            return WorkspaceObject(target);
+          }
         }
       }
     }
@@ -246,9 +251,9 @@ namespace detail {
     if (m_sourceData) {
       for (const ForwardPointer& ptr : m_sourceData->pointers) {
         if (!ptr.targetHandle.isNull()) {
-          OptionalWorkspaceObject owo = this->workspace().getObject(ptr.targetHandle);
-          OS_ASSERT(owo);
-          result.push_back(*owo);
+          WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(ptr.targetId,ptr.targetHandle);
+          OS_ASSERT(target);
+          result.push_back(WorkspaceObject(target));
         }
       }
     }
@@ -271,11 +276,12 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
+      result.reserve(m_targetData->reversePointers.size());
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+        WorkspaceObject_ImplPtr source = m_workspace->getObjectImpl(ptr.sourceId,ptr.sourceHandle);
+        OS_ASSERT(source);
+        result.push_back(WorkspaceObject(source));
       }
       std::sort(result.begin(), result.end());
       result.erase(std::unique(result.begin(), result.end()), result.end());
@@ -289,9 +295,9 @@ namespace detail {
     if (m_targetData) {
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+        WorkspaceObject_ImplPtr source = m_workspace->getObjectImpl(ptr.sourceId,ptr.sourceHandle);
+        OS_ASSERT(source);
+        if (source->iddObject().type() == type) { result.push_back(WorkspaceObject(source)); }
       }
       std::sort(result.begin(), result.end());
       result.erase(std::unique(result.begin(), result.end()), result.end());
@@ -846,12 +852,12 @@ namespace detail {
             result->setString(ptr.fieldIndex,toString(ptr.targetHandle));
           }
           else {
-            OptionalString targetName = m_workspace->name(ptr.targetHandle);
+            WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(ptr.targetId,ptr.targetHandle);
+            OS_ASSERT(target);
+            OptionalString targetName = target->name();
             OS_ASSERT(targetName);
             if (targetName->empty()) {
               // give target a name
-              OptionalWorkspaceObject target = m_workspace->getObject(ptr.targetHandle);
-              OS_ASSERT(target);
               target->createName(false);
               targetName = target->name();
               OS_ASSERT(targetName);
@@ -884,7 +890,9 @@ namespace detail {
             result->setString(ptr.fieldIndex,toString(ptr.targetHandle));
           }
           else {
-            OptionalString targetName = m_workspace->name(ptr.targetHandle);
+            WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(ptr.targetId,ptr.targetHandle);
+            OS_ASSERT(target);
+            OptionalString targetName = target->name();
             OS_ASSERT(targetName);
             result->setString(ptr.fieldIndex,*targetName);
           }
@@ -894,6 +902,63 @@ namespace detail {
     return result;
   }
 
+  void WorkspaceObject_Impl::nameTargets() {
+    if (!initialized()) {
+      LOG_AND_THROW("Attempt to name the targets of a disconnected WorkspaceObject.");
+    }
+
+    if (!m_sourceData || m_iddObject.hasHandleField()) {
+      return;
+    }
+
+    for (const ForwardPointer& ptr : m_sourceData->pointers) {
+      if (ptr.targetHandle.isNull()) {
+        continue;
+      }
+      WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(ptr.targetId,ptr.targetHandle);
+      OS_ASSERT(target);
+      OptionalString targetName = target->name();
+      OS_ASSERT(targetName);
+      if (targetName->empty()) {
+        target->createName(false);
+      }
+    }
+  }
+
+  void WorkspaceObject_Impl::appendIdfText(std::string& text) const {
+    if (!initialized()) {
+      LOG_AND_THROW("Attempt to write a disconnected WorkspaceObject out to Idf.");
+    }
+
+    if (!m_sourceData || m_sourceData->pointers.empty()) {
+      appendText(text);
+      return;
+    }
+
+    // fields are written in order, so walk the (sorted) pointers alongside them
+    bool serializeHandle = m_iddObject.hasHandleField();
+    auto ptrIt = m_sourceData->pointers.begin();
+    auto ptrEnd = m_sourceData->pointers.end();
+    appendText(text,[&](unsigned index, std::string& scratch) -> std::string_view {
+      while ((ptrIt != ptrEnd) && (ptrIt->fieldIndex < index)) {
+        ++ptrIt;
+      }
+      if ((ptrIt == ptrEnd) || (ptrIt->fieldIndex != index) || ptrIt->targetHandle.isNull()) {
+        return m_fields[index];
+      }
+      if (serializeHandle) {
+        scratch = toString(ptrIt->targetHandle);
+        return scratch;
+      }
+      WorkspaceObject_ImplPtr target = m_workspace->getObjectImpl(ptrIt->targetId,ptrIt->targetHandle);
+      OS_ASSERT(target);
+      OptionalString targetName = target->name();
+      OS_ASSERT(targetName);
+      scratch = std::move(*targetName);
+      return scratch;
+    });
+  }
+
   /** Returns equivalent IdfObject, naming targets if necessary. All data is cloned. */
   IdfObject WorkspaceObject_Impl::idfObject()
   {
@@ -996,6 +1061,8 @@ namespace detail {
     std::pair<SourceData::pointer_set::iterator,bool> insertResult;
     insertResult = m_sourceData->pointers.insert(ForwardPointer(index,Handle()));
     OS_ASSERT(insertResult.second);
+
+    m_workspace->registerRelationshipChange();
   }
 
   // Pre-condition:  Object sourceHandle points to this object from field index.
@@ -1012,17 +1079,41 @@ namespace detail {
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
   // Post-condition: m_targetData indicates that object sourceHandle points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned sourceId, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) { m_targetData = TargetData(); }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index,sourceId));
     OS_ASSERT(insertResult.second);
   }
 
+  unsigned WorkspaceObject_Impl::objectId() const {
+    return m_objectId;
+  }
+
+  void WorkspaceObject_Impl::setObjectId(unsigned id) {
+    m_objectId = id;
+  }
+
+  void WorkspaceObject_Impl::updatePointerIds() {
+    OS_ASSERT(m_workspace);
+    // ids are not part of the ordering, so are updated in place
+    if (m_sourceData) {
+      for (const ForwardPointer& ptr : m_sourceData->pointers) {
+        ptr.targetId = ptr.targetHandle.isNull() ? NullObjectId : m_workspace->objectId(ptr.targetHandle);
+      }
+    }
+    if (m_targetData) {
+      for (const ReversePointer& ptr : m_targetData->reversePointers) {
+        ptr.sourceId = m_workspace->objectId(ptr.sourceHandle);
+      }
+    }
+  }
+
   void WorkspaceObject_Impl::restorePointers() {
     OS_ASSERT(!m_handle.isNull());
+    updatePointerIds();
     if (m_sourceData) {
       for (const ForwardPointer& ptr : m_sourceData->pointers) {
         if (!ptr.targetHandle.isNull()) {
@@ -1031,14 +1122,16 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(),h.end(),m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,m_objectId,ptr.fieldIndex);
             }
           }
         }
       }
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      // copy, setPointer may change m_targetData and invalidate its iterators
+      ReversePointerSet reversePointers = m_targetData->reversePointers;
+      for (const ReversePointer& ptr : reversePointers) {
         OptionalWorkspaceObject source = m_workspace->getObject(ptr.sourceHandle);
         if (source) {
           OptionalWorkspaceObject oTarget = source->getTarget(ptr.fieldIndex);
@@ -1078,15 +1171,19 @@ namespace detail {
     if (fpIt != m_sourceData->pointers.end()) {
       m_sourceData->pointers.erase(fpIt);
     }
+    WorkspaceObject_ImplPtr target;
+    if (!targetHandle.isNull()) {
+      target = m_workspace->getObjectImpl(NullObjectId,targetHandle);
+      OS_ASSERT(target);
+    }
     std::pair<SourceData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_sourceData->pointers.insert(ForwardPointer(index,targetHandle));
+    insertResult = m_sourceData->pointers.insert(ForwardPointer(index,targetHandle,target ? target->objectId() : NullObjectId));
     OS_ASSERT(insertResult.second);
+    m_workspace->registerRelationshipChange();
 
     // add reverse pointer
-    if (!targetHandle.isNull()) {
-      OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
-      OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,index);
+    if (target) {
+      target->setReversePointer(m_handle,m_objectId,index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle,index,targetHandle);
     }
@@ -1148,7 +1245,7 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      m_diffs.push_back(IdfObjectDiff(index, std::string(m_fields[index]), boost::none));
       m_fields.pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
@@ -1203,13 +1300,9 @@ namespace detail {
     if (!oName) {
       return true;
     }
-    WorkspaceObjectVector candidates = m_workspace->getObjectsByReference(iddObject().references());
+    WorkspaceObjectVector candidates = m_workspace->getObjectsByNameAndReference(*oName,iddObject().references());
     for (const WorkspaceObject& candidate : candidates) {
-      OptionalString candidateName = candidate.name();
-      OS_ASSERT(candidateName);
-      if ((istringEqual(*oName,*candidateName) &&
-          (!initialized() || (getObject<WorkspaceObject>() != candidate))))
-      {
+      if (!initialized() || (getObject<WorkspaceObject>() != candidate)) {
         return false;
       }
     }
@@ -1263,6 +1356,12 @@ namespace detail {
     return result;
   }
 
+  void WorkspaceObject_Impl::nameFieldChanged() {
+    if (m_workspace && !m_handle.isNull()) {
+      m_workspace->updateNameIndex(m_handle);
+    }
+  }
+
 } // detail
 
 bool WorkspaceObject::operator < (const WorkspaceObject& right) const
@@ -36,6 +36,11 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <boost/container/flat_set.hpp>
+
+#include <limits>
+#include <set>
+
 namespace openstudio {
 
 // forward declarations
@@ -46,16 +51,23 @@ namespace detail {
 
   class Workspace_Impl; // forward declaration
 
+  /** Id of an object with no slot in a Workspace_Impl. Object ids are dense indices into the object
+   *  slots of a Workspace_Impl, and are only a shortcut to the object: the handle stays the identity
+   *  of the object, and an id is always checked against it before use. */
+  const unsigned NullObjectId = std::numeric_limits<unsigned>::max();
+
   struct UTILITIES_API ForwardPointer {
     unsigned fieldIndex;
     Handle   targetHandle;
+    // not part of the ordering, refreshed in place when objects move to new slots
+    mutable unsigned targetId;
 
     /// \todo Default constructor needed to iterate over Source Map, but setting fieldIndex to 0
     /// seems sub-optimal.
-    ForwardPointer() : fieldIndex(0) {}
-    ForwardPointer(unsigned i,const Handle& h) : fieldIndex(i), targetHandle(h) {}
+    ForwardPointer() : fieldIndex(0), targetId(NullObjectId) {}
+    ForwardPointer(unsigned i,const Handle& h,unsigned id=NullObjectId) : fieldIndex(i), targetHandle(h), targetId(id) {}
   };
-  typedef std::set<ForwardPointer,FieldIndexLess<ForwardPointer> > ForwardPointerSet;
+  typedef boost::container::flat_set<ForwardPointer,FieldIndexLess<ForwardPointer> > ForwardPointerSet;
 
   struct UTILITIES_API SourceData {
     typedef ForwardPointer    pointer_type;
@@ -70,9 +82,11 @@ namespace detail {
   struct UTILITIES_API ReversePointer {
     Handle   sourceHandle;
     unsigned fieldIndex;
+    // not part of the ordering, refreshed in place when objects move to new slots
+    mutable unsigned sourceId;
 
-    ReversePointer() : fieldIndex(0) {}
-    ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i) {}
+    ReversePointer() : fieldIndex(0), sourceId(NullObjectId) {}
+    ReversePointer(const Handle& h, unsigned i, unsigned id=NullObjectId) : sourceHandle(h), fieldIndex(i), sourceId(id) {}
   };
   struct UTILITIES_API ReversePointerLess {
     bool operator()(const ReversePointer& left, const ReversePointer& right) const {
@@ -84,6 +98,8 @@ namespace detail {
       }
     }
   };
+  // node-based, handles are random so a new source lands anywhere in the ordering, and a target may
+  // have many thousands of sources (e.g. an always on schedule)
   typedef std::set<ReversePointer,ReversePointerLess > ReversePointerSet;
 
   struct UTILITIES_API TargetData {
@@ -94,22 +110,26 @@ namespace detail {
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
+  /** Binary search, pointerSet must be ordered by fieldIndex. */
   template<class T>
   typename T::pointer_set::iterator getIteratorAtFieldIndex(
                                                             typename T::pointer_set& pointerSet,
                                                             unsigned fieldIndex)
   {
-    return std::find_if(pointerSet.begin(),pointerSet.end(),
-                        std::bind(fieldIndexEqualTo<typename T::pointer_type>,std::placeholders::_1,fieldIndex));
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
+  /** Binary search, pointerSet must be ordered by fieldIndex. */
   template<class T>
   typename T::pointer_set::const_iterator getConstIteratorAtFieldIndex(
                                                                        const typename T::pointer_set& pointerSet,
                                                                        unsigned fieldIndex)
   {
-    return std::find_if(pointerSet.begin(),pointerSet.end(),
-                        std::bind(fieldIndexEqualTo<typename T::pointer_type>,std::placeholders::_1,fieldIndex));
+    typename T::pointer_type key;
+    key.fieldIndex = fieldIndex;
+    return pointerSet.find(key);
   }
 
   class UTILITIES_API WorkspaceObject_Impl : public IdfObject_Impl {
@@ -175,6 +195,9 @@ namespace detail {
     /** Provided for Workspace_Impl to get easy access to targetData. */
     ReversePointerSet getReversePointers() const;
 
+    /** Returns this object's id in its workspace's object slots, or NullObjectId if it has none. */
+    unsigned objectId() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -279,6 +302,14 @@ namespace detail {
     /** Returns equivalent IdfObject, leaving unnamed target objects unnamed. All data is cloned. */
     IdfObject idfObject() const;
 
+    /** Gives each unnamed object this object points to a name, as idfObject() does, unless
+     *  pointers are written as handles. */
+    void nameTargets();
+
+    /** Appends the text of idfObject() to text without constructing the IdfObject. Targets
+     *  must already be named, see nameTargets. */
+    void appendIdfText(std::string& text) const;
+
     //@}
     /** @name Signal Helpers */
     //@{
@@ -317,8 +348,14 @@ namespace detail {
 
     void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
 
+    void setReversePointer(const Handle& sourceHandle, unsigned sourceId, unsigned index);
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    /** Set by Workspace_Impl when this object is given or loses a slot. */
+    void setObjectId(unsigned id);
+
+    /** Looks up the ids of all targets and sources by handle. Called when objects may have moved to
+     *  new slots (clone, restore). */
+    void updatePointerIds();
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -340,10 +377,14 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const override;
 
+    /** Keeps the Workspace name index current. */
+    virtual void nameFieldChanged() override;
+
    private:
 
     bool                m_initialized;
     Workspace_Impl*     m_workspace;
+    unsigned            m_objectId;
     OptionalSourceData  m_sourceData;
     OptionalTargetData  m_targetData;
 
@@ -92,10 +92,10 @@ namespace detail {
                    bool keepHandles=false,
                    StrictnessLevel level = StrictnessLevel::Draft);
 
-    /** Create a deep copy (clone) of all data in this Workspace and return the result in a new
+    /** Create a copy (clone) of all data in this Workspace and return the result in a new
      *  Workspace object. If keepHandles, then new handles will not be assigned to the cloned objects.
      *  This feature should be used with care, as reuse of unique object identifiers could lead to
-     *  changing data in the wrong Workspace. */
+     *  changing data in the wrong Workspace. See Workspace::clone for how field text is shared. */
     virtual Workspace clone(bool keepHandles=false) const;
 
     /** Clone just the objects referenced by handles into a new Workspace. All non-object data is
@@ -157,6 +157,14 @@ namespace detail {
     /** Get object from its handle. */
     boost::optional<WorkspaceObject> getObject(const Handle& handle) const;
 
+    /** Get object from its id and handle. The object in slot id is returned if it has handle,
+     *  otherwise the object is looked up by handle. Returns a null pointer if there is no object
+     *  with handle. */
+    std::shared_ptr<WorkspaceObject_Impl> getObjectImpl(unsigned id, const Handle& handle) const;
+
+    /** Returns the id of the object with handle, or NullObjectId. */
+    unsigned objectId(const Handle& handle) const;
+
     /** Get all objects in this workspace. The returned objects' data is shared with the workspace.
      *  If sorted, then the objects are returned in the preferred order. */
     std::vector<WorkspaceObject> objects(bool sorted=false) const;
@@ -209,9 +217,24 @@ namespace detail {
     boost::optional<WorkspaceObject> getObjectByNameAndReference(
         std::string name,const std::vector<std::string>& referenceNames) const;
 
+    /** Returns all objects that are in at least one of the reference lists in referenceNames and
+     *  named name (case insensitive, but exact match). */
+    std::vector<WorkspaceObject> getObjectsByNameAndReference(
+        const std::string& name,const std::vector<std::string>& referenceNames) const;
+
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns a counter that is incremented whenever a pointer between objects is set or cleared,
+     *  and whenever objects are added or removed. Caches built from object relationships can keep
+     *  the value they were built at, and rebuild when it changes. */
+    unsigned long long relationshipRevision() const;
+
+    /** Returns a counter that is incremented whenever any object in the workspace changes, and
+     *  whenever objects are added or removed. Values derived from the data of many objects can be
+     *  kept along with the revision they were computed at, and recomputed when it changes. */
+    unsigned long long changeRevision() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -266,6 +289,11 @@ namespace detail {
      *  .empty(). */
     virtual std::vector<WorkspaceObject> addObjects(const std::vector<IdfObject>& idfObjects, bool checkNames = true);
 
+    /** Bulk version of addObjects(idfObjects, checkNames) for large sets of new objects. Emits a
+     *  single addWorkspaceObjects signal instead of per-object addWorkspaceObject signals. Same as
+     *  addObjects if this Workspace already contains objects. */
+    virtual std::vector<WorkspaceObject> addObjectsBulk(const std::vector<IdfObject>& idfObjects, bool checkNames = true);
+
     /** Insert idfObjects into Workspace, if possible. Looks for equivalent objects first, then
      *  adds if necessary. If successful, new and equivalent objects will be returned in same order
      *  as idfObjects. Otherwise, return value will be .empty(). Equivalence is determined by
@@ -394,6 +422,9 @@ namespace detail {
     /** Return the number of objects by full IddObject type. */
     unsigned numObjectsOfType(const IddObject& objectType) const;
 
+    /** Return the IddObjectTypes of the objects in the workspace, including the version object. */
+    std::vector<IddObjectType> iddObjectTypes() const;
+
     /** True if handle corresponds to an object in this workspace. */
     bool isMember(const Handle& handle) const;
 
@@ -434,8 +465,9 @@ namespace detail {
 
     /** Save Workspace to path. Will construct parent folder, but no further up the chain. Will
      *  only overwrite an existing file if overwrite==true. If no extension is provided will use
-     *  .idf or modelFileExtension() depending on the underlying IddFileType. */
-    virtual bool save(const openstudio::path& p, bool overwrite=false);
+     *  .idf or modelFileExtension() depending on the underlying IddFileType. If atomic==true,
+     *  writes to a temporary file that then replaces the file at path. */
+    virtual bool save(const openstudio::path& p, bool overwrite=false, bool atomic=false);
 
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
@@ -483,6 +515,11 @@ namespace detail {
     // DLM: deprecate this version
     // void addWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
     mutable Nano::Signal<void(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)> addWorkspaceObjectPtr;
+
+    /** Sends all of the objects just added to the Workspace by addObjectsBulk. addWorkspaceObject
+     *  and addWorkspaceObjectPtr are not emitted for these objects. */
+    // void addWorkspaceObjects(const std::vector<WorkspaceObject>& objects) const;
+    mutable Nano::Signal<void(const std::vector<WorkspaceObject>&)> addWorkspaceObjects;
     //@}
 
 
@@ -490,6 +527,13 @@ namespace detail {
 
     void change();
 
+    /** Refiles the object with handle in the name index after its name field changes. Called by
+     *  WorkspaceObject_Impl; does nothing if handle is not (yet) in this workspace. */
+    void updateNameIndex(const Handle& handle);
+
+    /** Increments relationshipRevision. Called by WorkspaceObject_Impl when a pointer changes. */
+    void registerRelationshipChange();
+
    protected:
 
     // helper for non-virtual part of clone implementation
@@ -511,10 +555,17 @@ namespace detail {
     std::string m_header;                                // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
+    unsigned long long m_relationshipRevision = 0;
+    unsigned long long m_changeRevision = 0;
 
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
+    // objects indexed by object id, null for free slots. pointers between objects keep the id
+    // of the object they point to, so relationships are followed without hashing handles.
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > m_objectSlots;
+    std::vector<unsigned> m_freeObjectIds;
+
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
 
@@ -526,6 +577,17 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // maps of case-folded name, and of case-folded name without integer suffix, to set of objects
+    // identified by UUID. entries are only candidates--callers confirm the match against name().
+    typedef std::unordered_map<std::string, WorkspaceObjectMap> NameIndex;
+    NameIndex m_nameIndex;
+    NameIndex m_baseNameIndex;
+
+    // keys each object is filed under in m_nameIndex and m_baseNameIndex. points into the index
+    // nodes, so each distinct name is stored once.
+    typedef std::unordered_map<Handle, std::pair<const std::string*, const std::string*>, boost::hash<boost::uuids::uuid> > IndexedNameMap;
+    IndexedNameMap m_indexedNames;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -550,6 +612,9 @@ namespace detail {
     /** Returns objectName in with any suffix integers removed. */
     std::string getBaseName(const std::string& objectName) const;
 
+    /** Returns name upper-cased character by character, consistent with istringEqual. */
+    static std::string foldName(const std::string& name);
+
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
     // SETTERS
@@ -562,14 +627,30 @@ namespace detail {
 
     void insertIntoObjectMap(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    // Gives object an id, reusing a free slot if there is one.
+    void insertIntoObjectSlots(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void eraseFromObjectSlots(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
     void insertIntoIddObjectTypeMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    // Sizes the maps for objects that are about to be added.
+    void reserveForObjects(const std::vector< std::shared_ptr<WorkspaceObject_Impl> >& objects);
+
+    void eraseFromNameIndex(const Handle& handle);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other,
                                        const std::vector<unsigned>& toIgnore);
 
+    // Renames objects whose names conflict with an earlier object in objects. Only names shared
+    // by more than one object in the name index are examined.
+    bool resolveNameConflicts(const std::vector<WorkspaceObject>& objects);
+
     void mergeIdfObjectAfterPotentialNameConflictResolution(
         IdfObject& mergedObject,const IdfObject& originalObject) const;
 
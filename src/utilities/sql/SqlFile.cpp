@@ -1372,6 +1372,25 @@ openstudio::OptionalTimeSeries SqlFile::timeSeries(const std::string& envPeriod,
   return result;
 }
 
+boost::optional<int> SqlFile::reportDataDictionaryIndex(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue) const
+{
+  boost::optional<int> result;
+  if (m_impl){
+    result = m_impl->reportDataDictionaryIndex(envPeriod, reportingFrequency, timeSeriesName, keyValue);
+  }
+  return result;
+}
+
+bool SqlFile::timeSeriesValues(const std::string& envPeriod, const std::vector<int>& reportDataDictionaryIndices,
+    std::vector<double>& values, std::vector<std::size_t>& offsets) const
+{
+  bool result = false;
+  if (m_impl){
+    result = m_impl->timeSeriesValues(envPeriod, reportDataDictionaryIndices, values, offsets);
+  }
+  return result;
+}
+
 SqlFileTimeSeriesQueryVector SqlFile::expandQuery(const SqlFileTimeSeriesQuery& query) {
   SqlFileTimeSeriesQueryVector result;
   if (m_impl) {
@@ -1388,6 +1407,14 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+std::vector<TimeSeriesVector> SqlFile::timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+  std::vector<TimeSeriesVector> result(queries.size());
+  if (m_impl) {
+    result = m_impl->timeSeries(queries);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime> > SqlFile::daylightSavingsPeriod() const
 {
   boost::optional<std::pair<DateTime, DateTime> > result;
@@ -693,6 +693,21 @@ class UTILITIES_API SqlFile {
                                          const std::string& timeSeriesName,
                                          const std::string& keyValue);
 
+  // return the ReportDataDictionaryIndex of the time series matching name, keyValue, envPeriod, and reportingFrequency
+  boost::optional<int> reportDataDictionaryIndex(const std::string& envPeriod,
+                                                 const std::string& reportingFrequency,
+                                                 const std::string& timeSeriesName,
+                                                 const std::string& keyValue) const;
+
+  /** Reads the values of several time series in envPeriod with a few queries instead of one per
+   *  time series. The values of reportDataDictionaryIndices[i] are written to values in the range
+   *  [offsets[i], offsets[i+1]), offsets has one more entry than reportDataDictionaryIndices.
+   *  Returns false if any index is not found in envPeriod. */
+  bool timeSeriesValues(const std::string& envPeriod,
+                        const std::vector<int>& reportDataDictionaryIndices,
+                        std::vector<double>& values,
+                        std::vector<std::size_t>& offsets) const;
+
   /** Expands query to create a vector of all matching queries. The returned queries will have
    *  one environment period, one reporting frequency, and one time series name specified. The
    *  returned queries will also be "vetted". */
@@ -702,6 +717,12 @@ class UTILITIES_API SqlFile {
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Executes each query as timeSeries(query) would, result[i] holds the TimeSeries of queries[i]. The values of
+   *  all queries are read in one pass ordered by ReportDataDictionaryIndex, and time series reported at the same
+   *  times in an environment period and reporting frequency share one computed time axis. Prefer this to calling
+   *  timeSeries once per variable when reading many variables. */
+  std::vector<std::vector<TimeSeries> > timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -29,6 +29,7 @@
 // These functions return via reference parameters - something we cannot support with SWIG
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string &, double &, double &);
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double &, double &);
+%ignore openstudio::SqlFile::timeSeriesValues(const std::string &, const std::vector<int> &, std::vector<double> &, std::vector<std::size_t> &) const;
 
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
@@ -43,6 +44,7 @@
 %template(IntDateTimePairVector) std::vector<std::pair<int, openstudio::DateTime> >;
 
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
+%template(TimeSeriesVectorVector) std::vector<std::vector<openstudio::TimeSeries> >;
 
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
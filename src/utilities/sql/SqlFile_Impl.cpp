@@ -36,6 +36,10 @@
 #include "../core/Containers.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <map>
+
 
 
 using boost::multi_index_container;
@@ -55,6 +59,155 @@ namespace openstudio{
       return std::string(reinterpret_cast<const char*>(column));
     }
 
+    SqlStatementCache::Statement::Statement(SqlStatementCache* cache, sqlite3_stmt* statement, bool* inUse)
+      : m_cache(cache), m_statement(statement), m_inUse(inUse)
+    {
+    }
+
+    SqlStatementCache::Statement::Statement(Statement&& other)
+      : m_cache(other.m_cache), m_statement(other.m_statement), m_inUse(other.m_inUse)
+    {
+      other.m_statement = nullptr;
+      other.m_inUse = nullptr;
+    }
+
+    SqlStatementCache::Statement::~Statement()
+    {
+      if (m_statement){
+        if (m_inUse){
+          sqlite3_reset(m_statement);
+          sqlite3_clear_bindings(m_statement);
+          *m_inUse = false;
+        }else{
+          sqlite3_finalize(m_statement);
+        }
+      }
+    }
+
+    sqlite3_stmt* SqlStatementCache::Statement::get() const
+    {
+      return m_statement;
+    }
+
+    SqlStatementCache::SqlStatementCache(std::size_t capacity)
+      : m_capacity(capacity), m_numPrepared(0)
+    {
+    }
+
+    SqlStatementCache::~SqlStatementCache()
+    {
+      clear();
+    }
+
+    SqlStatementCache::Statement SqlStatementCache::get(sqlite3* db, const std::string& sql)
+    {
+      auto it = m_entries.find(sql);
+      if (it != m_entries.end()){
+        if (it->second.inUse){
+          // a query with the same text is still being stepped, use a one off statement
+          return prepareOnce(db, sql);
+        }
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+        it->second.inUse = true;
+        return Statement(this, it->second.statement, &it->second.inUse);
+      }
+
+      sqlite3_stmt* statement = nullptr;
+      sqlite3_prepare_v2(db, sql.c_str(), static_cast<int>(sql.size()), &statement, nullptr);
+      ++m_numPrepared;
+      if (!statement){
+        return Statement(this, nullptr, nullptr);
+      }
+
+      // evict the least recently used statements that are not borrowed
+      auto lruIt = m_lru.end();
+      while (m_entries.size() >= m_capacity && lruIt != m_lru.begin()){
+        --lruIt;
+        auto evict = m_entries.find(*lruIt);
+        if (!evict->second.inUse){
+          sqlite3_finalize(evict->second.statement);
+          m_entries.erase(evict);
+          lruIt = m_lru.erase(lruIt);
+        }
+      }
+
+      m_lru.push_front(sql);
+      Entry& entry = m_entries[sql];
+      entry.statement = statement;
+      entry.inUse = true;
+      entry.lruPosition = m_lru.begin();
+      return Statement(this, statement, &entry.inUse);
+    }
+
+    SqlStatementCache::Statement SqlStatementCache::prepareOnce(sqlite3* db, const std::string& sql)
+    {
+      sqlite3_stmt* statement = nullptr;
+      sqlite3_prepare_v2(db, sql.c_str(), static_cast<int>(sql.size()), &statement, nullptr);
+      ++m_numPrepared;
+      return Statement(this, statement, nullptr);
+    }
+
+    void SqlStatementCache::clear()
+    {
+      for (auto& entry : m_entries){
+        OS_ASSERT(!entry.second.inUse);
+        sqlite3_finalize(entry.second.statement);
+      }
+      m_entries.clear();
+      m_lru.clear();
+    }
+
+    std::size_t SqlStatementCache::size() const
+    {
+      return m_entries.size();
+    }
+
+    std::size_t SqlStatementCache::numPrepared() const
+    {
+      return m_numPrepared;
+    }
+
+    void bindParameter(sqlite3_stmt* statement, int position, int value)
+    {
+      sqlite3_bind_int(statement, position, value);
+    }
+
+    void bindParameter(sqlite3_stmt* statement, int position, unsigned value)
+    {
+      sqlite3_bind_int64(statement, position, value);
+    }
+
+    void bindParameter(sqlite3_stmt* statement, int position, double value)
+    {
+      sqlite3_bind_double(statement, position, value);
+    }
+
+    void bindParameter(sqlite3_stmt* statement, int position, const std::string& value)
+    {
+      sqlite3_bind_text(statement, position, value.c_str(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+    }
+
+    template <typename... Args>
+    SqlStatementCache::Statement SqlFile_Impl::prepare(const std::string& sql, const Args&... args) const
+    {
+      SqlStatementCache::Statement statement = m_statements.get(m_db, sql);
+      if (statement.get()){
+        int position = 0;
+        (bindParameter(statement.get(), ++position, args), ...);
+      }
+      return statement;
+    }
+
+    // name of the column holding the ReportDataDictionaryIndex in a data table
+    std::string dataDictionaryIndexColumn(const std::string& table)
+    {
+      if (table == "ReportMeterData")
+      {
+        return "ReportMeterDataDictionaryIndex";
+      }
+      return "ReportVariableDataDictionaryIndex";
+    }
+
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
       : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true)
     {
@@ -420,6 +573,7 @@ namespace openstudio{
     {
       if (m_connectionOpen)
       {
+        m_statements.clear();
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
@@ -450,6 +604,7 @@ namespace openstudio{
       m_connectionOpen = (code == 0);
       if (m_connectionOpen) {// create index on dictionaryIndex for large table reportvariabledata
         if (!isValidConnection()) {
+          m_statements.clear();
           sqlite3_close(m_db);
           m_connectionOpen = false;
           throw openstudio::Exception("OpenStudio is not compatible with this file.");
@@ -1844,19 +1999,13 @@ namespace openstudio{
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
       std::vector<std::string> vec;
-      std::string keyValueName;
-      DataDictionaryTable::index<keyValue>::type::iterator ikeyValue;
-      for (ikeyValue=m_dataDictionary.get<keyValue>().begin(); ikeyValue!=m_dataDictionary.get<keyValue>().end(); ++ikeyValue)
+      // the composite index is ordered by key value within each envPeriod, reportingFrequency, and name
+      auto range = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().equal_range(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName));
+      for (auto it = range.first; it != range.second; ++it)
       {
-        if ((ikeyValue->envPeriod == queryEnvPeriod) &&
-            (ikeyValue->reportingFrequency == reportingFrequency) &&
-            (ikeyValue->name == timeSeriesName) )
+        if (vec.empty() || (vec.back() != it->keyValue))
         {
-          keyValueName = ikeyValue->keyValue;
-          if (std::find(vec.begin(), vec.end(), keyValueName) == vec.end())
-          {
-            vec.push_back(keyValueName);
-          }
+          vec.push_back(it->keyValue);
         }
       }
       return vec;
@@ -1905,13 +2054,21 @@ namespace openstudio{
       {
         s << " WHERE ReportVariableDataDictionaryIndex=";
       }
-      s << boost::lexical_cast<std::string>(iEpRfNKv->recordIndex);
+      s << "?";
       //    s << " AND ep.EnvironmentName=";
       //    s << "'" << envPeriod << "'";
-      s << " AND t.EnvironmentPeriodIndex=";
-      s << boost::lexical_cast<std::string>(iEpRfNKv->envPeriodIndex);
+      s << " AND t.EnvironmentPeriodIndex=?";
 
-      return execAndReturnFirstDouble(s.str());
+      boost::optional<double> value;
+      if (m_db)
+      {
+        SqlStatementCache::Statement statement = prepare(s.str(), iEpRfNKv->recordIndex, iEpRfNKv->envPeriodIndex);
+        if (sqlite3_step(statement.get()) == SQLITE_ROW)
+        {
+          value = sqlite3_column_double(statement.get(), 0);
+        }
+      }
+      return value;
     }
 
     boost::optional<double> SqlFile_Impl::execAndReturnFirstDouble(const std::string& statement) const
@@ -1919,18 +2076,15 @@ namespace openstudio{
       boost::optional<double> value;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
 
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = sqlite3_column_double(sqlStmtPtr, 0);
         }
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
       return value;
     }
@@ -1940,18 +2094,15 @@ namespace openstudio{
       boost::optional<int> value;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = sqlite3_column_int(sqlStmtPtr, 0);
         }
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
       return value;
     }
@@ -1961,18 +2112,15 @@ namespace openstudio{
       boost::optional<std::string> value;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
 
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = columnText(sqlite3_column_text(sqlStmtPtr, 0));
         }
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
       return value;
     }
@@ -1983,9 +2131,10 @@ namespace openstudio{
       boost::optional<std::vector<double> > valueVector;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
+        int code = sqlStmtPtr ? SQLITE_OK : SQLITE_ERROR;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -2004,9 +2153,6 @@ namespace openstudio{
           }
 
         }// end loop
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       return valueVector;
@@ -2018,9 +2164,10 @@ namespace openstudio{
       boost::optional<std::vector<int> > valueVector;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
+        int code = sqlStmtPtr ? SQLITE_OK : SQLITE_ERROR;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -2039,9 +2186,6 @@ namespace openstudio{
           }
 
         }// end loop
-
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       return valueVector;
@@ -2053,9 +2197,10 @@ namespace openstudio{
       boost::optional<std::vector<std::string> > valueVector;
       if (m_db)
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        // statement is formatted by the caller, so it is not worth caching
+        SqlStatementCache::Statement oneOffStatement = m_statements.prepareOnce(m_db, statement);
+        sqlite3_stmt* sqlStmtPtr = oneOffStatement.get();
+        int code = sqlStmtPtr ? SQLITE_OK : SQLITE_ERROR;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -2074,8 +2219,6 @@ namespace openstudio{
           }
 
         }// end loop
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
       return valueVector;
     }
@@ -2119,19 +2262,17 @@ namespace openstudio{
         {
           s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
+        s << "?";
         //      s << " AND ep.EnvironmentName = ";
         //      s << "'" << dataDictionary.envPeriod << "'";
-        s << " AND ti.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+        s << " AND ti.EnvironmentPeriodIndex = ?";
         // assume that timeindices.timeIndex are ordered from start to end
         //      s << " ORDER BY ti.TimeIndex";
 
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str();
@@ -2144,7 +2285,6 @@ namespace openstudio{
 
           code = sqlite3_step(sqlStmtPtr);
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       LOG(Debug, "Created Timeseries with " << stdValues.size() << " values");
@@ -2176,14 +2316,12 @@ namespace openstudio{
         {
           s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND ti.EnvironmentPeriodIndex=";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+        s << "? AND ti.EnvironmentPeriodIndex=?";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -2193,7 +2331,6 @@ namespace openstudio{
           month = sqlite3_column_int(sqlStmtPtr, b++);
           day = sqlite3_column_int(sqlStmtPtr, b++);
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
       try {
         // DLM@20100707: RunPeriod timeseries return month=0, day=0.
@@ -2209,16 +2346,15 @@ namespace openstudio{
         std::stringstream s;
         s << "SELECT Month, Day, Hour from Time where TimeIndex in (";
         s << "SELECT min(timeIndex) FROM time )";
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str());
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           month = sqlite3_column_int(sqlStmtPtr, 0);
           day = sqlite3_column_int(sqlStmtPtr, 1);
         }
-        sqlite3_finalize(sqlStmtPtr);
 
         // DLM: potential leap year problem
         return openstudio::Date(openstudio::monthOfYear(month), day);
@@ -2272,20 +2408,17 @@ namespace openstudio{
             {
               s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
             }
-            s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-            s << " AND ti.EnvironmentPeriodIndex=";
-            s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+            s << "? AND ti.EnvironmentPeriodIndex=?";
             s << ")";
 
-            sqlite3_stmt* sqlStmtPtr;
-            int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+            SqlStatementCache::Statement statement = prepare(s.str(), dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+            sqlite3_stmt* sqlStmtPtr = statement.get();
 
-            code = sqlite3_step(sqlStmtPtr);
+            int code = sqlite3_step(sqlStmtPtr);
             if (code == SQLITE_ROW)
             {
               minutes = sqlite3_column_double(sqlStmtPtr, 0);
             }
-            sqlite3_finalize(sqlStmtPtr);
           }
           // minutes - 1 to remove starting minute
           return boost::optional<openstudio::Time>(openstudio::Time(0,0,int(std::ceil(minutes-1.0)),0));
@@ -2310,13 +2443,13 @@ namespace openstudio{
         if (hasYear()) {
           s << "Year, ";
         }
-        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = "
-          << envPeriodIndex << " LIMIT 1";
+        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = ?"
+          << " LIMIT 1";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -2333,8 +2466,6 @@ namespace openstudio{
             minute = 0;
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
-
       }
 
       // Note JM 2019-03-14: Starting with E+ v8.9.0, we actually have Year in the SQL file
@@ -2361,13 +2492,13 @@ namespace openstudio{
         if (hasYear()) {
           s << "Year, ";
         }
-        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = "
-          << envPeriodIndex << " order by TimeIndex DESC LIMIT 1";
+        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = ?"
+          << " order by TimeIndex DESC LIMIT 1";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -2384,9 +2515,6 @@ namespace openstudio{
             minute = 0;
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
-
-
       }
 
       // Note JM 2019-03-14: Starting with E+ v8.9.0, we actually have Year in the SQL file
@@ -2404,31 +2532,13 @@ namespace openstudio{
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
       openstudio::OptionalTimeSeries ts;
-      std::string units = dataDictionary.units;
-
-      boost::optional<openstudio::DateTime> firstReportDateTime;
-      std::vector<long> stdSecondsFromFirstReport;
-      stdSecondsFromFirstReport.reserve(8760);
-
-      std::vector<double> stdValues;
-      stdValues.reserve(8760);
-      boost::optional<unsigned> reportingIntervalMinutes;
-
-      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-      bool isIntervalTimeSeries = false;
-      try {
-        reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
-                               (reportingFrequency == ReportingFrequency::Hourly) ||
-                               (reportingFrequency == ReportingFrequency::Daily);
-
-      }catch(const std::exception&){
-      }
 
       if (m_db)
       {
-        std::string energyPlusVersion = this->energyPlusVersion();
-        VersionString version(energyPlusVersion);
+        std::vector<double> stdValues;
+        stdValues.reserve(8760);
+        std::vector<TimeRow> rows;
+        rows.reserve(8760);
 
         std::stringstream s;
         // v8.9.0 added the 'Year' field
@@ -2450,15 +2560,12 @@ namespace openstudio{
         {
           s << " dt.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-        sqlite3_stmt* sqlStmtPtr;
+        s << "? AND Time.EnvironmentPeriodIndex = ?";
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str();
@@ -2466,90 +2573,166 @@ namespace openstudio{
         s2 << code;
         LOG(Debug, s2.str());
 
-        long cumulativeSeconds = 0;
-
         while (code == SQLITE_ROW)
         {
           int b = 0;
-          double value = sqlite3_column_double(sqlStmtPtr, b++);
-          stdValues.push_back(value);
+          stdValues.push_back(sqlite3_column_double(sqlStmtPtr, b++));
 
-          boost::optional<unsigned> year;
+          TimeRow row;
           if (hasYear()) {
-            year = sqlite3_column_int(sqlStmtPtr, b++);
+            row.year = sqlite3_column_int(sqlStmtPtr, b++);
           }
+          row.month = sqlite3_column_int(sqlStmtPtr, b++);
+          row.day = sqlite3_column_int(sqlStmtPtr, b++);
+          row.intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++); // used for run periods
+          rows.push_back(row);
 
-          unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-          unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-          unsigned intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++); // used for run periods
-
-          if ((version.major() == 8) && (version.minor() == 3)){
-            // workaround for bug in E+ 8.3, issue #1692
-            if (reportingFrequency == ReportingFrequency::Daily){
-              intervalMinutes = 24 * 60;
-            } else if (reportingFrequency == ReportingFrequency::Monthly){
-              intervalMinutes = day * 24 * 60;
-            } else if (reportingFrequency == ReportingFrequency::RunPeriod){
-              DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-              DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-              Time deltaT = lastDateTime - firstDateTime;
-              intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
-            }
-          }
+          // step to next row
+          code = sqlite3_step(sqlStmtPtr);
+        }
 
-          if (!firstReportDateTime){
-            if ((month==0) || (day==0)){
-              // gets called for RunPeriod reports
-              firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-            } else{
-              // DLM: get standard time zone?
-              if (intervalMinutes >= 24 * 60){
-                // Daily or Monthly
-                OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-                firstReportDateTime = year
-                  ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                  : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-              } else {
-                firstReportDateTime = year
-                  ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                  : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-              }
+        ts = timeSeries(timeSeriesAxis(dataDictionary, rows), stdValues, dataDictionary.units);
+      }
 
-            }
+      return ts;
+    }
+
+    boost::optional<TimeSeriesAxis> SqlFile_Impl::timeSeriesAxis(const DataDictionaryItem& dataDictionary, const std::vector<TimeRow>& rows)
+    {
+      boost::optional<openstudio::DateTime> firstReportDateTime;
+      std::vector<long> secondsFromFirstReport;
+      secondsFromFirstReport.reserve(rows.size());
+      boost::optional<unsigned> reportingIntervalMinutes;
+
+      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+      bool isIntervalTimeSeries = false;
+      try {
+        reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
+        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
+                               (reportingFrequency == ReportingFrequency::Hourly) ||
+                               (reportingFrequency == ReportingFrequency::Daily);
+
+      }catch(const std::exception&){
+      }
+
+      if (rows.empty()) {
+        return boost::none;
+      }
+
+      VersionString version(this->energyPlusVersion());
+
+      long cumulativeSeconds = 0;
+
+      for (const TimeRow& row : rows)
+      {
+        unsigned month = row.month;
+        unsigned day = row.day;
+        unsigned intervalMinutes = row.intervalMinutes;
+
+        if ((version.major() == 8) && (version.minor() == 3)){
+          // workaround for bug in E+ 8.3, issue #1692
+          if (reportingFrequency == ReportingFrequency::Daily){
+            intervalMinutes = 24 * 60;
+          } else if (reportingFrequency == ReportingFrequency::Monthly){
+            intervalMinutes = day * 24 * 60;
+          } else if (reportingFrequency == ReportingFrequency::RunPeriod){
+            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
+            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
+            Time deltaT = lastDateTime - firstDateTime;
+            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
           }
+        }
 
-          // Use the new way to create the time series with nonzero first entry
-          cumulativeSeconds += 60*intervalMinutes;
-          stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+        if (!firstReportDateTime){
+          if ((month==0) || (day==0)){
+            // gets called for RunPeriod reports
+            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
+          } else{
+            // DLM: get standard time zone?
+            if (intervalMinutes >= 24 * 60){
+              // Daily or Monthly
+              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+              firstReportDateTime = row.year
+                ? openstudio::DateTime(openstudio::Date(month, day, *row.year), openstudio::Time(1, 0, 0, 0))
+                : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+            } else {
+              firstReportDateTime = row.year
+                ? openstudio::DateTime(openstudio::Date(month, day, *row.year), openstudio::Time(0, 0, intervalMinutes, 0))
+                : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+            }
 
-          // check if this interval is same as the others
-          if (isIntervalTimeSeries && !reportingIntervalMinutes){
-            reportingIntervalMinutes = intervalMinutes;
-          }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
-            isIntervalTimeSeries = false;
-            reportingIntervalMinutes.reset();
           }
+        }
 
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
+        // Use the new way to create the time series with nonzero first entry
+        cumulativeSeconds += 60*intervalMinutes;
+        secondsFromFirstReport.push_back(cumulativeSeconds);
+
+        // check if this interval is same as the others
+        if (isIntervalTimeSeries && !reportingIntervalMinutes){
+          reportingIntervalMinutes = intervalMinutes;
+        }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
+          isIntervalTimeSeries = false;
+          reportingIntervalMinutes.reset();
         }
+      }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+      if (!firstReportDateTime){
+        return boost::none;
+      }
 
-        if (firstReportDateTime && !stdSecondsFromFirstReport.empty()){
-          if (isIntervalTimeSeries){
-            openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-          }else{
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
+      if (isIntervalTimeSeries && reportingIntervalMinutes){
+        openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
+        return TimeSeriesAxis(*firstReportDateTime, intervalTime, secondsFromFirstReport.size());
+      }
+      return TimeSeriesAxis(*firstReportDateTime, secondsFromFirstReport);
+    }
+
+    openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const boost::optional<TimeSeriesAxis>& axis, const std::vector<double>& values, const std::string& units)
+    {
+      openstudio::OptionalTimeSeries ts;
+      if (axis){
+        openstudio::Vector vector = createVector(values);
+        ts = openstudio::TimeSeries(*axis, std::move(vector), units);
+      }
+      return ts;
+    }
+
+    std::vector<std::pair<int, SqlFile_Impl::TimeRow> > SqlFile_Impl::timeRows(int envPeriodIndex)
+    {
+      std::vector<std::pair<int, TimeRow> > result;
+
+      if (m_db)
+      {
+        std::stringstream s;
+        s << "SELECT TimeIndex, ";
+        if (hasYear()) {
+          s << "Year, ";
+        }
+        s << "Month, Day, Interval FROM Time WHERE EnvironmentPeriodIndex = ? ORDER BY TimeIndex";
+
+        SqlStatementCache::Statement statement = prepare(s.str(), envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
+
+        int code = sqlite3_step(sqlStmtPtr);
+        while (code == SQLITE_ROW)
+        {
+          int b = 0;
+          int timeIndex = sqlite3_column_int(sqlStmtPtr, b++);
+          TimeRow row;
+          if (hasYear()) {
+            row.year = sqlite3_column_int(sqlStmtPtr, b++);
           }
+          row.month = sqlite3_column_int(sqlStmtPtr, b++);
+          row.day = sqlite3_column_int(sqlStmtPtr, b++);
+          row.intervalMinutes = sqlite3_column_int(sqlStmtPtr, b++);
+          result.push_back(std::make_pair(timeIndex, row));
+
+          code = sqlite3_step(sqlStmtPtr);
         }
       }
 
-      return ts;
+      return result;
     }
 
     openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary)
@@ -2574,15 +2757,12 @@ namespace openstudio{
         {
           s << " dt.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-        sqlite3_stmt* sqlStmtPtr;
+        s << "? AND Time.EnvironmentPeriodIndex = ?";
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare(s.str(), dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = statement.get();
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str() << std::endl;
@@ -2612,8 +2792,6 @@ namespace openstudio{
           // step to next row
           code = sqlite3_step(sqlStmtPtr);
         }
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       return dateTimes;
@@ -2682,6 +2860,180 @@ namespace openstudio{
       return ts;
     }
 
+    boost::optional<int> SqlFile_Impl::reportDataDictionaryIndex(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue) const
+    {
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+
+      DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::const_iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName, keyValue));
+      if (iEpRfNKv == m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()) {
+        return boost::none;
+      }
+      return iEpRfNKv->recordIndex;
+    }
+
+    bool SqlFile_Impl::timeSeriesValues(const std::string& envPeriod, const std::vector<int>& reportDataDictionaryIndices,
+        const std::function<void(std::size_t, int, double)>& sink) const
+    {
+      if (!m_db) {
+        return false;
+      }
+
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+
+      // group the requests by table and environment period index, each group is sorted by ReportDataDictionaryIndex
+      std::map<std::pair<std::string, int>, std::vector<std::pair<int, std::size_t> > > groups;
+      const auto& ids = m_dataDictionary.get<id>();
+      for (std::size_t position = 0; position < reportDataDictionaryIndices.size(); ++position) {
+        int recordIndex = reportDataDictionaryIndices[position];
+        auto range = ids.equal_range(boost::make_tuple(recordIndex));
+        auto it = std::find_if(range.first, range.second, [&queryEnvPeriod](const DataDictionaryItem& item) {
+          return item.envPeriod == queryEnvPeriod;
+        });
+        if (it == range.second) {
+          LOG(Warn, "ReportDataDictionaryIndex " << recordIndex << " not found for environment period '" << envPeriod << "'");
+          return false;
+        }
+        groups[std::make_pair(it->table, it->envPeriodIndex)].push_back(std::make_pair(recordIndex, position));
+      }
+
+      // number of ReportDataDictionaryIndex values per query, the IN list is padded to a power of two so that only a
+      // few query shapes are prepared
+      const std::size_t maxChunkSize = 256;
+
+      for (auto& group : groups) {
+        const std::string& table = group.first.first;
+        int envPeriodIndex = group.first.second;
+        std::vector<std::pair<int, std::size_t> >& requests = group.second;
+        std::sort(requests.begin(), requests.end());
+
+        std::vector<int> recordIndices;
+        for (const auto& request : requests) {
+          if (recordIndices.empty() || (recordIndices.back() != request.first)) {
+            recordIndices.push_back(request.first);
+          }
+        }
+
+        std::string column = dataDictionaryIndexColumn(table);
+        auto request = requests.begin();
+        for (std::size_t begin = 0; begin < recordIndices.size(); begin += maxChunkSize) {
+          std::size_t n = std::min(maxChunkSize, recordIndices.size() - begin);
+          std::size_t numPlaceholders = 1;
+          while (numPlaceholders < n) {
+            numPlaceholders *= 2;
+          }
+
+          std::stringstream s;
+          s << "SELECT dt." << column << ", dt.TimeIndex, dt.VariableValue FROM " << table;
+          s << " dt INNER JOIN Time ti ON ti.TimeIndex = dt.TimeIndex";
+          s << " WHERE ti.EnvironmentPeriodIndex = ? AND dt." << column << " IN (?";
+          for (std::size_t i = 1; i < numPlaceholders; ++i) {
+            s << ",?";
+          }
+          // within one index rows come back in the same order as timeSeriesValues(DataDictionaryItem), ordering by
+          // TimeIndex as well would make SQLite sort every row
+          s << ") ORDER BY dt." << column;
+
+          SqlStatementCache::Statement statement = m_statements.get(m_db, s.str());
+          sqlite3_stmt* sqlStmtPtr = statement.get();
+          if (!sqlStmtPtr) {
+            LOG(Error, "Could not prepare query: " << s.str());
+            return false;
+          }
+
+          int b = 0;
+          sqlite3_bind_int(sqlStmtPtr, ++b, envPeriodIndex);
+          for (std::size_t i = 0; i < numPlaceholders; ++i) {
+            // repeat the last index to fill the padding, duplicates in an IN list do not duplicate rows
+            sqlite3_bind_int(sqlStmtPtr, ++b, recordIndices[begin + std::min(i, n - 1)]);
+          }
+
+          int code = sqlite3_step(sqlStmtPtr);
+          while (code == SQLITE_ROW) {
+            int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+            int timeIndex = sqlite3_column_int(sqlStmtPtr, 1);
+            double value = sqlite3_column_double(sqlStmtPtr, 2);
+
+            // rows are ordered by index, so the matching requests are at or after the current one
+            while ((request != requests.end()) && (request->first < recordIndex)) {
+              ++request;
+            }
+            for (auto match = request; (match != requests.end()) && (match->first == recordIndex); ++match) {
+              sink(match->second, timeIndex, value);
+            }
+
+            code = sqlite3_step(sqlStmtPtr);
+          }
+
+          if (code != SQLITE_DONE) {
+            LOG(Error, "Error reading time series values, return code " << code);
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    bool SqlFile_Impl::timeSeriesValues(const std::string& envPeriod, const std::vector<int>& reportDataDictionaryIndices,
+        std::vector<double>& values, std::vector<std::size_t>& offsets) const
+    {
+      values.clear();
+      offsets.assign(reportDataDictionaryIndices.size() + 1, 0);
+
+      // read each distinct index once, the rows of one index arrive together
+      std::vector<int> uniqueIndices;
+      std::vector<std::size_t> uniquePositions(reportDataDictionaryIndices.size());
+      std::map<int, std::size_t> uniqueIndexMap;
+      for (std::size_t i = 0; i < reportDataDictionaryIndices.size(); ++i) {
+        auto inserted = uniqueIndexMap.insert(std::make_pair(reportDataDictionaryIndices[i], uniqueIndices.size()));
+        if (inserted.second) {
+          uniqueIndices.push_back(reportDataDictionaryIndices[i]);
+        }
+        uniquePositions[i] = inserted.first->second;
+      }
+
+      const std::size_t notFound = std::numeric_limits<std::size_t>::max();
+      std::vector<std::size_t> begins(uniqueIndices.size(), notFound);
+      std::vector<std::size_t> counts(uniqueIndices.size(), 0);
+      bool inRequestOrder = (uniqueIndices.size() == reportDataDictionaryIndices.size());
+      std::size_t lastPosition = 0;
+
+      bool result = timeSeriesValues(envPeriod, uniqueIndices, [&](std::size_t position, int, double value) {
+        if (begins[position] == notFound) {
+          begins[position] = values.size();
+          inRequestOrder = inRequestOrder && (position >= lastPosition);
+          lastPosition = position;
+        }
+        ++counts[position];
+        values.push_back(value);
+      });
+
+      if (!result) {
+        values.clear();
+        offsets.assign(reportDataDictionaryIndices.size() + 1, 0);
+        return false;
+      }
+
+      for (std::size_t i = 0; i < reportDataDictionaryIndices.size(); ++i) {
+        offsets[i + 1] = offsets[i] + counts[uniquePositions[i]];
+      }
+
+      if (!inRequestOrder) {
+        // the rows came back in index order, copy them into request order
+        std::vector<double> ordered;
+        ordered.reserve(offsets.back());
+        for (std::size_t i = 0; i < reportDataDictionaryIndices.size(); ++i) {
+          std::size_t u = uniquePositions[i];
+          if (counts[u] > 0) {
+            ordered.insert(ordered.end(), values.begin() + begins[u], values.begin() + begins[u] + counts[u]);
+          }
+        }
+        values.swap(ordered);
+      }
+
+      return true;
+    }
+
     SqlFileTimeSeriesQueryVector SqlFile_Impl::expandQuery(const SqlFileTimeSeriesQuery& query) {
 
       SqlFileTimeSeriesQueryVector result, temp1, temp2;
@@ -2899,8 +3251,7 @@ namespace openstudio{
     }
 
 
-    TimeSeriesVector SqlFile_Impl::timeSeries(const SqlFileTimeSeriesQuery& query) {
-      TimeSeriesVector result;
+    boost::optional<SqlFileTimeSeriesQuery> SqlFile_Impl::mf_vettedQuery(const SqlFileTimeSeriesQuery& query) {
       SqlFileTimeSeriesQuery wquery(query);
       if (!wquery.m_vetted) {
         SqlFileTimeSeriesQueryVector expanded = expandQuery(query);
@@ -2918,7 +3269,7 @@ namespace openstudio{
             LOG(Info,"Unable to return timeSeries based on query: " << std::endl << query
                 << ", because it expands to more than one (" << expanded.size() << ") query.");
           }
-          return result;
+          return boost::none;
         }
       }
 
@@ -2930,14 +3281,24 @@ namespace openstudio{
       OS_ASSERT(!wquery.timeSeries().get().regex());
       if (wquery.keyValues()) { OS_ASSERT(!wquery.keyValues().get().regex()); }
 
+      return wquery;
+    }
+
+    TimeSeriesVector SqlFile_Impl::timeSeries(const SqlFileTimeSeriesQuery& query) {
+      TimeSeriesVector result;
+      boost::optional<SqlFileTimeSeriesQuery> wquery = mf_vettedQuery(query);
+      if (!wquery) {
+        return result;
+      }
+
       // environment, reportingPeriod, and timeSeries will all be unique and explicit.
       // keyValues may or may not be explicit.
       // get all matching timeSeries and append to result.
-      std::string envPeriod = *(wquery.environment().get().name());
-      ReportingFrequency rf = *(wquery.reportingFrequency());
-      std::string tsName = *(wquery.timeSeries().get().name());
-      if (wquery.keyValues()) {
-        for (const std::string kvName : wquery.keyValues().get().names()) {
+      std::string envPeriod = *(wquery->environment().get().name());
+      ReportingFrequency rf = *(wquery->reportingFrequency());
+      std::string tsName = *(wquery->timeSeries().get().name());
+      if (wquery->keyValues()) {
+        for (const std::string kvName : wquery->keyValues().get().names()) {
           OptionalTimeSeries ots = timeSeries(envPeriod,rf.valueDescription(),tsName,kvName);
           if (ots) { result.push_back(*ots); }
         }
@@ -2949,6 +3310,142 @@ namespace openstudio{
       return result;
     }
 
+    std::vector<TimeSeriesVector> SqlFile_Impl::timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+      typedef DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator ItemIterator;
+      auto& items = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+
+      // a data dictionary item whose time series has not been read yet, and where it goes in the results
+      struct Request {
+        ItemIterator item;
+        std::size_t query;
+        std::size_t slot;
+      };
+
+      // resolve the queries in the same order as timeSeries(query), collecting the items to read by environment period
+      std::vector<std::vector<OptionalTimeSeries> > results(queries.size());
+      std::map<std::string, std::vector<Request> > requests;
+      for (std::size_t i = 0; i < queries.size(); ++i) {
+        boost::optional<SqlFileTimeSeriesQuery> wquery = mf_vettedQuery(queries[i]);
+        if (!wquery) {
+          continue;
+        }
+
+        std::string envPeriod = boost::to_upper_copy(*(wquery->environment().get().name()));
+        std::string rf = wquery->reportingFrequency()->valueDescription();
+        std::string tsName = *(wquery->timeSeries().get().name());
+        std::vector<std::string> keyValues;
+        if (wquery->keyValues()) {
+          keyValues = wquery->keyValues().get().names();
+        } else {
+          keyValues = availableKeyValues(envPeriod, rf, tsName);
+        }
+
+        for (const std::string& keyValue : keyValues) {
+          ItemIterator it = items.find(boost::make_tuple(envPeriod, rf, tsName, keyValue));
+          if (it == items.end()) {
+            // let the single time series query try its alternate spellings
+            results[i].push_back(timeSeries(envPeriod, rf, tsName, keyValue));
+          } else if (!it->timeSeries.values().empty()) {
+            results[i].push_back(it->timeSeries);
+          } else {
+            requests[envPeriod].push_back(Request{it, i, results[i].size()});
+            results[i].push_back(boost::none);
+          }
+        }
+      }
+
+      for (auto& envRequests : requests) {
+        const std::string& envPeriod = envRequests.first;
+        const std::vector<Request>& envItems = envRequests.second;
+
+        // read the values of all items in this environment period in one pass, ordered by ReportDataDictionaryIndex
+        std::vector<int> indices;
+        indices.reserve(envItems.size());
+        for (const Request& request : envItems) {
+          indices.push_back(request.item->recordIndex);
+        }
+        std::vector<std::vector<double> > values(envItems.size());
+        std::vector<std::vector<int> > timeIndices(envItems.size());
+        bool read = timeSeriesValues(envPeriod, indices, [&values, &timeIndices](std::size_t position, int timeIndex, double value) {
+          values[position].push_back(value);
+          timeIndices[position].push_back(timeIndex);
+        });
+        if (!read) {
+          LOG(Warn, "Unable to read time series in environment period '" << envPeriod << "' together, reading them one at a time");
+        }
+
+        // time axes by environment period index and reporting frequency, with the TimeIndex values each was computed
+        // from. Time series reported at the same TimeIndex values share an axis.
+        std::map<std::pair<int, std::string>, std::vector<std::pair<std::vector<int>, boost::optional<TimeSeriesAxis> > > > axes;
+        std::map<int, std::vector<std::pair<int, TimeRow> > > envTimeRows;
+
+        for (std::size_t position = 0; position < envItems.size(); ++position) {
+          const Request& request = envItems[position];
+          const DataDictionaryItem& item = *request.item;
+
+          const boost::optional<TimeSeriesAxis>* axis = nullptr;
+          if (read) {
+            auto& candidates = axes[std::make_pair(item.envPeriodIndex, item.reportingFrequency)];
+            for (const auto& candidate : candidates) {
+              if (candidate.first == timeIndices[position]) {
+                axis = &candidate.second;
+                break;
+              }
+            }
+
+            if (!axis) {
+              auto envRows = envTimeRows.find(item.envPeriodIndex);
+              if (envRows == envTimeRows.end()) {
+                envRows = envTimeRows.insert(std::make_pair(item.envPeriodIndex, timeRows(item.envPeriodIndex))).first;
+              }
+
+              std::vector<TimeRow> rows;
+              rows.reserve(timeIndices[position].size());
+              for (int timeIndex : timeIndices[position]) {
+                auto row = std::lower_bound(envRows->second.begin(), envRows->second.end(), timeIndex,
+                    [](const std::pair<int, TimeRow>& lhs, int rhs) { return lhs.first < rhs; });
+                if ((row == envRows->second.end()) || (row->first != timeIndex)) {
+                  break;
+                }
+                rows.push_back(row->second);
+              }
+
+              if (rows.size() == timeIndices[position].size()) {
+                candidates.push_back(std::make_pair(timeIndices[position], timeSeriesAxis(item, rows)));
+                axis = &candidates.back().second;
+              }
+            }
+          }
+
+          OptionalTimeSeries ts;
+          if (axis) {
+            ts = timeSeries(*axis, values[position], item.units);
+            if (ts) {
+              DataDictionaryItem ddi = item;
+              ddi.timeSeries = *ts;
+              items.replace(request.item, ddi);
+            }
+          } else {
+            ts = timeSeries(item.envPeriod, item.reportingFrequency, item.name, item.keyValue);
+          }
+          results[request.query][request.slot] = ts;
+
+          std::vector<double>().swap(values[position]);
+          std::vector<int>().swap(timeIndices[position]);
+        }
+      }
+
+      std::vector<TimeSeriesVector> result(queries.size());
+      for (std::size_t i = 0; i < queries.size(); ++i) {
+        for (const OptionalTimeSeries& ts : results[i]) {
+          if (ts) {
+            result[i].push_back(*ts);
+          }
+        }
+      }
+      return result;
+    }
+
     boost::optional<std::pair<DateTime, DateTime> > SqlFile_Impl::daylightSavingsPeriod() const
     {
       // first and last date for dst=1
@@ -3024,14 +3521,14 @@ namespace openstudio{
     {
       std::string result;
       if (m_db) {
-        sqlite3_stmt* sqlStmtPtr;
-        sqlite3_prepare_v2(m_db, "SELECT EnergyPlusVersion FROM Simulations", -1, &sqlStmtPtr, nullptr);
+        SqlStatementCache::Statement statement = prepare("SELECT EnergyPlusVersion FROM Simulations");
+        sqlite3_stmt* sqlStmtPtr = statement.get();
         int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW) {
           // in 8.1 this is 'EnergyPlus-Windows-32 8.1.0.008, YMD=2014.11.08 22:49'
           // in 8.2 this is 'EnergyPlus, Version 8.2.0-8397c2e30b, YMD=2015.01.09 08:37'
           // radiance script is writing 'EnergyPlus, VERSION 8.2, (OpenStudio) YMD=2015.1.9 08:35:36'
-          boost::regex version_regex("\\d\\.\\d[\\.\\d]*");
+          static const boost::regex version_regex("\\d\\.\\d[\\.\\d]*");
           std::string version_line = columnText(sqlite3_column_text(sqlStmtPtr, 0));
           boost::smatch version_match;
 
@@ -3039,7 +3536,6 @@ namespace openstudio{
             result = version_match[0].str();
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
       return result;
     }
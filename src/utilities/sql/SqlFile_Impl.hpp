@@ -43,7 +43,10 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio{
@@ -57,6 +60,71 @@ namespace openstudio{
   // private namespace
   namespace detail{
 
+    /// Cache of prepared statements keyed by their SQL text. Queries should bind their arguments rather than
+    /// format them into the text, so that each query shape is only prepared once. Text with values formatted
+    /// into it should go through prepareOnce instead, so that it does not push the shapes out of the cache.
+    class UTILITIES_API SqlStatementCache {
+    public:
+
+      /// A statement borrowed from the cache, it is reset and handed back to the cache when destroyed
+      class UTILITIES_API Statement {
+      public:
+        Statement(Statement&& other);
+        Statement(const Statement&) = delete;
+        Statement& operator=(const Statement&) = delete;
+        Statement& operator=(Statement&&) = delete;
+        ~Statement();
+
+        /// returns the statement, null if it could not be prepared
+        sqlite3_stmt* get() const;
+
+      private:
+        friend class SqlStatementCache;
+
+        Statement(SqlStatementCache* cache, sqlite3_stmt* statement, bool* inUse);
+
+        SqlStatementCache* m_cache;
+        sqlite3_stmt* m_statement;
+        bool* m_inUse; // null if the statement is not cached
+      };
+
+      explicit SqlStatementCache(std::size_t capacity = 128);
+
+      ~SqlStatementCache();
+
+      SqlStatementCache(const SqlStatementCache&) = delete;
+      SqlStatementCache& operator=(const SqlStatementCache&) = delete;
+
+      /// returns a prepared statement for sql, preparing it only if it is not cached. If the cached statement is
+      /// already borrowed (e.g. by an enclosing query with the same text) a statement is prepared for this use only.
+      Statement get(sqlite3* db, const std::string& sql);
+
+      /// returns a statement for sql that is prepared for this use only and finalized when destroyed
+      Statement prepareOnce(sqlite3* db, const std::string& sql);
+
+      /// finalize all cached statements, must be called before the database is closed
+      void clear();
+
+      /// number of statements in the cache
+      std::size_t size() const;
+
+      /// number of statements prepared since construction
+      std::size_t numPrepared() const;
+
+    private:
+
+      struct Entry {
+        sqlite3_stmt* statement;
+        bool inUse;
+        std::list<std::string>::iterator lruPosition;
+      };
+
+      std::size_t m_capacity;
+      std::size_t m_numPrepared;
+      std::unordered_map<std::string, Entry> m_entries;
+      std::list<std::string> m_lru; // most recently used first
+    };
+
     class UTILITIES_API SqlFile_Impl {
     public:
 
@@ -639,6 +707,19 @@ namespace openstudio{
       // this could be used to get "Mean Air Temperature" for a particular zone
       boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue);
 
+      // return the ReportDataDictionaryIndex for name, keyValue, envPeriod, and reportingFrequency
+      boost::optional<int> reportDataDictionaryIndex(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue) const;
+
+      /// read the values of several ReportDataDictionaryIndex values in one pass, see SqlFile::timeSeriesValues
+      bool timeSeriesValues(const std::string& envPeriod, const std::vector<int>& reportDataDictionaryIndices,
+          std::vector<double>& values, std::vector<std::size_t>& offsets) const;
+
+      /// read the values of several ReportDataDictionaryIndex values in one pass, calling sink with the position in
+      /// reportDataDictionaryIndices, the TimeIndex and the value for each row. All rows of one index are passed together,
+      /// in time order.
+      bool timeSeriesValues(const std::string& envPeriod, const std::vector<int>& reportDataDictionaryIndices,
+          const std::function<void(std::size_t, int, double)>& sink) const;
+
       /** Expands query to create a vector of all matching queries. The returned queries will have
        *  one environment period, one reporting frequency, and one time series name specified. The
        *  returned queries will also be "vetted". */
@@ -656,6 +737,9 @@ namespace openstudio{
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
       std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+      /// executes each query as timeSeries(query) would, see SqlFile::timeSeries(const std::vector<SqlFileTimeSeriesQuery>&)
+      std::vector<std::vector<TimeSeries> > timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
       // returns an optional pair of date times for begin and end of daylight savings time
       boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime> > daylightSavingsPeriod() const;
 
@@ -799,6 +883,14 @@ namespace openstudio{
 
     private:
 
+      /// the columns of the Time table needed to place a report in time
+      struct TimeRow {
+        boost::optional<unsigned> year;
+        unsigned month;
+        unsigned day;
+        unsigned intervalMinutes;
+      };
+
       void init();
 
       void retrieveDataDictionary();
@@ -813,6 +905,15 @@ namespace openstudio{
       std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
       boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
+      // computes the time axis of a time series of dataDictionary reported at rows, empty if there are no reports
+      boost::optional<TimeSeriesAxis> timeSeriesAxis(const DataDictionaryItem& dataDictionary, const std::vector<TimeRow>& rows);
+
+      // returns the time series with values on axis, empty if there is no axis
+      static boost::optional<TimeSeries> timeSeries(const boost::optional<TimeSeriesAxis>& axis, const std::vector<double>& values, const std::string& units);
+
+      // returns the rows of the Time table in envPeriodIndex, ordered by TimeIndex
+      std::vector<std::pair<int, TimeRow> > timeRows(int envPeriodIndex);
+
       // return first date in time table used for start date of run period variables
       openstudio::DateTime firstDateTime(bool includeHourAndMinute, int envPeriodIndex);
 
@@ -826,8 +927,15 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // returns a cached prepared statement with args bound to its parameters in order
+      template <typename... Args>
+      SqlStatementCache::Statement prepare(const std::string& sql, const Args&... args) const;
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+      // returns query if it is vetted, or the single query it expands to
+      boost::optional<SqlFileTimeSeriesQuery> mf_vettedQuery(const SqlFileTimeSeriesQuery& query);
+
       openstudio::path m_path;
       bool m_connectionOpen;
       DataDictionaryTable m_dataDictionary;
@@ -838,6 +946,8 @@ namespace openstudio{
 
       bool m_hasYear;
 
+      mutable SqlStatementCache m_statements;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
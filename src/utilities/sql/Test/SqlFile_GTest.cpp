@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include "SqlFileFixture.hpp"
+#include "../SqlFile_Impl.hpp"
 
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
@@ -38,7 +39,9 @@
 #include "../../data/TimeSeries.hpp"
 #include "../../filetypes/EpwFile.hpp"
 #include "../../units/UnitFactory.hpp"
+#include "../SqlFileTimeSeriesQuery.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <boost/regex.hpp>
 #include <resources.hxx>
@@ -188,6 +191,279 @@ TEST_F(SqlFileFixture, BadStatement)
   EXPECT_FALSE(result);
 }
 
+TEST_F(SqlFileFixture, TimeSeriesValues_Batched)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+
+  std::vector<std::tuple<std::string, std::string, std::string> > queries;
+  queries.push_back(std::make_tuple("Hourly", "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(std::make_tuple("HVAC System Timestep", "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(std::make_tuple("Hourly", "Electricity:Facility", ""));
+  queries.push_back(std::make_tuple("Hourly", "Gas:Facility", ""));
+  queries.push_back(std::make_tuple("Run Period", "Electricity:Facility", ""));
+
+  std::vector<int> indices;
+  std::vector<TimeSeries> expected;
+  for (const auto& query : queries) {
+    boost::optional<int> index = sqlFile.reportDataDictionaryIndex(envPeriod, std::get<0>(query), std::get<1>(query), std::get<2>(query));
+    ASSERT_TRUE(index);
+    indices.push_back(*index);
+    OptionalTimeSeries ts = sqlFile.timeSeries(envPeriod, std::get<0>(query), std::get<1>(query), std::get<2>(query));
+    ASSERT_TRUE(ts);
+    expected.push_back(*ts);
+  }
+
+  // meters and variables, out of order, with a duplicate
+  std::vector<std::size_t> order = {3, 0, 4, 1, 0, 2};
+  std::vector<int> requested;
+  for (auto i : order) {
+    requested.push_back(indices[i]);
+  }
+
+  std::vector<double> values;
+  std::vector<std::size_t> offsets;
+  ASSERT_TRUE(sqlFile.timeSeriesValues(envPeriod, requested, values, offsets));
+  ASSERT_EQ(requested.size() + 1, offsets.size());
+  EXPECT_EQ(values.size(), offsets.back());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    Vector expectedValues = expected[order[i]].values();
+    ASSERT_EQ(expectedValues.size(), offsets[i + 1] - offsets[i]);
+    for (std::size_t j = 0; j < expectedValues.size(); ++j) {
+      EXPECT_DOUBLE_EQ(expectedValues[j], values[offsets[i] + j]);
+    }
+  }
+
+  // sorted requests are streamed straight into values
+  std::vector<int> sorted = indices;
+  std::sort(sorted.begin(), sorted.end());
+  ASSERT_TRUE(sqlFile.timeSeriesValues(envPeriod, sorted, values, offsets));
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    auto it = std::find(indices.begin(), indices.end(), sorted[i]);
+    EXPECT_EQ(expected[it - indices.begin()].values().size(), offsets[i + 1] - offsets[i]);
+  }
+
+  // an index that is not in the data dictionary
+  EXPECT_FALSE(sqlFile.reportDataDictionaryIndex(envPeriod, "Hourly", "NotAVariable:Facility", ""));
+  EXPECT_FALSE(sqlFile.timeSeriesValues(envPeriod, {indices[0], -1}, values, offsets));
+  EXPECT_TRUE(values.empty());
+  EXPECT_FALSE(sqlFile.timeSeriesValues("Not An Environment Period", indices, values, offsets));
+
+  // no indices
+  EXPECT_TRUE(sqlFile.timeSeriesValues(envPeriod, std::vector<int>(), values, offsets));
+  EXPECT_TRUE(values.empty());
+  ASSERT_EQ(1u, offsets.size());
+  EXPECT_EQ(0u, offsets[0]);
+}
+
+TEST_F(SqlFileFixture, TimeSeries_Queries)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Timestep, "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Electricity:Facility", ""));
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Gas:Facility", ""));
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::RunPeriod, "Electricity:Facility", ""));
+  // all key values
+  queries.push_back(SqlFileTimeSeriesQuery(EnvironmentIdentifier(envPeriod), ReportingFrequency(ReportingFrequency::Hourly),
+                                           TimeSeriesIdentifier("Zone Mean Air Temperature")));
+  // a duplicate
+  queries.push_back(queries[2]);
+  // nothing matches
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "NotAVariable:Facility", ""));
+
+  // read with a fresh SqlFile so that nothing is cached from the single queries
+  openstudio::SqlFile batchFile(resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql"));
+  ASSERT_TRUE(batchFile.connectionOpen());
+  std::vector<std::vector<TimeSeries> > result = batchFile.timeSeries(queries);
+  ASSERT_EQ(queries.size(), result.size());
+  EXPECT_TRUE(result.back().empty());
+  EXPECT_LT(1u, result[5].size());
+
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    std::vector<TimeSeries> expected = sqlFile.timeSeries(queries[i]);
+    ASSERT_EQ(expected.size(), result[i].size());
+    for (std::size_t j = 0; j < expected.size(); ++j) {
+      EXPECT_EQ(expected[j].firstReportDateTime(), result[i][j].firstReportDateTime());
+      EXPECT_TRUE(expected[j].intervalLength() == result[i][j].intervalLength());
+      EXPECT_EQ(expected[j].units(), result[i][j].units());
+      EXPECT_EQ(expected[j].secondsFromFirstReport(), result[i][j].secondsFromFirstReport());
+      EXPECT_EQ(openstudio::toStandardVector(expected[j].values()), openstudio::toStandardVector(result[i][j].values()));
+    }
+  }
+
+  // the time series are cached like single queries
+  OptionalTimeSeries ts = batchFile.timeSeries(envPeriod, "Hourly", "Gas:Facility", "");
+  ASSERT_TRUE(ts);
+  EXPECT_EQ(openstudio::toStandardVector(result[3][0].values()), openstudio::toStandardVector(ts->values()));
+
+  EXPECT_TRUE(batchFile.timeSeries(std::vector<SqlFileTimeSeriesQuery>()).empty());
+}
+
+// Pulls 500 hourly variables from a generated file, run with
+// --gtest_also_run_disabled_tests --gtest_filter=SqlFile.DISABLED_TimeSeries_Queries_Benchmark
+TEST(SqlFile, DISABLED_TimeSeries_Queries_Benchmark)
+{
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileBenchmark.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  int numVariables = 500;
+  {
+    // 364 days of hourly values, so that the last report is still in the calendar year
+    openstudio::Calendar c(2012);
+    std::vector<double> values(364 * 24);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = 0.01 * i;
+    }
+    TimeSeries timeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(values), "C");
+
+    openstudio::SqlFile sql(outfile,
+        openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+        openstudio::DateTime::now(),
+        c);
+    ASSERT_TRUE(sql.connectionOpen());
+    sql.insertTimeSeriesData("Avg", "Zone", "Zone", "ZONE 1", "Zone Mean Air Temperature", openstudio::ReportingFrequency::Hourly,
+        boost::optional<std::string>(), "C", timeSeries);
+
+    // copy the first variable to the other key values
+    sql.execute("BEGIN TRANSACTION");
+    for (int i = 2; i <= numVariables; ++i) {
+      std::stringstream s;
+      s << "INSERT INTO ReportDataDictionary (ReportDataDictionaryIndex, IsMeter, Type, IndexGroup, TimestepType, KeyValue, Name, ReportingFrequency, ScheduleName, Units) "
+        << "SELECT " << i << ", IsMeter, Type, IndexGroup, TimestepType, 'ZONE " << i << "', Name, ReportingFrequency, ScheduleName, Units "
+        << "FROM ReportDataDictionary WHERE ReportDataDictionaryIndex = 1";
+      ASSERT_EQ(SQLITE_DONE, sql.execute(s.str()));
+      s.str("");
+      s << "INSERT INTO ReportData (TimeIndex, ReportDataDictionaryIndex, Value) "
+        << "SELECT TimeIndex, " << i << ", Value + " << i << " FROM ReportData WHERE ReportDataDictionaryIndex = 1";
+      ASSERT_EQ(SQLITE_DONE, sql.execute(s.str()));
+    }
+    sql.execute("COMMIT");
+  }
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  {
+    openstudio::SqlFile sql(outfile);
+    ASSERT_TRUE(sql.connectionOpen());
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(1u, envPeriods.size());
+    std::vector<std::string> keyValues = sql.availableKeyValues(envPeriods[0], "Hourly", "Zone Mean Air Temperature");
+    ASSERT_EQ(static_cast<std::size_t>(numVariables), keyValues.size());
+    for (const std::string& keyValue : keyValues) {
+      queries.push_back(SqlFileTimeSeriesQuery(envPeriods[0], ReportingFrequency::Hourly, "Zone Mean Air Temperature", keyValue));
+    }
+  }
+
+  double oneAtATime = 0;
+  {
+    openstudio::SqlFile sql(outfile);
+    auto start = std::chrono::steady_clock::now();
+    std::size_t n = 0;
+    for (const SqlFileTimeSeriesQuery& query : queries) {
+      n += sql.timeSeries(query).size();
+    }
+    oneAtATime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(queries.size(), n);
+  }
+
+  double batched = 0;
+  {
+    openstudio::SqlFile sql(outfile);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::vector<TimeSeries> > result = sql.timeSeries(queries);
+    batched = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ASSERT_EQ(queries.size(), result.size());
+    for (const auto& series : result) {
+      ASSERT_EQ(1u, series.size());
+      EXPECT_EQ(364u * 24u, series[0].values().size());
+    }
+  }
+
+  std::cout << numVariables << " hourly variables: one at a time " << oneAtATime << " s, batched " << batched << " s" << std::endl;
+
+  openstudio::filesystem::remove(outfile);
+}
+
+TEST(SqlFile, SqlStatementCache)
+{
+  sqlite3* db = nullptr;
+  ASSERT_EQ(SQLITE_OK, sqlite3_open(":memory:", &db));
+  ASSERT_EQ(SQLITE_OK, sqlite3_exec(db, "CREATE TABLE t (a INTEGER); INSERT INTO t VALUES (1); INSERT INTO t VALUES (2);", nullptr, nullptr, nullptr));
+
+  {
+    openstudio::detail::SqlStatementCache cache(2);
+    std::string sql = "SELECT a FROM t WHERE a >= ? ORDER BY a";
+
+    {
+      openstudio::detail::SqlStatementCache::Statement statement = cache.get(db, sql);
+      ASSERT_TRUE(statement.get());
+      sqlite3_bind_int(statement.get(), 1, 2);
+      ASSERT_EQ(SQLITE_ROW, sqlite3_step(statement.get()));
+      EXPECT_EQ(2, sqlite3_column_int(statement.get(), 0));
+
+      // the cached statement is borrowed, a second one is prepared
+      openstudio::detail::SqlStatementCache::Statement nested = cache.get(db, sql);
+      ASSERT_TRUE(nested.get());
+      EXPECT_NE(statement.get(), nested.get());
+      EXPECT_EQ(2u, cache.numPrepared());
+    }
+    EXPECT_EQ(1u, cache.size());
+
+    // reused, and the bindings were cleared when it was handed back
+    {
+      openstudio::detail::SqlStatementCache::Statement statement = cache.get(db, sql);
+      EXPECT_EQ(2u, cache.numPrepared());
+      EXPECT_EQ(SQLITE_DONE, sqlite3_step(statement.get()));
+      sqlite3_reset(statement.get());
+      sqlite3_bind_int(statement.get(), 1, 1);
+      ASSERT_EQ(SQLITE_ROW, sqlite3_step(statement.get()));
+      EXPECT_EQ(1, sqlite3_column_int(statement.get(), 0));
+    }
+
+    // least recently used statements are evicted
+    { auto statement = cache.get(db, "SELECT 1"); }
+    { auto statement = cache.get(db, "SELECT 2"); }
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(4u, cache.numPrepared());
+    { auto statement = cache.get(db, "SELECT 2"); }
+    EXPECT_EQ(4u, cache.numPrepared());
+    { auto statement = cache.get(db, sql); }
+    EXPECT_EQ(5u, cache.numPrepared());
+
+    // one off statements are not cached
+    {
+      auto statement = cache.prepareOnce(db, "SELECT a FROM t WHERE a >= 1");
+      ASSERT_TRUE(statement.get());
+      ASSERT_EQ(SQLITE_ROW, sqlite3_step(statement.get()));
+      EXPECT_EQ(1, sqlite3_column_int(statement.get(), 0));
+    }
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(6u, cache.numPrepared());
+    { auto statement = cache.get(db, "SELECT 2"); }
+    { auto statement = cache.get(db, sql); }
+    EXPECT_EQ(6u, cache.numPrepared());
+
+    // bad statements are not cached
+    {
+      auto statement = cache.get(db, "SELECT * FROM NonExistantTable");
+      EXPECT_FALSE(statement.get());
+    }
+    EXPECT_EQ(2u, cache.size());
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+  }
+
+  EXPECT_EQ(SQLITE_OK, sqlite3_close(db));
+}
+
 TEST_F(SqlFileFixture, CreateSqlFile)
 {
   openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest.sql");